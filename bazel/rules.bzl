@@ -24,3 +24,27 @@ def gtest(name, copts=[], linkopts=[], deps=[], **kwargs):
         linkopts=_GTEST_LINKOPTS + linkopts,
         **kwargs
     )
+
+
+def benchmark(name, copts=[], linkopts=[], deps=[], **kwargs):
+    '''
+    A wrapper around cc_binary for google benchmarks
+    Benchmarks are always built with optimizations enabled.
+    '''
+    _BENCHMARK_COPTS = [
+        "-O3",
+        "-DNDEBUG",
+    ]
+
+    _BENCHMARK_DEPS = [
+        "@com_google_benchmark//:benchmark_main",
+    ]
+
+    native.cc_binary(
+        name=name,
+        copts=_BENCHMARK_COPTS + copts,
+        deps=_BENCHMARK_DEPS + deps,
+        linkopts=linkopts,
+        testonly=True,
+        **kwargs
+    )
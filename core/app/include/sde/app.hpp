@@ -7,17 +7,23 @@
 
 // C++ Standard Library
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
+#include <memory>
+#include <optional>
 
 // SDE
 #include "sde/app_fwd.hpp"
+#include "sde/app_input.hpp"
 #include "sde/app_properties.hpp"
+#include "sde/app_timestep.hpp"
 #include "sde/audio/sound_device.hpp"
 #include "sde/expected.hpp"
 #include "sde/geometry.hpp"
 #include "sde/graphics/window.hpp"
 #include "sde/keyboard.hpp"
+#include "sde/memory.hpp"
 #include "sde/time.hpp"
 
 namespace sde
@@ -38,10 +44,28 @@ enum class AppError
   kWindowCreationFailure,
   kSoundDeviceInvalid,
   kSoundDeviceCreationFailure,
+  kInputReplayInvalid,
+  kInputRecordingFailure,
 };
 
 std::ostream& operator<<(std::ostream& os, AppError error);
 
+/**
+ * @brief Options for running an App without a window, sound device or display
+ */
+struct AppHeadlessOptions
+{
+  /// Framebuffer size reported to callbacks
+  Vec2i viewport_size = {640, 480};
+  /// Number of frames to run before closing; if zero, runs until a callback returns AppDirective::kClose
+  std::size_t frame_limit = 0;
+  /// Source of time; if unset, time advances by exactly one loop period per frame
+  AppTimestep::clock_type clock = nullptr;
+  /// Input recording (see AppInputRecorder) which stands in for polling a window; if set, input and frame times
+  /// come from the recording, in place of the clock, and the app closes after its last frame
+  asset::path input_replay_path = {};
+};
+
 class App
 {
 public:
@@ -54,19 +78,76 @@ public:
 
   App(App&&) = default;
 
-  void spin(OnReset on_reset, OnUpdate on_update, OnClose on_close, const Rate spin_rate = Hertz(60.0F));
+  /**
+   * @brief Runs the application loop until the window is closed, or a callback returns AppDirective::kClose
+   *
+   *        Headless apps run frames back-to-back, without waiting on \p spin_rate, and close after
+   *        AppHeadlessOptions::frame_limit frames.
+   *
+   * @param spin_rate  rate at which the loop runs
+   * @param timestep  simulation time step options; see AppProperties::simulation_steps
+   */
+  void spin(
+    OnReset on_reset,
+    OnUpdate on_update,
+    OnClose on_close,
+    const Rate spin_rate = Hertz(60.0F),
+    const AppTimestepOptions& timestep = {});
+
+  /**
+   * @brief Returns true if this app runs without a window
+   */
+  [[nodiscard]] bool headless() const { return !window_.has_value(); }
 
-  const Window& window() const { return window_; }
+  /**
+   * @brief Returns app window
+   *
+   * @warning must not be called on a headless app
+   */
+  const Window& window() const { return *window_; }
 
   static expected<App, AppError> create(Window&& window, SoundDevice&& sound_device);
 
   static expected<App, AppError> create(const WindowOptions& window_options);
 
+  /**
+   * @brief Creates an app which runs without a window, sound device or display
+   *
+   *        Callbacks receive null window and sound device handles, and no input.
+   */
+  static expected<App, AppError> createHeadless(const AppHeadlessOptions& headless_options = {});
+
+  /**
+   * @brief Records the input received on each frame of the following spin to \p path (see AppInputRecorder)
+   */
+  [[nodiscard]] expected<void, AppError> recordInput(const asset::path& path);
+
 private:
   App(Window&& window, SoundDevice&& sound_device);
+  App(const AppHeadlessOptions& headless_options, std::optional<AppInputReplay>&& input_replay);
   App(const App&) = delete;
-  Window window_;
-  SoundDevice sound_device_;
+
+  void spinWindow(
+    const OnReset& on_reset,
+    const OnUpdate& on_update,
+    const OnClose& on_close,
+    const Rate spin_rate,
+    const AppTimestepOptions& timestep_options);
+
+  void spinHeadless(
+    const OnReset& on_reset,
+    const OnUpdate& on_update,
+    const OnClose& on_close,
+    const Rate spin_rate,
+    const AppTimestepOptions& timestep_options);
+
+  std::optional<Window> window_;
+  std::optional<SoundDevice> sound_device_;
+  AppHeadlessOptions headless_options_;
+  std::optional<AppInputReplay> input_replay_;
+  std::optional<AppInputRecorder> input_recorder_;
+  /// Per-frame scratch memory; heap-allocated so its address survives moves of the App
+  std::unique_ptr<ArenaMemoryResource> frame_arena_;
 };
 
 }  // namespace sde
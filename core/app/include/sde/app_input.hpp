@@ -0,0 +1,146 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file app_input.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <iosfwd>
+
+// SDE
+#include "sde/app_properties.hpp"
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/geometry.hpp"
+#include "sde/keyboard.hpp"
+#include "sde/serial/file_stream.hpp"
+#include "sde/time.hpp"
+
+namespace sde
+{
+
+enum class AppInputError
+{
+  kFileDoesNotExist,
+  kFileOpenFailed,
+  kFileWriteFailed,
+  kInvalidHeader,
+  kInvalidFrame,
+  kEndOfRecording,
+};
+
+std::ostream& operator<<(std::ostream& os, AppInputError error);
+
+/**
+ * @brief Input recording file header
+ */
+struct AppInputHeader
+{
+  static constexpr std::size_t kMagic = 0x3154504E49454453UL;  // "SDEINPT1"
+
+  std::size_t magic = kMagic;
+  /// Number of keys in each recorded key state (see KeyStates)
+  std::size_t key_count = kKeyCount;
+};
+
+/**
+ * @brief Writes the input an App receives on each frame to a file
+ *
+ *        A recording is an AppInputHeader followed by one record per frame. Each record holds a byte of flags marking
+ *        which inputs changed since the previous frame, the time since the previous frame, then only the inputs which
+ *        changed. Times are written as variable-length integers, so a frame without new input takes a few bytes.
+ *        Floating point inputs are written bit-for-bit, so replays reproduce them exactly.
+ */
+class AppInputRecorder
+{
+public:
+  static expected<AppInputRecorder, AppInputError> create(const asset::path& path);
+
+  /**
+   * @brief Appends the input of a frame which began at \p t_frame
+   */
+  [[nodiscard]] expected<void, AppInputError> record(const AppProperties& app_properties, Clock::time_point t_frame);
+
+  /**
+   * @brief Writes buffered frames to file
+   *
+   * @return AppInputError::kFileWriteFailed if any recorded frames could not be written
+   */
+  [[nodiscard]] expected<void, AppInputError> flush();
+
+  /**
+   * @brief Returns number of recorded frames
+   */
+  [[nodiscard]] std::size_t frames() const { return frames_; }
+
+  AppInputRecorder(AppInputRecorder&&) = default;
+
+private:
+  explicit AppInputRecorder(serial::file_ostream&& stream);
+
+  /// Recording file
+  serial::file_ostream stream_;
+  /// Keys held on the previous frame
+  KeyStates keys_;
+  /// Mouse position on the previous frame
+  Vec2d mouse_position_px_ = {0.0, 0.0};
+  /// Viewport size on the previous frame
+  Vec2i viewport_size_ = {0, 0};
+  /// Start time of the previous frame
+  Clock::time_point t_previous_ = {};
+  /// Number of recorded frames
+  std::size_t frames_ = 0;
+};
+
+/**
+ * @brief Reads input recorded by AppInputRecorder back into AppProperties, one frame at a time
+ *
+ *        Stands in for polling a window: a headless App replaying a recording sees the same input, on the same frames,
+ *        with the same frame times, on every run.
+ */
+class AppInputReplay
+{
+public:
+  static expected<AppInputReplay, AppInputError> open(const asset::path& path);
+
+  /**
+   * @brief Applies the input of the next recorded frame to \p app_properties
+   *
+   *        Key presses and releases are computed against the keys held on the previous frame, as when polling.
+   *
+   * @return AppInputError::kEndOfRecording after the last frame
+   */
+  [[nodiscard]] expected<void, AppInputError> next(AppProperties& app_properties);
+
+  /**
+   * @brief Returns recorded start time of the most recent frame, counted from the start of the first frame
+   */
+  [[nodiscard]] Clock::time_point time() const { return t_frame_; }
+
+  /**
+   * @brief Returns number of replayed frames
+   */
+  [[nodiscard]] std::size_t frames() const { return frames_; }
+
+  AppInputReplay(AppInputReplay&&) = default;
+
+private:
+  explicit AppInputReplay(serial::file_istream&& stream);
+
+  /// Recording file
+  serial::file_istream stream_;
+  /// Keys held on the most recent frame
+  KeyStates keys_;
+  /// Mouse position on the most recent frame
+  Vec2d mouse_position_px_ = {0.0, 0.0};
+  /// Viewport size on the most recent frame
+  Vec2i viewport_size_ = {0, 0};
+  /// Recorded start time of the most recent frame
+  Clock::time_point t_frame_ = {};
+  /// Number of replayed frames
+  std::size_t frames_ = 0;
+};
+
+}  // namespace sde
@@ -0,0 +1,185 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file app_pacer.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <functional>
+
+// SDE
+#include "sde/time.hpp"
+
+namespace sde
+{
+
+/// Number of most recent frames which frame time statistics are computed over
+static constexpr std::size_t kFrameTimeWindow = 240;
+
+/// Width of each frame time histogram bucket
+static constexpr TimeOffset kFrameTimeBucketWidth = std::chrono::microseconds{100};
+
+/// Number of frame time histogram buckets; longer frames share the last bucket
+static constexpr std::size_t kFrameTimeBucketCount = 500;
+
+/**
+ * @brief Frame time percentiles, over the most recent frames
+ */
+struct FrameTimeStats
+{
+  /// Median frame time
+  TimeOffset p50 = TimeOffset::zero();
+  /// 95th percentile frame time
+  TimeOffset p95 = TimeOffset::zero();
+  /// 99th percentile frame time
+  TimeOffset p99 = TimeOffset::zero();
+  /// Longest frame time
+  TimeOffset max = TimeOffset::zero();
+  /// Number of frames statistics were computed over
+  std::size_t samples = 0;
+};
+
+/**
+ * @brief Histogram of the most recent kFrameTimeWindow frame times
+ *
+ *        Percentiles are resolved to the upper edge of their kFrameTimeBucketWidth bucket, and never exceed the longest
+ *        frame time in the window.
+ */
+class FrameTimeHistogram
+{
+public:
+  /**
+   * @brief Adds a frame time, replacing the oldest once kFrameTimeWindow frame times have been added
+   */
+  void record(TimeOffset frame_time);
+
+  /**
+   * @brief Computes percentiles over the most recently recorded frame times
+   */
+  [[nodiscard]] FrameTimeStats stats() const;
+
+  /**
+   * @brief Removes all recorded frame times
+   */
+  void reset();
+
+private:
+  /// Returns the smallest frame time below which a \p fraction of recorded frame times fall
+  TimeOffset percentile(float fraction, std::size_t samples, TimeOffset max) const;
+
+  /// Ring of most recent frame times
+  std::array<TimeOffset, kFrameTimeWindow> frame_times_ = {};
+  /// Number of frame times in each bucket
+  std::array<std::size_t, kFrameTimeBucketCount> buckets_ = {};
+  /// Total number of recorded frame times
+  std::size_t count_ = 0;
+};
+
+/**
+ * @brief Frame pacing options
+ */
+struct AppPacerOptions
+{
+  /// Time before each deadline at which sleeping gives way to yielding; if zero, measured on creation, and limited to a
+  /// quarter of the loop period
+  TimeOffset spin_threshold = TimeOffset::zero();
+  /// Number of sleeps used to measure sleep overshoot
+  std::size_t calibration_samples = 10;
+};
+
+/**
+ * @brief Holds a loop to a fixed rate
+ *
+ *        OS sleeps routinely overshoot their deadline by a millisecond or more. The pacer sleeps until it is within a
+ *        measured margin of the deadline, then yields until the deadline passes, which trades a little CPU for wakeups
+ *        within microseconds of the target.
+ */
+class AppPacer
+{
+public:
+  /// Source of time used to pace frames
+  using clock_type = std::function<Clock::time_point()>;
+
+  /// Blocks the calling thread for at least the given duration
+  using sleep_type = std::function<void(TimeOffset)>;
+
+  /// Gives up the remainder of the calling thread's time slice
+  using yield_type = std::function<void()>;
+
+  /**
+   * @param rate  rate at which wait() returns
+   * @param options  pacing options
+   */
+  AppPacer(
+    Rate rate,
+    const AppPacerOptions& options = {},
+    clock_type clock = Clock::now,
+    sleep_type sleep = sleepFor,
+    yield_type yield = yieldThread);
+
+  /**
+   * @brief Returns the 90th percentile of the amounts by which sleeping for \p request overshot, over \p samples
+   *        sleeps
+   *
+   * @note  a percentile, rather than the longest overshoot, so that a single sleep delayed by a busy system does not
+   *        inflate the spin threshold for the lifetime of the pacer
+   */
+  static TimeOffset
+  measureSleepOvershoot(std::size_t samples, TimeOffset request, const clock_type& clock, const sleep_type& sleep);
+
+  /**
+   * @brief Restarts pacing from the current time, and clears frame time statistics
+   */
+  void reset();
+
+  /**
+   * @brief Blocks until the next frame deadline, then records the duration of the frame which just ended
+   *
+   *        If the deadline has already passed, returns immediately and schedules the next deadline one period later.
+   */
+  void wait();
+
+  /**
+   * @brief Returns time before each deadline at which sleeping gives way to yielding
+   */
+  [[nodiscard]] TimeOffset spinThreshold() const { return spin_threshold_; }
+
+  /**
+   * @brief Returns frame time statistics
+   */
+  [[nodiscard]] const FrameTimeHistogram& frameTimes() const { return frame_times_; }
+
+  /**
+   * @brief Returns number of frames which finished after their deadline
+   */
+  [[nodiscard]] std::size_t missed() const { return missed_; }
+
+private:
+  static void sleepFor(TimeOffset duration);
+
+  static void yieldThread();
+
+  /// Target period between frames
+  TimeOffset period_;
+  /// Source of time used to pace frames
+  clock_type clock_;
+  /// Blocks the calling thread
+  sleep_type sleep_;
+  /// Yields the calling thread
+  yield_type yield_;
+  /// Time before each deadline at which sleeping gives way to yielding
+  TimeOffset spin_threshold_;
+  /// Start of the current frame
+  Clock::time_point t_frame_ = {};
+  /// Deadline of the current frame
+  Clock::time_point t_next_ = {};
+  /// Frame time statistics
+  FrameTimeHistogram frame_times_;
+  /// Number of frames which finished after their deadline
+  std::size_t missed_ = 0;
+};
+
+}  // namespace sde
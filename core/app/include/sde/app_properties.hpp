@@ -5,12 +5,17 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <cstddef>
+
 // SDE
+#include "sde/app_pacer.hpp"
 #include "sde/asset.hpp"
 #include "sde/audio/sound_device_fwd.hpp"
 #include "sde/geometry.hpp"
 #include "sde/graphics/window_fwd.hpp"
 #include "sde/keyboard.hpp"
+#include "sde/memory.hpp"
 #include "sde/time.hpp"
 #include "sde/vector.hpp"
 
@@ -31,6 +36,18 @@ struct AppProperties
   TimeOffset time = TimeOffset::zero();
   TimeOffset time_delta = TimeOffset::zero();
 
+  /// Number of simulation steps to advance during this update
+  std::size_t simulation_steps = 0;
+  /// Duration of each simulation step; fixed in fixed-timestep mode, otherwise equal to time_delta
+  TimeOffset simulation_time_delta = TimeOffset::zero();
+  /// Total simulated time, including the steps of this update
+  TimeOffset simulation_time = TimeOffset::zero();
+  /// Fraction of a step left unsimulated, in [0, 1); used to blend between previous and current simulation states
+  float interpolation_alpha = 0.F;
+
+  /// Frame time percentiles over recent frames, including time spent waiting for the next frame
+  FrameTimeStats frame_time_stats = {};
+
   Vec2i viewport_size = {640, 480};
   Vec2d mouse_position_px = {0.0, 0.0};
   Vec2d mouse_scroll = {0.0, 0.0};
@@ -39,6 +56,9 @@ struct AppProperties
 
   sde::vector<AppDragAndDropPayload> drag_and_drop_payloads;
 
+  /// Linear arena for transient, per-frame allocations; reset at the end of every frame
+  ArenaMemoryResource* frame_arena = nullptr;
+
   Vec2f getMousePositionViewport() const
   {
     return {
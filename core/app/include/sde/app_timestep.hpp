@@ -0,0 +1,118 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file app_timestep.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <functional>
+
+// SDE
+#include "sde/time.hpp"
+
+namespace sde
+{
+
+/**
+ * @brief Simulation time step options for App::spin
+ */
+struct AppTimestepOptions
+{
+  /// Fixed simulation time step; if zero, each update simulates a single step spanning the measured frame time
+  TimeOffset step = TimeOffset::zero();
+  /// Most fixed steps simulated by a single update; time past this is dropped, so a stall is not followed by a
+  /// sequence of ever-longer catch-up updates
+  std::size_t max_steps = 5;
+};
+
+/**
+ * @brief Converts measured frame time into simulation time steps
+ *
+ *        In fixed-timestep mode, measured time accumulates and is consumed in whole steps. Time which is left over
+ *        carries into the next update, and is reported as an interpolation alpha so that rendering can blend between
+ *        the previous and current simulation states. Simulation therefore advances the same way at any frame rate.
+ */
+class AppTimestep
+{
+public:
+  /// Source of time used to measure frames
+  using clock_type = std::function<Clock::time_point()>;
+
+  explicit AppTimestep(const AppTimestepOptions& options, clock_type clock = Clock::now);
+
+  /**
+   * @brief Restarts timing from the current time, discarding accumulated time
+   */
+  void reset();
+
+  /**
+   * @brief Measures time since the previous update (or reset), and computes the steps to simulate
+   *
+   * @return number of simulation steps
+   */
+  std::size_t update();
+
+  /**
+   * @brief Returns true if simulation uses a fixed time step
+   */
+  [[nodiscard]] bool fixed() const { return options_.step > TimeOffset::zero(); }
+
+  /**
+   * @brief Returns measured time since reset, as of the most recent update
+   */
+  [[nodiscard]] TimeOffset time() const { return t_prev_ - t_start_; }
+
+  /**
+   * @brief Returns measured time between the two most recent updates
+   */
+  [[nodiscard]] TimeOffset timeDelta() const { return time_delta_; }
+
+  /**
+   * @brief Returns number of simulation steps computed by the most recent update
+   */
+  [[nodiscard]] std::size_t steps() const { return steps_; }
+
+  /**
+   * @brief Returns the duration of each simulation step computed by the most recent update
+   */
+  [[nodiscard]] TimeOffset stepDelta() const { return fixed() ? options_.step : time_delta_; }
+
+  /**
+   * @brief Returns total simulated time since reset
+   */
+  [[nodiscard]] TimeOffset simulationTime() const { return simulation_time_; }
+
+  /**
+   * @brief Returns fraction of a step of measured time which has not yet been simulated, in [0, 1)
+   */
+  [[nodiscard]] float alpha() const;
+
+  /**
+   * @brief Returns total measured time dropped since reset because updates needed more than the maximum steps
+   */
+  [[nodiscard]] TimeOffset dropped() const { return dropped_; }
+
+private:
+  /// Simulation time step options
+  AppTimestepOptions options_;
+  /// Source of time used to measure frames
+  clock_type clock_;
+  /// Time of most recent reset
+  Clock::time_point t_start_ = {};
+  /// Time of most recent update
+  Clock::time_point t_prev_ = {};
+  /// Measured time between the two most recent updates
+  TimeOffset time_delta_ = TimeOffset::zero();
+  /// Measured time not yet simulated
+  TimeOffset accumulated_ = TimeOffset::zero();
+  /// Total simulated time
+  TimeOffset simulation_time_ = TimeOffset::zero();
+  /// Total dropped time
+  TimeOffset dropped_ = TimeOffset::zero();
+  /// Number of steps computed by the most recent update
+  std::size_t steps_ = 0;
+};
+
+}  // namespace sde
@@ -1,25 +1,31 @@
 // C++ Standard Library
 #include <algorithm>
 #include <array>
-#include <chrono>
 #include <cstdio>
+#include <memory>
+#include <optional>
 #include <ostream>
-#include <thread>
 
 // GLWF
 #include <GLFW/glfw3.h>
 
 // SDE
 #include "sde/app.hpp"
+#include "sde/app_input.hpp"
+#include "sde/app_pacer.hpp"
 #include "sde/audio/sound_device.hpp"
 #include "sde/graphics/window.hpp"
 #include "sde/logging.hpp"
+#include "sde/profiler.hpp"
 
 namespace sde
 {
 namespace
 {
 
+/// Size of blocks allocated by the per-frame arena
+constexpr std::size_t kFrameArenaBlockSize = 256UL * 1024UL;
+
 constexpr std::array<std::pair<int, std::size_t>, static_cast<size_t>(KeyCode::_Count_)> kKeyScanPattern{{
   {GLFW_KEY_1, static_cast<std::size_t>(KeyCode::kNum1)},
   {GLFW_KEY_2, static_cast<std::size_t>(KeyCode::kNum2)},
@@ -94,6 +100,75 @@ void glfwImplDropCallback(GLFWwindow* glfw_window, int path_count, const char* p
     });
 }
 
+/**
+ * @brief Advances simulation time, then runs the callback selected by the previous frame
+ *
+ * @return false if the previous frame requested that the app close
+ */
+[[nodiscard]] bool appImplUpdate(
+  AppProperties& app_properties,
+  AppTimestep& timestep,
+  AppDirective& next_directive,
+  const App::OnReset& on_reset,
+  const App::OnUpdate& on_update)
+{
+  if (next_directive == AppDirective::kClose)
+  {
+    return false;
+  }
+
+  // Timing restarts before a reset, so that on_reset sees the restarted times rather than those of the previous frame
+  if (next_directive == AppDirective::kReset)
+  {
+    timestep.reset();
+  }
+  else
+  {
+    timestep.update();
+  }
+
+  app_properties.simulation_steps = timestep.steps();
+  app_properties.simulation_time_delta = timestep.stepDelta();
+  app_properties.simulation_time = timestep.simulationTime();
+  app_properties.interpolation_alpha = timestep.alpha();
+  app_properties.time = timestep.time();
+  app_properties.time_delta = timestep.timeDelta();
+
+  SDE_PROFILE_SCOPE("App::update");
+  switch (next_directive)
+  {
+  case AppDirective::kContinue:
+    next_directive = on_update(app_properties);
+    break;
+  case AppDirective::kReset:
+    next_directive = on_reset(app_properties);
+    break;
+  case AppDirective::kClose:
+    break;
+  }
+  return true;
+}
+
+/**
+ * @brief Appends input of the current frame to an input recording, if one is active; stops recording on failure
+ */
+void appImplRecordInput(
+  std::optional<AppInputRecorder>& input_recorder,
+  const AppProperties& app_properties,
+  Clock::time_point t_frame)
+{
+  if (!input_recorder.has_value())
+  {
+    return;
+  }
+  else if (auto ok_or_error = input_recorder->record(app_properties, t_frame); !ok_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << "Input recording stopped after " << input_recorder->frames()
+                    << " frames with error: " << ok_or_error.error();
+    input_recorder.reset();
+  }
+}
+
 }  // namespace
 
 std::ostream& operator<<(std::ostream& os, AppDirective directive)
@@ -115,6 +190,8 @@ std::ostream& operator<<(std::ostream& os, AppError error)
     SDE_OS_ENUM_CASE(AppError::kWindowCreationFailure)
     SDE_OS_ENUM_CASE(AppError::kSoundDeviceInvalid)
     SDE_OS_ENUM_CASE(AppError::kSoundDeviceCreationFailure)
+    SDE_OS_ENUM_CASE(AppError::kInputReplayInvalid)
+    SDE_OS_ENUM_CASE(AppError::kInputRecordingFailure)
   }
   return os;
 }
@@ -148,33 +225,115 @@ expected<App, AppError> App::create(const WindowOptions& options)
   return App{std::move(window_or_error).value(), std::move(audio_or_error).value()};
 }
 
+expected<App, AppError> App::createHeadless(const AppHeadlessOptions& headless_options)
+{
+  if (headless_options.input_replay_path.empty())
+  {
+    return App{headless_options, std::nullopt};
+  }
+
+  auto replay_or_error = AppInputReplay::open(headless_options.input_replay_path);
+  if (!replay_or_error.has_value())
+  {
+    SDE_LOG_DEBUG() << "InputReplayInvalid: " << replay_or_error.error() << " "
+                    << SDE_OSNV(headless_options.input_replay_path);
+    return make_unexpected(AppError::kInputReplayInvalid);
+  }
+  return App{headless_options, std::move(replay_or_error).value()};
+}
+
 App::App(Window&& window, SoundDevice&& sound_device) :
-    window_{std::move(window)}, sound_device_{std::move(sound_device)}
+    window_{std::move(window)},
+    sound_device_{std::move(sound_device)},
+    frame_arena_{std::make_unique<ArenaMemoryResource>(kFrameArenaBlockSize)}
 {}
 
-void App::spin(OnReset on_reset, OnUpdate on_update, OnClose on_close, const Rate spin_rate)
+App::App(const AppHeadlessOptions& headless_options, std::optional<AppInputReplay>&& input_replay) :
+    window_{std::nullopt},
+    sound_device_{std::nullopt},
+    headless_options_{headless_options},
+    input_replay_{std::move(input_replay)},
+    frame_arena_{std::make_unique<ArenaMemoryResource>(kFrameArenaBlockSize)}
+{}
+
+expected<void, AppError> App::recordInput(const asset::path& path)
+{
+  auto recorder_or_error = AppInputRecorder::create(path);
+  if (!recorder_or_error.has_value())
+  {
+    SDE_LOG_DEBUG() << "InputRecordingFailure: " << recorder_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AppError::kInputRecordingFailure);
+  }
+  input_recorder_.emplace(std::move(recorder_or_error).value());
+  return {};
+}
+
+void App::spin(
+  OnReset on_reset,
+  OnUpdate on_update,
+  OnClose on_close,
+  const Rate spin_rate,
+  const AppTimestepOptions& timestep_options)
 {
   SDE_ASSERT_NE(on_reset, nullptr);
   SDE_ASSERT_NE(on_update, nullptr);
   SDE_ASSERT_NE(on_close, nullptr);
 
+  if (headless())
+  {
+    spinHeadless(on_reset, on_update, on_close, spin_rate, timestep_options);
+  }
+  else
+  {
+    spinWindow(on_reset, on_update, on_close, spin_rate, timestep_options);
+  }
+
+  // Recording covers a single spin; buffered frames are written out before closing it, so that failures are reported
+  if (input_recorder_.has_value())
+  {
+    if (auto ok_or_error = input_recorder_->flush(); ok_or_error.has_value())
+    {
+      SDE_LOG_INFO() << "Recorded input of " << input_recorder_->frames() << " frames";
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "Input recording of " << input_recorder_->frames()
+                      << " frames failed with error: " << ok_or_error.error();
+    }
+    input_recorder_.reset();
+  }
+}
+
+void App::spinWindow(
+  const OnReset& on_reset,
+  const OnUpdate& on_update,
+  const OnClose& on_close,
+  const Rate spin_rate,
+  const AppTimestepOptions& timestep_options)
+{
   AppProperties app_properties;
-  app_properties.window = window_.value();
-  app_properties.sound_device = sound_device_.handle();
+  app_properties.window = window_->value();
+  app_properties.sound_device = sound_device_->handle();
+  app_properties.frame_arena = frame_arena_.get();
 
-  auto* glfw_window = reinterpret_cast<GLFWwindow*>(window_.value());
+  auto* glfw_window = reinterpret_cast<GLFWwindow*>(window_->value());
 
-  auto t_start = Clock::now();
-  auto t_prev = t_start;
-  auto t_next = t_start + spin_rate.period();
+  // Time is sampled once per frame, after input, so that a recording replays with the same frame times
+  auto t_frame = Clock::now();
+  AppTimestep timestep{timestep_options, [&t_frame] { return t_frame; }};
+  AppPacer pacer{spin_rate};
 
   glfwSetWindowUserPointer(glfw_window, reinterpret_cast<void*>(&app_properties));
   auto previous_scroll_callback = glfwSetScrollCallback(glfw_window, glfwImplScrollEventHandler);
   auto previous_drop_callback = glfwSetDropCallback(glfw_window, glfwImplDropCallback);
 
+  SetProfileThreadName("app");
+
   AppDirective next_directive = AppDirective::kReset;
   while (!glfwWindowShouldClose(glfw_window))
   {
+    SDE_PROFILE_SCOPE("App::spin");
+
     glfwGetFramebufferSize(
       glfw_window, (app_properties.viewport_size.data() + 0), (app_properties.viewport_size.data() + 1));
 
@@ -185,40 +344,29 @@ void App::spin(OnReset on_reset, OnUpdate on_update, OnClose on_close, const Rat
 
     glfwImplScanKeyStates(glfw_window, app_properties.keys);
 
-    switch (next_directive)
+    t_frame = Clock::now();
+
+    appImplRecordInput(input_recorder_, app_properties, t_frame);
+
+    if (!appImplUpdate(app_properties, timestep, next_directive, on_reset, on_update))
     {
-    case AppDirective::kContinue:
-      next_directive = on_update(app_properties);
-      break;
-    case AppDirective::kReset:
-      t_start = Clock::now();
-      t_prev = t_start;
-      next_directive = on_reset(app_properties);
-      break;
-    case AppDirective::kClose:
       return;
     }
 
-    glfwSwapBuffers(glfw_window);
-
-    const auto t_now = Clock::now();
-    if (t_now > t_next)
     {
-      SDE_LOG_WARN() << "loop rate " << toHertz(spin_rate) << " Hz not met (behind by " << toSeconds(t_now - t_next)
-                     << " s)";
-      t_next = t_now + spin_rate.period();
+      SDE_PROFILE_SCOPE("App::swap");
+      glfwSwapBuffers(glfw_window);
     }
-    else
+
     {
-      std::this_thread::sleep_until(t_next);
-      t_next += spin_rate.period();
+      SDE_PROFILE_SCOPE("App::wait");
+      pacer.wait();
+      app_properties.frame_time_stats = pacer.frameTimes().stats();
     }
 
     app_properties.drag_and_drop_payloads.clear();
     app_properties.mouse_scroll.setZero();
-    app_properties.time = (t_now - t_start);
-    app_properties.time_delta = (t_now - t_prev);
-    t_prev = t_now;
+    frame_arena_->reset();
   }
 
   on_close(app_properties);
@@ -228,4 +376,87 @@ void App::spin(OnReset on_reset, OnUpdate on_update, OnClose on_close, const Rat
   glfwSetWindowUserPointer(glfw_window, nullptr);
 }
 
+void App::spinHeadless(
+  const OnReset& on_reset,
+  const OnUpdate& on_update,
+  const OnClose& on_close,
+  const Rate spin_rate,
+  const AppTimestepOptions& timestep_options)
+{
+  AppProperties app_properties;
+  app_properties.viewport_size = headless_options_.viewport_size;
+  app_properties.frame_arena = frame_arena_.get();
+
+  // Frame times come from a replayed recording, then a given clock; otherwise, each frame appears to take exactly one
+  // loop period, however long it actually takes
+  Clock::time_point t_simulated = {};
+  AppTimestep::clock_type clock;
+  if (input_replay_.has_value())
+  {
+    clock = [&replay = *input_replay_] { return replay.time(); };
+  }
+  else if (headless_options_.clock)
+  {
+    clock = headless_options_.clock;
+  }
+  else
+  {
+    clock = [&t_simulated] { return t_simulated; };
+  }
+
+  auto t_frame = clock();
+  AppTimestep timestep{timestep_options, [&t_frame] { return t_frame; }};
+
+  // Frame time statistics report how long frames actually take, since nothing waits between them
+  FrameTimeHistogram frame_times;
+  auto t_frame_start = Clock::now();
+
+  SetProfileThreadName("app");
+
+  AppDirective next_directive = AppDirective::kReset;
+  for (std::size_t frame = 0; (headless_options_.frame_limit == 0) or (frame < headless_options_.frame_limit); ++frame)
+  {
+    SDE_PROFILE_SCOPE("App::spin");
+
+    if (input_replay_.has_value())
+    {
+      if (auto ok_or_error = input_replay_->next(app_properties); !ok_or_error.has_value())
+      {
+        if (ok_or_error.error() == AppInputError::kEndOfRecording)
+        {
+          SDE_LOG_INFO() << "Replayed input of " << input_replay_->frames() << " frames";
+        }
+        else
+        {
+          SDE_LOG_ERROR() << "Input replay stopped after " << input_replay_->frames()
+                          << " frames with error: " << ok_or_error.error();
+        }
+        break;
+      }
+    }
+
+    t_frame = clock();
+
+    appImplRecordInput(input_recorder_, app_properties, t_frame);
+
+    if (!appImplUpdate(app_properties, timestep, next_directive, on_reset, on_update))
+    {
+      return;
+    }
+
+    t_simulated += spin_rate.period();
+
+    const auto t_now = Clock::now();
+    frame_times.record(t_now - t_frame_start);
+    app_properties.frame_time_stats = frame_times.stats();
+    t_frame_start = t_now;
+
+    app_properties.drag_and_drop_payloads.clear();
+    app_properties.mouse_scroll.setZero();
+    frame_arena_->reset();
+  }
+
+  on_close(app_properties);
+}
+
 }  // namespace sde
@@ -0,0 +1,310 @@
+// C++ Standard Library
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// SDE
+#include "sde/app_input.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+namespace
+{
+
+/// Flags marking which inputs are stored in a frame record
+enum AppInputFlags : std::uint8_t
+{
+  kKeysChanged = 1 << 0,
+  kMouseMoved = 1 << 1,
+  kMouseScrolled = 1 << 2,
+  kViewportResized = 1 << 3,
+  kPathsDropped = 1 << 4,
+};
+
+/// Size of block buffered between the recording file and the recorder or replay
+constexpr std::size_t kBlockSize = 16UL * 1024UL;
+
+/// Number of bytes used to store the keys held on a frame
+constexpr std::size_t kKeyBytes = (kKeyCount + 7) / 8;
+
+template <typename OStreamT> [[nodiscard]] bool writeBytes(OStreamT& os, const void* ptr, std::size_t len)
+{
+  return os.write(ptr, len) == len;
+}
+
+template <typename IStreamT> [[nodiscard]] bool readBytes(IStreamT& is, void* ptr, std::size_t len)
+{
+  return (is.available() >= len) and (is.read(ptr, len) == len);
+}
+
+/// Writes \p value 7 bits at a time, least significant first, with the high bit of each byte set if more follow
+template <typename OStreamT> [[nodiscard]] bool writeVarint(OStreamT& os, std::uint64_t value)
+{
+  std::uint8_t bytes[10];
+  std::size_t len = 0;
+  do
+  {
+    bytes[len] = static_cast<std::uint8_t>(value & 0x7F);
+    value >>= 7;
+    bytes[len++] |= (value > 0) ? 0x80 : 0x00;
+  } while (value > 0);
+  return writeBytes(os, bytes, len);
+}
+
+template <typename IStreamT> [[nodiscard]] bool readVarint(IStreamT& is, std::uint64_t& value)
+{
+  value = 0;
+  for (std::size_t shift = 0; shift < 64; shift += 7)
+  {
+    std::uint8_t byte = 0;
+    if (!readBytes(is, &byte, 1))
+    {
+      return false;
+    }
+    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename OStreamT> [[nodiscard]] bool writeKeys(OStreamT& os, const std::bitset<kKeyCount>& down)
+{
+  std::uint8_t bytes[kKeyBytes] = {};
+  for (std::size_t i = 0; i < kKeyCount; ++i)
+  {
+    bytes[i / 8] |= static_cast<std::uint8_t>(down[i]) << (i % 8);
+  }
+  return writeBytes(os, bytes, kKeyBytes);
+}
+
+template <typename IStreamT> [[nodiscard]] bool readKeys(IStreamT& is, std::bitset<kKeyCount>& down)
+{
+  std::uint8_t bytes[kKeyBytes] = {};
+  if (!readBytes(is, bytes, kKeyBytes))
+  {
+    return false;
+  }
+  for (std::size_t i = 0; i < kKeyCount; ++i)
+  {
+    down[i] = (bytes[i / 8] >> (i % 8)) & 1;
+  }
+  return true;
+}
+
+template <typename StreamT, typename VecT> [[nodiscard]] bool writeVec(StreamT& os, const VecT& v)
+{
+  return writeBytes(os, v.data(), sizeof(typename VecT::Scalar) * VecT::SizeAtCompileTime);
+}
+
+template <typename StreamT, typename VecT> [[nodiscard]] bool readVec(StreamT& is, VecT& v)
+{
+  return readBytes(is, v.data(), sizeof(typename VecT::Scalar) * VecT::SizeAtCompileTime);
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, AppInputError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(AppInputError::kFileDoesNotExist)
+    SDE_OS_ENUM_CASE(AppInputError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(AppInputError::kFileWriteFailed)
+    SDE_OS_ENUM_CASE(AppInputError::kInvalidHeader)
+    SDE_OS_ENUM_CASE(AppInputError::kInvalidFrame)
+    SDE_OS_ENUM_CASE(AppInputError::kEndOfRecording)
+  }
+  return os;
+}
+
+expected<AppInputRecorder, AppInputError> AppInputRecorder::create(const asset::path& path)
+{
+  auto ofs_or_error = serial::file_ostream::create(path, serial::file_ostream::default_flags, kBlockSize);
+  if (!ofs_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AppInputError::kFileOpenFailed);
+  }
+
+  const AppInputHeader header;
+  if (!writeBytes(*ofs_or_error, &header, sizeof(AppInputHeader)))
+  {
+    return make_unexpected(AppInputError::kFileWriteFailed);
+  }
+  return AppInputRecorder{std::move(ofs_or_error).value()};
+}
+
+AppInputRecorder::AppInputRecorder(serial::file_ostream&& stream) : stream_{std::move(stream)} {}
+
+expected<void, AppInputError> AppInputRecorder::record(const AppProperties& app_properties, Clock::time_point t_frame)
+{
+  if (frames_ == 0)
+  {
+    t_previous_ = t_frame;
+  }
+  SDE_ASSERT_GE(t_frame, t_previous_) << "frame times must not decrease";
+
+  std::uint8_t flags = 0;
+  flags |= (app_properties.keys.down != keys_.down) ? kKeysChanged : 0;
+  flags |= (app_properties.mouse_position_px != mouse_position_px_) ? kMouseMoved : 0;
+  flags |= !app_properties.mouse_scroll.isZero(0.0) ? kMouseScrolled : 0;
+  flags |= (app_properties.viewport_size != viewport_size_) ? kViewportResized : 0;
+  flags |= !app_properties.drag_and_drop_payloads.empty() ? kPathsDropped : 0;
+
+  const auto time_delta =
+    static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t_frame - t_previous_).count());
+  bool ok = writeBytes(stream_, &flags, 1) and writeVarint(stream_, time_delta);
+  if (flags & kKeysChanged)
+  {
+    ok = ok and writeKeys(stream_, app_properties.keys.down);
+  }
+  if (flags & kMouseMoved)
+  {
+    ok = ok and writeVec(stream_, app_properties.mouse_position_px);
+  }
+  if (flags & kMouseScrolled)
+  {
+    ok = ok and writeVec(stream_, app_properties.mouse_scroll);
+  }
+  if (flags & kViewportResized)
+  {
+    ok = ok and writeVec(stream_, app_properties.viewport_size);
+  }
+  if (flags & kPathsDropped)
+  {
+    ok = ok and writeVarint(stream_, app_properties.drag_and_drop_payloads.size());
+    for (const auto& payload : app_properties.drag_and_drop_payloads)
+    {
+      const auto path = payload.path.string();
+      ok = ok and writeVec(stream_, payload.mouse_position_on_drop) and writeVarint(stream_, path.size()) and
+        writeBytes(stream_, path.data(), path.size());
+    }
+  }
+
+  if (!ok)
+  {
+    return make_unexpected(AppInputError::kFileWriteFailed);
+  }
+
+  keys_ = app_properties.keys;
+  mouse_position_px_ = app_properties.mouse_position_px;
+  viewport_size_ = app_properties.viewport_size;
+  t_previous_ = t_frame;
+  ++frames_;
+  return {};
+}
+
+expected<void, AppInputError> AppInputRecorder::flush()
+{
+  if (!stream_.try_flush())
+  {
+    return make_unexpected(AppInputError::kFileWriteFailed);
+  }
+  return {};
+}
+
+expected<AppInputReplay, AppInputError> AppInputReplay::open(const asset::path& path)
+{
+  auto ifs_or_error = serial::file_istream::create(path, serial::file_istream::default_flags, kBlockSize);
+  if (!ifs_or_error.has_value())
+  {
+    if (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist)
+    {
+      return make_unexpected(AppInputError::kFileDoesNotExist);
+    }
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AppInputError::kFileOpenFailed);
+  }
+
+  AppInputHeader header{.magic = 0};
+  if (
+    !readBytes(*ifs_or_error, &header, sizeof(AppInputHeader)) or (header.magic != AppInputHeader::kMagic) or
+    (header.key_count != kKeyCount))
+  {
+    return make_unexpected(AppInputError::kInvalidHeader);
+  }
+  return AppInputReplay{std::move(ifs_or_error).value()};
+}
+
+AppInputReplay::AppInputReplay(serial::file_istream&& stream) : stream_{std::move(stream)} {}
+
+expected<void, AppInputError> AppInputReplay::next(AppProperties& app_properties)
+{
+  if (stream_.available() == 0)
+  {
+    return make_unexpected(AppInputError::kEndOfRecording);
+  }
+
+  std::uint8_t flags = 0;
+  std::uint64_t time_delta = 0;
+  if (!readBytes(stream_, &flags, 1) or !readVarint(stream_, time_delta))
+  {
+    return make_unexpected(AppInputError::kInvalidFrame);
+  }
+
+  auto prev_down = keys_.down;
+  if ((flags & kKeysChanged) and !readKeys(stream_, keys_.down))
+  {
+    return make_unexpected(AppInputError::kInvalidFrame);
+  }
+  keys_.pressed = (keys_.down & (keys_.down ^ prev_down));
+  keys_.released = (prev_down & ~keys_.down);
+
+  if ((flags & kMouseMoved) and !readVec(stream_, mouse_position_px_))
+  {
+    return make_unexpected(AppInputError::kInvalidFrame);
+  }
+
+  Vec2d mouse_scroll = {0.0, 0.0};
+  if ((flags & kMouseScrolled) and !readVec(stream_, mouse_scroll))
+  {
+    return make_unexpected(AppInputError::kInvalidFrame);
+  }
+
+  if ((flags & kViewportResized) and !readVec(stream_, viewport_size_))
+  {
+    return make_unexpected(AppInputError::kInvalidFrame);
+  }
+
+  app_properties.drag_and_drop_payloads.clear();
+  if (flags & kPathsDropped)
+  {
+    std::uint64_t payload_count = 0;
+    if (!readVarint(stream_, payload_count))
+    {
+      return make_unexpected(AppInputError::kInvalidFrame);
+    }
+    for (std::uint64_t i = 0; i < payload_count; ++i)
+    {
+      Vec2d mouse_position_on_drop;
+      std::uint64_t path_length = 0;
+      if (!readVec(stream_, mouse_position_on_drop) or !readVarint(stream_, path_length) or
+          (path_length > stream_.available()))
+      {
+        return make_unexpected(AppInputError::kInvalidFrame);
+      }
+      std::string path(path_length, '\0');
+      if (!readBytes(stream_, path.data(), path.size()))
+      {
+        return make_unexpected(AppInputError::kInvalidFrame);
+      }
+      app_properties.drag_and_drop_payloads.push_back({mouse_position_on_drop, asset::path{std::move(path)}});
+    }
+  }
+
+  app_properties.keys = keys_;
+  app_properties.mouse_position_px = mouse_position_px_;
+  app_properties.mouse_scroll = mouse_scroll;
+  app_properties.viewport_size = viewport_size_;
+  t_frame_ += std::chrono::nanoseconds{time_delta};
+  ++frames_;
+  return {};
+}
+
+}  // namespace sde
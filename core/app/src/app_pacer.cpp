@@ -0,0 +1,180 @@
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// SDE
+#include "sde/app_pacer.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+namespace
+{
+
+/// Duration of each sleep used to measure sleep overshoot
+constexpr TimeOffset kCalibrationSleep = std::chrono::milliseconds{1};
+
+/// Fraction of measured sleeps whose overshoot the spin threshold covers; the longest few are treated as outliers
+constexpr float kOvershootPercentile = 0.9F;
+
+/// Added to measured sleep overshoot, to cover overshoots longer than any seen while measuring
+constexpr TimeOffset kSpinThresholdMargin = std::chrono::microseconds{250};
+
+/// Measured spin threshold is at most the loop period divided by this, so that the pacer always sleeps through most
+/// of each frame
+constexpr TimeOffset::rep kSpinThresholdPeriodDivisor = 4;
+
+std::size_t bucket(TimeOffset frame_time)
+{
+  const auto index = static_cast<std::size_t>(std::max(TimeOffset::zero(), frame_time) / kFrameTimeBucketWidth);
+  return std::min(index, kFrameTimeBucketCount - 1);
+}
+
+}  // namespace
+
+void FrameTimeHistogram::record(TimeOffset frame_time)
+{
+  auto& slot = frame_times_[count_ % kFrameTimeWindow];
+  if (count_ >= kFrameTimeWindow)
+  {
+    --buckets_[bucket(slot)];
+  }
+  slot = frame_time;
+  ++buckets_[bucket(slot)];
+  ++count_;
+}
+
+FrameTimeStats FrameTimeHistogram::stats() const
+{
+  FrameTimeStats stats;
+  stats.samples = std::min(count_, kFrameTimeWindow);
+  if (stats.samples == 0)
+  {
+    return stats;
+  }
+  stats.max = *std::max_element(frame_times_.begin(), frame_times_.begin() + stats.samples);
+  stats.p50 = percentile(0.50F, stats.samples, stats.max);
+  stats.p95 = percentile(0.95F, stats.samples, stats.max);
+  stats.p99 = percentile(0.99F, stats.samples, stats.max);
+  return stats;
+}
+
+TimeOffset FrameTimeHistogram::percentile(float fraction, std::size_t samples, TimeOffset max) const
+{
+  // Nearest-rank: the bucket holding the ceil(fraction * samples)-th shortest frame
+  const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<float>(samples)));
+  std::size_t cumulative = 0;
+  // The last bucket is unbounded, so frames which land in it resolve to the longest frame
+  for (std::size_t i = 0; i + 1 < kFrameTimeBucketCount; ++i)
+  {
+    cumulative += buckets_[i];
+    if (cumulative >= rank)
+    {
+      return std::min(max, static_cast<TimeOffset::rep>(i + 1) * kFrameTimeBucketWidth);
+    }
+  }
+  return max;
+}
+
+void FrameTimeHistogram::reset()
+{
+  buckets_.fill(0);
+  count_ = 0;
+}
+
+AppPacer::AppPacer(
+  Rate rate,
+  const AppPacerOptions& options,
+  clock_type clock,
+  sleep_type sleep,
+  yield_type yield) :
+    period_{rate.period()},
+    clock_{std::move(clock)},
+    sleep_{std::move(sleep)},
+    yield_{std::move(yield)},
+    spin_threshold_{options.spin_threshold}
+{
+  if (spin_threshold_ == TimeOffset::zero())
+  {
+    const auto overshoot = measureSleepOvershoot(options.calibration_samples, kCalibrationSleep, clock_, sleep_);
+    spin_threshold_ = std::min(overshoot + kSpinThresholdMargin, period_ / kSpinThresholdPeriodDivisor);
+    SDE_LOG_DEBUG() << "sleep overshoot " << toSeconds(overshoot) << " s, spinning for the last "
+                    << toSeconds(spin_threshold_) << " s of each frame";
+  }
+  this->reset();
+}
+
+TimeOffset AppPacer::measureSleepOvershoot(
+  std::size_t samples,
+  TimeOffset request,
+  const clock_type& clock,
+  const sleep_type& sleep)
+{
+  if (samples == 0)
+  {
+    return TimeOffset::zero();
+  }
+
+  std::vector<TimeOffset> overshoots;
+  overshoots.reserve(samples);
+  for (std::size_t i = 0; i < samples; ++i)
+  {
+    const auto t_start = clock();
+    sleep(request);
+    overshoots.push_back(std::max(TimeOffset::zero(), (clock() - t_start) - request));
+  }
+
+  // Nearest-rank, as for frame time percentiles
+  const auto rank = static_cast<std::size_t>(std::ceil(kOvershootPercentile * static_cast<float>(samples)));
+  const auto itr = overshoots.begin() + static_cast<std::ptrdiff_t>(std::max<std::size_t>(rank, 1) - 1);
+  std::nth_element(overshoots.begin(), itr, overshoots.end());
+  return *itr;
+}
+
+void AppPacer::reset()
+{
+  t_frame_ = clock_();
+  t_next_ = t_frame_ + period_;
+  frame_times_.reset();
+  missed_ = 0;
+}
+
+void AppPacer::wait()
+{
+  if (const auto t_now = clock_(); t_now > t_next_)
+  {
+    ++missed_;
+    SDE_LOG_WARN_RATE_LIMITED(std::chrono::seconds{1})
+      << "loop rate " << toHertz(Rate{period_}) << " Hz not met (behind by " << toSeconds(t_now - t_next_) << " s)";
+    t_next_ = t_now + period_;
+  }
+  else
+  {
+    // Sleep through most of the remaining time, which may overshoot by up to the spin threshold...
+    if (const auto remaining = t_next_ - t_now; remaining > spin_threshold_)
+    {
+      sleep_(remaining - spin_threshold_);
+    }
+    // ...then yield until the deadline
+    while (clock_() < t_next_)
+    {
+      yield_();
+    }
+    t_next_ += period_;
+  }
+
+  const auto t_now = clock_();
+  frame_times_.record(t_now - t_frame_);
+  t_frame_ = t_now;
+}
+
+void AppPacer::sleepFor(TimeOffset duration) { std::this_thread::sleep_for(duration); }
+
+void AppPacer::yieldThread() { std::this_thread::yield(); }
+
+}  // namespace sde
@@ -0,0 +1,72 @@
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+// SDE
+#include "sde/app_timestep.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+
+AppTimestep::AppTimestep(const AppTimestepOptions& options, clock_type clock) :
+    options_{options}, clock_{std::move(clock)}
+{
+  SDE_ASSERT_GE(options_.step, TimeOffset::zero());
+  SDE_ASSERT_GT(options_.max_steps, 0UL);
+  this->reset();
+}
+
+void AppTimestep::reset()
+{
+  t_start_ = clock_();
+  t_prev_ = t_start_;
+  time_delta_ = TimeOffset::zero();
+  accumulated_ = TimeOffset::zero();
+  simulation_time_ = TimeOffset::zero();
+  dropped_ = TimeOffset::zero();
+  steps_ = 0;
+}
+
+std::size_t AppTimestep::update()
+{
+  const auto t_now = clock_();
+  time_delta_ = t_now - t_prev_;
+  t_prev_ = t_now;
+
+  if (!this->fixed())
+  {
+    steps_ = 1;
+    simulation_time_ += time_delta_;
+    return steps_;
+  }
+
+  accumulated_ += time_delta_;
+  steps_ = static_cast<std::size_t>(accumulated_ / options_.step);
+  accumulated_ -= static_cast<TimeOffset::rep>(steps_) * options_.step;
+  if (steps_ > options_.max_steps)
+  {
+    const auto behind = static_cast<TimeOffset::rep>(steps_ - options_.max_steps) * options_.step;
+    dropped_ += behind;
+    steps_ = options_.max_steps;
+    SDE_LOG_WARN_RATE_LIMITED(std::chrono::seconds{1})
+      << "simulation dropped " << toSeconds(behind) << " s after exceeding " << options_.max_steps << " steps";
+  }
+  simulation_time_ += static_cast<TimeOffset::rep>(steps_) * options_.step;
+  return steps_;
+}
+
+float AppTimestep::alpha() const
+{
+  if (!this->fixed())
+  {
+    return 0.F;
+  }
+  // Rounding to float must not reach 1, which would mean a whole step was left unsimulated
+  const double ratio = static_cast<double>(accumulated_.count()) / static_cast<double>(options_.step.count());
+  return std::min(static_cast<float>(ratio), std::nextafter(1.F, 0.F));
+}
+
+}  // namespace sde
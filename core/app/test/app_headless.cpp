@@ -0,0 +1,231 @@
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/app.hpp"
+
+using namespace sde;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/// Callback invocations and the time each update observed
+struct Trace
+{
+  std::size_t resets = 0;
+  std::size_t updates = 0;
+  std::size_t closes = 0;
+  std::vector<TimeOffset> times;
+  std::vector<std::size_t> simulation_steps;
+  std::vector<float> alphas;
+
+  void spin(App& app, Rate rate = Hertz(60.0), const AppTimestepOptions& timestep = {})
+  {
+    app.spin(
+      [this](const AppProperties& app_properties) {
+        ++resets;
+        return AppDirective::kContinue;
+      },
+      [this](const AppProperties& app_properties) {
+        ++updates;
+        times.push_back(app_properties.time);
+        simulation_steps.push_back(app_properties.simulation_steps);
+        alphas.push_back(app_properties.interpolation_alpha);
+        return AppDirective::kContinue;
+      },
+      [this](const AppProperties& app_properties) { ++closes; },
+      rate,
+      timestep);
+  }
+};
+
+}  // namespace
+
+TEST(AppHeadless, Create)
+{
+  auto app_or_error = App::createHeadless();
+  ASSERT_TRUE(app_or_error.has_value());
+  ASSERT_TRUE(app_or_error->headless());
+}
+
+TEST(AppHeadless, RunsFrameLimit)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 100});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  Trace trace;
+  trace.spin(*app_or_error);
+  ASSERT_EQ(trace.resets, 1UL);
+  ASSERT_EQ(trace.updates, 99UL);
+  ASSERT_EQ(trace.closes, 1UL);
+}
+
+TEST(AppHeadless, ReportsNoWindowOrInput)
+{
+  auto app_or_error = App::createHeadless({.viewport_size = {320, 240}, .frame_limit = 10});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  app_or_error->spin(
+    [](const AppProperties& app_properties) { return AppDirective::kContinue; },
+    [](const AppProperties& app_properties) {
+      EXPECT_EQ(app_properties.window, nullptr);
+      EXPECT_EQ(app_properties.sound_device, nullptr);
+      EXPECT_EQ(app_properties.viewport_size, Vec2i(320, 240));
+      EXPECT_TRUE(app_properties.keys.down.none());
+      EXPECT_TRUE(app_properties.drag_and_drop_payloads.empty());
+      EXPECT_NE(app_properties.frame_arena, nullptr);
+      return AppDirective::kContinue;
+    },
+    [](const AppProperties& app_properties) {});
+}
+
+TEST(AppHeadless, CloseDirectiveStopsEarly)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 100});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  std::size_t updates = 0;
+  app_or_error->spin(
+    [](const AppProperties& app_properties) { return AppDirective::kContinue; },
+    [&updates](const AppProperties& app_properties) {
+      return (++updates < 5) ? AppDirective::kContinue : AppDirective::kClose;
+    },
+    [](const AppProperties& app_properties) {});
+  ASSERT_EQ(updates, 5UL);
+}
+
+TEST(AppHeadless, SimulatedTimeAdvancesOnePeriodPerFrame)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 50});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  const auto rate = Rate{10ms};
+  Trace trace;
+  trace.spin(*app_or_error, rate);
+
+  // Time restarts on reset, one frame before the first update
+  ASSERT_EQ(trace.times.size(), 49UL);
+  for (std::size_t i = 0; i < trace.times.size(); ++i)
+  {
+    ASSERT_EQ(trace.times[i], static_cast<TimeOffset::rep>(i + 1) * rate.period());
+  }
+}
+
+TEST(AppHeadless, ResetSeesRestartedTime)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 20});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  std::size_t resets = 0;
+  std::size_t updates = 0;
+  app_or_error->spin(
+    [&resets](const AppProperties& app_properties) {
+      ++resets;
+      EXPECT_EQ(app_properties.time, TimeOffset::zero());
+      EXPECT_EQ(app_properties.time_delta, TimeOffset::zero());
+      EXPECT_EQ(app_properties.simulation_time, TimeOffset::zero());
+      EXPECT_EQ(app_properties.simulation_steps, 0UL);
+      return AppDirective::kContinue;
+    },
+    [&updates](const AppProperties& app_properties) {
+      return (++updates == 5) ? AppDirective::kReset : AppDirective::kContinue;
+    },
+    [](const AppProperties& app_properties) {},
+    Rate{10ms},
+    {.step = 5ms});
+  ASSERT_EQ(resets, 2UL);
+}
+
+TEST(AppHeadless, RunsFasterThanRealTime)
+{
+  // A thousand frames at 1 Hz would take over 16 minutes if paced
+  auto app_or_error = App::createHeadless({.frame_limit = 1000});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  const auto t_start = Clock::now();
+  Trace trace;
+  trace.spin(*app_or_error, Hertz(1.0));
+  ASSERT_LT(Clock::now() - t_start, 60s);
+  ASSERT_EQ(trace.times.back(), 999s);
+}
+
+TEST(AppHeadless, InjectedClock)
+{
+  Clock::time_point now = Clock::time_point{} + 1h;
+  auto app_or_error = App::createHeadless({.frame_limit = 20, .clock = [&now] { return now; }});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  // Each update takes 3ms of injected time, regardless of loop rate
+  std::vector<TimeOffset> time_deltas;
+  app_or_error->spin(
+    [](const AppProperties& app_properties) { return AppDirective::kContinue; },
+    [&](const AppProperties& app_properties) {
+      time_deltas.push_back(app_properties.time_delta);
+      now += 3ms;
+      return AppDirective::kContinue;
+    },
+    [](const AppProperties& app_properties) {},
+    Hertz(60.0));
+
+  ASSERT_EQ(time_deltas.size(), 19UL);
+  ASSERT_EQ(time_deltas.front(), 0ms);
+  for (std::size_t i = 1; i < time_deltas.size(); ++i)
+  {
+    ASSERT_EQ(time_deltas[i], 3ms);
+  }
+}
+
+TEST(AppHeadless, FixedTimestepIsDeterministic)
+{
+  const auto run = [] {
+    auto app_or_error = App::createHeadless({.frame_limit = 500});
+    Trace trace;
+    trace.spin(*app_or_error, Hertz(60.0), {.step = Hertz(144.0).period(), .max_steps = 5});
+    return trace;
+  };
+
+  const auto first = run();
+  const auto second = run();
+  ASSERT_EQ(first.times, second.times);
+  ASSERT_EQ(first.simulation_steps, second.simulation_steps);
+  ASSERT_EQ(first.alphas, second.alphas);
+
+  // Fixed steps of simulated time are taken in order to keep up with the loop
+  std::size_t total_steps = 0;
+  for (const auto steps : first.simulation_steps)
+  {
+    total_steps += steps;
+  }
+  ASSERT_EQ(total_steps, static_cast<std::size_t>(first.times.back() / Hertz(144.0).period()));
+}
+
+TEST(AppHeadless, FrameArenaOwnedByApp)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 5});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  // Memory bound to the frame arena may be released after spin returns, so the arena lives as long as the App
+  ArenaMemoryResource* frame_arena = nullptr;
+  const auto spin = [&frame_arena](App& app) {
+    app.spin(
+      [](const AppProperties& app_properties) { return AppDirective::kContinue; },
+      [&frame_arena](const AppProperties& app_properties) {
+        frame_arena = app_properties.frame_arena;
+        return AppDirective::kContinue;
+      },
+      [](const AppProperties& app_properties) {});
+  };
+
+  spin(*app_or_error);
+  ASSERT_NE(frame_arena, nullptr);
+  const auto* const first_arena = frame_arena;
+  App moved{std::move(app_or_error).value()};
+  spin(moved);
+  ASSERT_EQ(frame_arena, first_arena);
+}
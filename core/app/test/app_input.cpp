@@ -0,0 +1,289 @@
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/app.hpp"
+#include "sde/app_input.hpp"
+
+using namespace sde;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+asset::path tempPath(const char* name) { return asset::temp_directory_path() / name; }
+
+std::string readFile(const asset::path& path)
+{
+  std::ifstream ifs{path, std::ios::binary};
+  return {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+/// Input and timing seen by a single update
+struct Frame
+{
+  TimeOffset time;
+  TimeOffset time_delta;
+  std::size_t simulation_steps;
+  float interpolation_alpha;
+  unsigned long keys_down;
+  unsigned long keys_pressed;
+  unsigned long keys_released;
+  Vec2d mouse_position_px;
+  Vec2d mouse_scroll;
+  Vec2i viewport_size;
+  std::vector<std::string> dropped_paths;
+  std::vector<Vec2d> drop_positions;
+
+  static Frame capture(const AppProperties& app_properties)
+  {
+    Frame frame{
+      .time = app_properties.time,
+      .time_delta = app_properties.time_delta,
+      .simulation_steps = app_properties.simulation_steps,
+      .interpolation_alpha = app_properties.interpolation_alpha,
+      .keys_down = app_properties.keys.down.to_ulong(),
+      .keys_pressed = app_properties.keys.pressed.to_ulong(),
+      .keys_released = app_properties.keys.released.to_ulong(),
+      .mouse_position_px = app_properties.mouse_position_px,
+      .mouse_scroll = app_properties.mouse_scroll,
+      .viewport_size = app_properties.viewport_size};
+    for (const auto& payload : app_properties.drag_and_drop_payloads)
+    {
+      frame.dropped_paths.push_back(payload.path.string());
+      frame.drop_positions.push_back(payload.mouse_position_on_drop);
+    }
+    return frame;
+  }
+
+  bool operator==(const Frame& other) const = default;
+};
+
+/**
+ * @brief Records a session with irregular frame times, key presses, mouse movement, scrolling, drops and a resize
+ *
+ * @return number of recorded frames
+ */
+std::size_t recordSession(const asset::path& path)
+{
+  static constexpr std::size_t kFrameCount = 300;
+
+  auto recorder_or_error = AppInputRecorder::create(path);
+  EXPECT_TRUE(recorder_or_error.has_value());
+
+  AppProperties app_properties;
+  auto t_frame = Clock::now();
+  for (std::size_t i = 0; i < kFrameCount; ++i)
+  {
+    t_frame += std::chrono::microseconds{16'000 + static_cast<int>((i * 7919) % 3'000)};
+    app_properties.keys.down.set(static_cast<std::size_t>(KeyCode::kW), (i / 20) % 2);
+    app_properties.keys.down.set(static_cast<std::size_t>(KeyCode::kSpace), (i % 45) == 0);
+    if ((i % 3) == 0)
+    {
+      app_properties.mouse_position_px = {0.1 * static_cast<double>(i), 480.0 / 7.0 + static_cast<double>(i)};
+    }
+    app_properties.mouse_scroll = ((i % 50) == 0) ? Vec2d{0.0, -1.5} : Vec2d{0.0, 0.0};
+    app_properties.viewport_size = (i < 100) ? Vec2i{1000, 500} : Vec2i{1280, 720};
+    app_properties.drag_and_drop_payloads.clear();
+    if (i == 150)
+    {
+      app_properties.drag_and_drop_payloads.push_back({{12.5, 40.25}, "assets/a.png"});
+      app_properties.drag_and_drop_payloads.push_back({{12.5, 40.25}, "assets/sounds/b.wav"});
+    }
+    EXPECT_TRUE(recorder_or_error->record(app_properties, t_frame).has_value());
+  }
+  EXPECT_TRUE(recorder_or_error->flush().has_value());
+  return recorder_or_error->frames();
+}
+
+/**
+ * @brief Runs a headless app which replays \p replay_path , optionally recording its input to \p record_path
+ */
+std::vector<Frame> replaySession(const asset::path& replay_path, const asset::path& record_path = {})
+{
+  auto app_or_error = App::createHeadless({.input_replay_path = replay_path});
+  EXPECT_TRUE(app_or_error.has_value());
+  if (!record_path.empty())
+  {
+    EXPECT_TRUE(app_or_error->recordInput(record_path).has_value());
+  }
+
+  std::vector<Frame> frames;
+  const auto capture = [&frames](const AppProperties& app_properties) {
+    frames.push_back(Frame::capture(app_properties));
+    return AppDirective::kContinue;
+  };
+  app_or_error->spin(capture, capture, [](const AppProperties& app_properties) {}, Hertz(60.0), {.step = 5ms});
+  return frames;
+}
+
+}  // namespace
+
+TEST(AppInput, MissingRecording)
+{
+  const auto replay_or_error = AppInputReplay::open(tempPath("sde_app_input_missing.bin"));
+  ASSERT_FALSE(replay_or_error.has_value());
+  ASSERT_EQ(replay_or_error.error(), AppInputError::kFileDoesNotExist);
+
+  const auto app_or_error = App::createHeadless({.input_replay_path = tempPath("sde_app_input_missing.bin")});
+  ASSERT_FALSE(app_or_error.has_value());
+  ASSERT_EQ(app_or_error.error(), AppError::kInputReplayInvalid);
+}
+
+TEST(AppInput, InvalidHeader)
+{
+  const auto path = tempPath("sde_app_input_invalid.bin");
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "not an input recording";
+  }
+  const auto replay_or_error = AppInputReplay::open(path);
+  ASSERT_FALSE(replay_or_error.has_value());
+  ASSERT_EQ(replay_or_error.error(), AppInputError::kInvalidHeader);
+}
+
+TEST(AppInput, RoundTrip)
+{
+  const auto path = tempPath("sde_app_input_round_trip.bin");
+
+  std::vector<Frame> recorded;
+  std::vector<Clock::time_point> recorded_times;
+  {
+    auto recorder_or_error = AppInputRecorder::create(path);
+    ASSERT_TRUE(recorder_or_error.has_value());
+
+    AppProperties app_properties;
+    auto t_frame = Clock::now();
+    for (std::size_t i = 0; i < 64; ++i)
+    {
+      t_frame += std::chrono::nanoseconds{16'666'667 + static_cast<int>(i)};
+      const auto prev_down = app_properties.keys.down;
+      app_properties.keys.down.set(i % kKeyCount, !app_properties.keys.down[i % kKeyCount]);
+      app_properties.keys.pressed = app_properties.keys.down & ~prev_down;
+      app_properties.keys.released = prev_down & ~app_properties.keys.down;
+      app_properties.mouse_position_px = {1.0 / 3.0 * static_cast<double>(i), -0.1 * static_cast<double>(i)};
+      app_properties.mouse_scroll = {0.0, (i % 2) ? 0.0 : 1.0};
+      app_properties.viewport_size = {640 + static_cast<int>(i / 16), 480};
+      app_properties.drag_and_drop_payloads.clear();
+      if ((i % 10) == 0)
+      {
+        app_properties.drag_and_drop_payloads.push_back({{1.0, 2.0}, "dropped/" + std::to_string(i) + ".png"});
+      }
+      ASSERT_TRUE(recorder_or_error->record(app_properties, t_frame).has_value());
+      recorded.push_back(Frame::capture(app_properties));
+      recorded_times.push_back(t_frame);
+    }
+  }
+
+  auto replay_or_error = AppInputReplay::open(path);
+  ASSERT_TRUE(replay_or_error.has_value());
+
+  AppProperties app_properties;
+  for (std::size_t i = 0; i < recorded.size(); ++i)
+  {
+    ASSERT_TRUE(replay_or_error->next(app_properties).has_value()) << "frame " << i;
+    ASSERT_EQ(Frame::capture(app_properties), recorded[i]) << "frame " << i;
+    ASSERT_EQ(replay_or_error->time() - Clock::time_point{}, recorded_times[i] - recorded_times.front());
+  }
+
+  const auto end_or_error = replay_or_error->next(app_properties);
+  ASSERT_FALSE(end_or_error.has_value());
+  ASSERT_EQ(end_or_error.error(), AppInputError::kEndOfRecording);
+  ASSERT_EQ(replay_or_error->frames(), recorded.size());
+}
+
+TEST(AppInput, FramesWithoutNewInputAreCompact)
+{
+  static constexpr std::size_t kFrameCount = 1000;
+  const auto path = tempPath("sde_app_input_compact.bin");
+  {
+    auto recorder_or_error = AppInputRecorder::create(path);
+    ASSERT_TRUE(recorder_or_error.has_value());
+
+    AppProperties app_properties;
+    auto t_frame = Clock::now();
+    for (std::size_t i = 0; i < kFrameCount; ++i)
+    {
+      t_frame += Hertz(60.0).period();
+      ASSERT_TRUE(recorder_or_error->record(app_properties, t_frame).has_value());
+    }
+  }
+
+  // A byte of flags, and a frame time of 4 bytes or less
+  ASSERT_LE(asset::file_size(path), sizeof(AppInputHeader) + kFrameCount * 5 + sizeof(Vec2i));
+}
+
+TEST(AppInput, FlushReportsWriteFailure)
+{
+  if (!asset::exists("/dev/full"))
+  {
+    GTEST_SKIP() << "/dev/full not available";
+  }
+  auto recorder_or_error = AppInputRecorder::create("/dev/full");
+  ASSERT_TRUE(recorder_or_error.has_value());
+  ASSERT_TRUE(recorder_or_error->record(AppProperties{}, Clock::now()).has_value());
+
+  const auto ok_or_error = recorder_or_error->flush();
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), AppInputError::kFileWriteFailed);
+}
+
+TEST(AppInput, TruncatedRecording)
+{
+  const auto path = tempPath("sde_app_input_truncated.bin");
+  recordSession(path);
+
+  const auto bytes = readFile(path);
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+  }
+
+  auto replay_or_error = AppInputReplay::open(path);
+  ASSERT_TRUE(replay_or_error.has_value());
+
+  AppProperties app_properties;
+  expected<void, AppInputError> ok_or_error;
+  while ((ok_or_error = replay_or_error->next(app_properties)).has_value())
+  {}
+  ASSERT_EQ(ok_or_error.error(), AppInputError::kInvalidFrame);
+}
+
+TEST(AppInput, HeadlessReplayEndsWithRecording)
+{
+  const auto path = tempPath("sde_app_input_session.bin");
+  const auto recorded_frames = recordSession(path);
+
+  const auto frames = replaySession(path);
+  ASSERT_EQ(frames.size(), recorded_frames);
+  ASSERT_EQ(frames[150].dropped_paths, (std::vector<std::string>{"assets/a.png", "assets/sounds/b.wav"}));
+  ASSERT_EQ(frames.back().viewport_size, Vec2i(1280, 720));
+}
+
+TEST(AppInput, HeadlessReplayIsBitIdentical)
+{
+  const auto path = tempPath("sde_app_input_session.bin");
+  recordSession(path);
+
+  const auto first = replaySession(path, tempPath("sde_app_input_rerecord_0.bin"));
+  const auto second = replaySession(path, tempPath("sde_app_input_rerecord_1.bin"));
+  ASSERT_FALSE(first.empty());
+  ASSERT_EQ(first.size(), second.size());
+  for (std::size_t i = 0; i < first.size(); ++i)
+  {
+    ASSERT_EQ(first[i], second[i]) << "frame " << i;
+  }
+
+  // Input recorded while replaying is byte-for-byte the original recording
+  const auto original = readFile(path);
+  ASSERT_EQ(readFile(tempPath("sde_app_input_rerecord_0.bin")), original);
+  ASSERT_EQ(readFile(tempPath("sde_app_input_rerecord_1.bin")), original);
+}
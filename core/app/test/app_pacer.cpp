@@ -0,0 +1,223 @@
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/app_pacer.hpp"
+
+using namespace sde;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/// Manually advanced time source, with sleeps which overshoot like an OS sleep
+struct FakeClock
+{
+  Clock::time_point now = Clock::time_point{} + 1h;
+  /// Added to every sleep
+  TimeOffset sleep_overshoot = 2ms;
+  /// Time which passes on every yield
+  TimeOffset yield_duration = 10us;
+  /// Number of sleeps
+  std::size_t sleeps = 0;
+  /// Number of yields
+  std::size_t yields = 0;
+
+  AppPacer::clock_type clock()
+  {
+    return [this] { return now; };
+  }
+
+  AppPacer::sleep_type sleep()
+  {
+    return [this](TimeOffset duration) {
+      ++sleeps;
+      now += duration + sleep_overshoot;
+    };
+  }
+
+  AppPacer::yield_type yield()
+  {
+    return [this] {
+      ++yields;
+      now += yield_duration;
+    };
+  }
+
+  AppPacer pacer(Rate rate, const AppPacerOptions& options = {})
+  {
+    return AppPacer{rate, options, clock(), sleep(), yield()};
+  }
+};
+
+}  // namespace
+
+TEST(FrameTimeHistogram, Empty)
+{
+  FrameTimeHistogram histogram;
+  const auto stats = histogram.stats();
+  ASSERT_EQ(stats.samples, 0UL);
+  ASSERT_EQ(stats.p50, 0ms);
+  ASSERT_EQ(stats.max, 0ms);
+}
+
+TEST(FrameTimeHistogram, Percentiles)
+{
+  FrameTimeHistogram histogram;
+
+  // 90 frames of 10ms, 8 of 20ms, and 2 of 30ms
+  for (int i = 0; i < 90; ++i)
+  {
+    histogram.record(10ms);
+  }
+  for (int i = 0; i < 8; ++i)
+  {
+    histogram.record(20ms);
+  }
+  histogram.record(30ms);
+  histogram.record(30ms);
+
+  const auto stats = histogram.stats();
+  ASSERT_EQ(stats.samples, 100UL);
+  ASSERT_EQ(stats.max, 30ms);
+  ASSERT_GE(stats.p50, 10ms);
+  ASSERT_LE(stats.p50, 10ms + kFrameTimeBucketWidth);
+  ASSERT_GE(stats.p95, 20ms);
+  ASSERT_LE(stats.p95, 20ms + kFrameTimeBucketWidth);
+  ASSERT_EQ(stats.p99, 30ms);
+}
+
+TEST(FrameTimeHistogram, LongFramesShareLastBucket)
+{
+  FrameTimeHistogram histogram;
+  histogram.record(5ms);
+  histogram.record(2s);
+
+  const auto stats = histogram.stats();
+  ASSERT_EQ(stats.max, 2s);
+  ASSERT_EQ(stats.p99, 2s);
+}
+
+TEST(FrameTimeHistogram, WindowDropsOldestFrames)
+{
+  FrameTimeHistogram histogram;
+  for (std::size_t i = 0; i < kFrameTimeWindow; ++i)
+  {
+    histogram.record(40ms);
+  }
+  for (std::size_t i = 0; i < kFrameTimeWindow; ++i)
+  {
+    histogram.record(5ms);
+  }
+
+  const auto stats = histogram.stats();
+  ASSERT_EQ(stats.samples, kFrameTimeWindow);
+  ASSERT_EQ(stats.max, 5ms);
+  ASSERT_EQ(stats.p99, 5ms);
+}
+
+TEST(AppPacer, MeasuresSleepOvershoot)
+{
+  FakeClock fake;
+  ASSERT_EQ(AppPacer::measureSleepOvershoot(5, 1ms, fake.clock(), fake.sleep()), 2ms);
+  ASSERT_EQ(fake.sleeps, 5UL);
+
+  // Spin threshold covers the measured overshoot
+  const auto pacer = fake.pacer(Hertz(60.0));
+  ASSERT_GT(pacer.spinThreshold(), 2ms);
+}
+
+TEST(AppPacer, SleepOvershootIgnoresOutliers)
+{
+  FakeClock fake;
+  const auto clock = fake.clock();
+  std::size_t sleeps = 0;
+  const auto sleep = [&fake, &sleeps](TimeOffset duration) {
+    // One sleep in ten is held up by 20ms
+    fake.now += duration + ((++sleeps % 10 == 0) ? 20ms : 1ms);
+  };
+  ASSERT_EQ(AppPacer::measureSleepOvershoot(10, 1ms, clock, sleep), 1ms);
+  ASSERT_EQ(AppPacer::measureSleepOvershoot(20, 1ms, clock, sleep), 1ms);
+}
+
+TEST(AppPacer, SpinThresholdLimitedByPeriod)
+{
+  FakeClock fake;
+  fake.sleep_overshoot = 20ms;
+  const auto pacer = fake.pacer(Rate{10ms});
+  ASSERT_EQ(pacer.spinThreshold(), 2500us);
+}
+
+TEST(AppPacer, WakesOnDeadlineDespiteSleepOvershoot)
+{
+  FakeClock fake;
+  auto pacer = fake.pacer(Rate{10ms});
+
+  const auto t_start = fake.now;
+  for (int frame = 1; frame <= 100; ++frame)
+  {
+    const auto deadline = t_start + frame * 10ms;
+    fake.now += 3ms;  // simulated frame work
+    pacer.wait();
+    ASSERT_GE(fake.now, deadline);
+    ASSERT_LT(fake.now, deadline + fake.yield_duration) << "frame " << frame;
+  }
+
+  const auto stats = pacer.frameTimes().stats();
+  ASSERT_EQ(stats.samples, 100UL);
+  ASSERT_LE(stats.max, 10ms + fake.yield_duration);
+  ASSERT_EQ(pacer.missed(), 0UL);
+}
+
+TEST(AppPacer, SleepOnlyOvershoots)
+{
+  // Without a spin threshold, every frame wakes late by the full sleep overshoot
+  FakeClock fake;
+  auto pacer = fake.pacer(Rate{10ms}, {.spin_threshold = 1ns});
+
+  const auto t_start = fake.now;
+  for (int frame = 1; frame <= 100; ++frame)
+  {
+    const auto deadline = t_start + frame * 10ms;
+    fake.now += 3ms;
+    pacer.wait();
+    ASSERT_GE(fake.now, deadline + 1ms);
+  }
+}
+
+TEST(AppPacer, MissedDeadlinesAreCountedAndNotChased)
+{
+  FakeClock fake;
+  auto pacer = fake.pacer(Rate{10ms}, {.spin_threshold = 3ms});
+
+  // Stall for several frames; the following frames are paced from the end of the stall rather than rushed to catch up
+  fake.now += 45ms;
+  pacer.wait();
+  ASSERT_EQ(pacer.missed(), 1UL);
+
+  const auto t_resume = fake.now;
+  fake.now += 1ms;
+  pacer.wait();
+  ASSERT_GE(fake.now, t_resume + 10ms);
+  ASSERT_EQ(pacer.missed(), 1UL);
+
+  const auto stats = pacer.frameTimes().stats();
+  ASSERT_EQ(stats.samples, 2UL);
+  ASSERT_EQ(stats.max, 45ms);
+}
+
+TEST(AppPacer, ResetClearsStatistics)
+{
+  FakeClock fake;
+  auto pacer = fake.pacer(Rate{10ms}, {.spin_threshold = 3ms});
+  fake.now += 50ms;
+  pacer.wait();
+
+  pacer.reset();
+  ASSERT_EQ(pacer.frameTimes().stats().samples, 0UL);
+  ASSERT_EQ(pacer.missed(), 0UL);
+}
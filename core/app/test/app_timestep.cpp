@@ -0,0 +1,202 @@
+// C++ Standard Library
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/app_timestep.hpp"
+
+using namespace sde;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+/// Manually advanced time source
+struct FakeClock
+{
+  Clock::time_point now = Clock::time_point{} + 1h;
+
+  AppTimestep::clock_type source()
+  {
+    return [this] { return now; };
+  }
+};
+
+/// Integrates constant velocity over each step, as red physics does
+struct Body
+{
+  double position = 0.0;
+  double velocity = 3.0;
+
+  void step(TimeOffset dt) { position += velocity * toSeconds<double>(dt); }
+};
+
+}  // namespace
+
+TEST(AppTimestep, VariableSimulatesOneStepOfFrameTime)
+{
+  FakeClock clock;
+  AppTimestep timestep{{}, clock.source()};
+  ASSERT_FALSE(timestep.fixed());
+
+  clock.now += 7ms;
+  ASSERT_EQ(timestep.update(), 1UL);
+  ASSERT_EQ(timestep.stepDelta(), 7ms);
+  ASSERT_EQ(timestep.timeDelta(), 7ms);
+  ASSERT_EQ(timestep.alpha(), 0.F);
+
+  clock.now += 250ms;
+  ASSERT_EQ(timestep.update(), 1UL);
+  ASSERT_EQ(timestep.stepDelta(), 250ms);
+  ASSERT_EQ(timestep.time(), 257ms);
+  ASSERT_EQ(timestep.simulationTime(), 257ms);
+  ASSERT_EQ(timestep.dropped(), 0ms);
+}
+
+TEST(AppTimestep, FixedAccumulatesPartialSteps)
+{
+  FakeClock clock;
+  AppTimestep timestep{{.step = 10ms, .max_steps = 5}, clock.source()};
+  ASSERT_TRUE(timestep.fixed());
+
+  clock.now += 4ms;
+  ASSERT_EQ(timestep.update(), 0UL);
+  ASSERT_FLOAT_EQ(timestep.alpha(), 0.4F);
+
+  clock.now += 4ms;
+  ASSERT_EQ(timestep.update(), 0UL);
+  ASSERT_FLOAT_EQ(timestep.alpha(), 0.8F);
+
+  clock.now += 4ms;
+  ASSERT_EQ(timestep.update(), 1UL);
+  ASSERT_EQ(timestep.stepDelta(), 10ms);
+  ASSERT_FLOAT_EQ(timestep.alpha(), 0.2F);
+
+  clock.now += 25ms;
+  ASSERT_EQ(timestep.update(), 2UL);
+  ASSERT_FLOAT_EQ(timestep.alpha(), 0.7F);
+
+  ASSERT_EQ(timestep.time(), 37ms);
+  ASSERT_EQ(timestep.simulationTime(), 30ms);
+}
+
+TEST(AppTimestep, StallIsLimitedToMaxSteps)
+{
+  FakeClock clock;
+  AppTimestep timestep{{.step = 10ms, .max_steps = 4}, clock.source()};
+
+  clock.now += 5ms;
+  ASSERT_EQ(timestep.update(), 0UL);
+
+  // Stall for a second; only four steps are caught up, and the rest of the backlog is dropped
+  clock.now += 1s;
+  ASSERT_EQ(timestep.update(), 4UL);
+  ASSERT_EQ(timestep.dropped(), 960ms);
+  ASSERT_FLOAT_EQ(timestep.alpha(), 0.5F);
+
+  // Simulation then resumes at the normal pace
+  clock.now += 10ms;
+  ASSERT_EQ(timestep.update(), 1UL);
+  ASSERT_EQ(timestep.simulationTime(), 50ms);
+  ASSERT_EQ(timestep.time() - timestep.dropped(), 55ms);
+}
+
+TEST(AppTimestep, AlphaStaysBelowOne)
+{
+  FakeClock clock;
+  AppTimestep timestep{{.step = Hertz(60.0).period(), .max_steps = 5}, clock.source()};
+
+  clock.now += Hertz(60.0).period() - 1ns;
+  ASSERT_EQ(timestep.update(), 0UL);
+  ASSERT_LT(timestep.alpha(), 1.F);
+  ASSERT_GT(timestep.alpha(), 0.99F);
+}
+
+TEST(AppTimestep, ResetDiscardsAccumulatedTime)
+{
+  FakeClock clock;
+  AppTimestep timestep{{.step = 10ms, .max_steps = 5}, clock.source()};
+
+  clock.now += 1s;
+  timestep.update();
+  clock.now += 9ms;
+  timestep.update();
+  ASSERT_GT(timestep.dropped(), 0ms);
+
+  timestep.reset();
+  ASSERT_EQ(timestep.time(), 0ms);
+  ASSERT_EQ(timestep.simulationTime(), 0ms);
+  ASSERT_EQ(timestep.dropped(), 0ms);
+  ASSERT_EQ(timestep.alpha(), 0.F);
+
+  clock.now += 9ms;
+  ASSERT_EQ(timestep.update(), 0UL);
+}
+
+TEST(AppTimestep, FixedSimulationIsFrameRateIndependent)
+{
+  // Frame times of each run, in milliseconds, including occasional stalls shorter than the catch-up limit
+  const std::vector<std::vector<int>> frame_patterns = {
+    {16},
+    {7},
+    {33},
+    {5, 40, 11, 3},
+    {16, 16, 45, 16},
+  };
+
+  static constexpr std::size_t kTargetSteps = 240;
+
+  std::vector<double> final_positions;
+  for (const auto& pattern : frame_patterns)
+  {
+    FakeClock clock;
+    AppTimestep timestep{{.step = 5ms, .max_steps = 10}, clock.source()};
+    Body body;
+
+    // Stop exactly on the target step, so that runs are compared at the same simulated time
+    std::size_t total_steps = 0;
+    for (std::size_t frame = 0; total_steps < kTargetSteps; ++frame)
+    {
+      clock.now += std::chrono::milliseconds{pattern[frame % pattern.size()]};
+      timestep.update();
+      ASSERT_LT(timestep.alpha(), 1.F);
+      ASSERT_GE(timestep.alpha(), 0.F);
+      for (std::size_t i = 0; (i < timestep.steps()) and (total_steps < kTargetSteps); ++i, ++total_steps)
+      {
+        body.step(timestep.stepDelta());
+      }
+    }
+
+    ASSERT_EQ(timestep.dropped(), 0ms);
+    final_positions.push_back(body.position);
+  }
+
+  for (const double position : final_positions)
+  {
+    ASSERT_EQ(position, final_positions.front());
+  }
+}
+
+TEST(AppTimestep, Deterministic)
+{
+  // Identical clock readings produce identical steps, including through a stall
+  const auto run = [] {
+    FakeClock clock;
+    AppTimestep timestep{{.step = Hertz(120.0).period(), .max_steps = 3}, clock.source()};
+    std::vector<std::size_t> steps;
+    std::vector<float> alphas;
+    for (int frame = 0; frame < 500; ++frame)
+    {
+      clock.now += (frame == 250) ? std::chrono::nanoseconds{400ms} : std::chrono::nanoseconds{(frame % 7) * 3ms};
+      steps.push_back(timestep.update());
+      alphas.push_back(timestep.alpha());
+    }
+    return std::make_pair(steps, alphas);
+  };
+  ASSERT_EQ(run(), run());
+}
@@ -7,15 +7,21 @@
 
 // C++ Standard Library
 #include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
 
 // SDE
 #include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
 #include "sde/audio/sound_channel_format.hpp"
 #include "sde/audio/sound_data_fwd.hpp"
 #include "sde/audio/sound_data_handle.hpp"
+#include "sde/cooked_asset.hpp"
 #include "sde/expected.hpp"
 #include "sde/resource.hpp"
 #include "sde/resource_cache.hpp"
+#include "sde/resource_content.hpp"
 #include "sde/unique_resource.hpp"
 #include "sde/unordered_map.hpp"
 #include "sde/view.hpp"
@@ -31,12 +37,16 @@ enum class SoundDataError
   kSoundDataNotFound,
   kMissingSoundFile,
   kInvalidSoundFile,
+  kAssetCookFailed,
 };
 
 std::ostream& operator<<(std::ostream& os, SoundDataError count);
 
 struct SoundDataBufferDeleter
 {
+  /// Shared owner of sound samples, if samples are aliased between sounds with identical content
+  std::shared_ptr<void> shared = nullptr;
+
   void operator()(void* data) const;
 };
 
@@ -85,10 +95,58 @@ public:
   using fundemental_type::to_handle;
   SoundDataHandle to_handle(const asset::path& path) const;
 
+  /**
+   * @brief Enables sharing of sound samples between sounds with identical file contents
+   */
+  void set_content_aliasing(bool enabled) { content_index_.enable(enabled); }
+
+  /**
+   * @brief Returns statistics about shared sound samples
+   */
+  const ResourceContentStats& content_stats() const { return content_index_.stats(); }
+
+  /**
+   * @brief Reads sound files through \p file_system instead of directly from disk
+   */
+  void set_file_system(std::shared_ptr<const AssetFileSystem> file_system) { file_system_ = std::move(file_system); }
+
+  /**
+   * @brief Uses PCM samples which were extracted ahead of time from \p cooked_assets , when available
+   */
+  void set_cooked_assets(std::shared_ptr<const CookedAssetStore> cooked_assets)
+  {
+    cooked_assets_ = std::move(cooked_assets);
+  }
+
+  /**
+   * @brief Extracts PCM samples from sound file at \p sound_path and writes them to \p cooked_assets
+   */
+  static expected<void, SoundDataError> cook(const CookedAssetStore& cooked_assets, const asset::path& sound_path);
+
 private:
-  sde::unordered_map<asset::path, SoundDataHandle> path_to_sound_data_handle_;
+  struct SoundDataContentInfo
+  {
+    std::size_t buffer_length;
+    SoundChannelFormat buffer_channel_format;
+  };
 
-  static expected<void, SoundDataError> reload(dependencies deps, SoundData& sound);
+  sde::unordered_map<asset::path, SoundDataHandle> path_to_sound_data_handle_;
+  ResourceContentIndex<SoundDataContentInfo> content_index_;
+  std::shared_ptr<const AssetFileSystem> file_system_;
+  std::shared_ptr<const CookedAssetStore> cooked_assets_;
+
+  expected<void, SoundDataError> reload(dependencies deps, SoundData& sound);
+  expected<void, SoundDataError> reload_from_memory(
+    SoundData& sound,
+    AssetData encoded,
+    const std::optional<Hash>& content_key,
+    Clock::time_point decode_start);
+  void set_samples(
+    SoundData& sound,
+    std::span<const std::byte> samples,
+    std::shared_ptr<const void> owner,
+    const std::optional<Hash>& content_key,
+    Clock::time_point decode_start);
   static expected<void, SoundDataError> unload(dependencies deps, SoundData& sound);
 
   expected<SoundData, SoundDataError> generate(dependencies deps, const asset::path& sound_path);
@@ -1,6 +1,9 @@
 // C++ Standard Library
+#include <cstring>
 #include <optional>
 #include <ostream>
+#include <span>
+#include <string_view>
 
 // LibAudio
 #include <audio/wave.h>
@@ -38,6 +41,92 @@ std::optional<SoundChannelBitDepth> toSoundChannelBitDepth(std::uint32_t bits_pe
   return std::nullopt;
 }
 
+/**
+ * @brief PCM format and samples of a WAV file held in memory
+ */
+struct WaveView
+{
+  std::uint16_t channels = 0;
+  std::uint32_t sample_rate = 0;
+  std::uint16_t bits_per_sample = 0;
+  std::span<const std::byte> samples = {};
+};
+
+template <typename T> T readLittleEndian(const std::byte* ptr)
+{
+  T value;
+  std::memcpy(&value, ptr, sizeof(T));
+  return value;
+}
+
+bool isChunkTag(const std::byte* ptr, std::string_view tag) { return std::memcmp(ptr, tag.data(), 4) == 0; }
+
+/**
+ * @brief Finds PCM format and samples of a RIFF/WAV file without copying samples
+ */
+std::optional<WaveView> toWaveView(std::span<const std::byte> bytes)
+{
+  static constexpr std::size_t kRiffHeaderLength = 12;
+  static constexpr std::size_t kChunkHeaderLength = 8;
+  static constexpr std::size_t kFormatChunkLength = 16;
+  static constexpr std::uint16_t kPCMFormat = 1;
+
+  if (
+    (bytes.size() < kRiffHeaderLength) or !isChunkTag(bytes.data(), "RIFF") or !isChunkTag(bytes.data() + 8, "WAVE"))
+  {
+    return std::nullopt;
+  }
+
+  std::optional<WaveView> wave;
+  std::size_t offset = kRiffHeaderLength;
+  while ((offset + kChunkHeaderLength) <= bytes.size())
+  {
+    const auto* chunk = bytes.data() + offset;
+    const std::size_t body_offset = offset + kChunkHeaderLength;
+    const std::size_t body_length = readLittleEndian<std::uint32_t>(chunk + 4);
+    if (body_length > (bytes.size() - body_offset))
+    {
+      return std::nullopt;
+    }
+
+    const auto* body = bytes.data() + body_offset;
+    if (isChunkTag(chunk, "fmt "))
+    {
+      if ((body_length < kFormatChunkLength) or (readLittleEndian<std::uint16_t>(body) != kPCMFormat))
+      {
+        return std::nullopt;
+      }
+      wave.emplace();
+      wave->channels = readLittleEndian<std::uint16_t>(body + 2);
+      wave->sample_rate = readLittleEndian<std::uint32_t>(body + 4);
+      wave->bits_per_sample = readLittleEndian<std::uint16_t>(body + 14);
+    }
+    else if (isChunkTag(chunk, "data"))
+    {
+      // Format chunk must precede sample data
+      if (wave.has_value())
+      {
+        wave->samples = bytes.subspan(body_offset, body_length);
+      }
+      return wave;
+    }
+
+    // Chunks are padded to an even number of bytes
+    offset = body_offset + body_length + (body_length & 1UL);
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Cooked sound meta-information
+ */
+struct CookedSoundInfo
+{
+  std::uint32_t channels;
+  std::uint32_t bits_per_sample;
+  std::uint64_t sample_rate;
+};
+
 }  // namespace
 
 std::ostream& operator<<(std::ostream& os, SoundDataError count)
@@ -49,12 +138,20 @@ std::ostream& operator<<(std::ostream& os, SoundDataError count)
     SDE_OS_ENUM_CASE(SoundDataError::kSoundDataNotFound)
     SDE_OS_ENUM_CASE(SoundDataError::kMissingSoundFile)
     SDE_OS_ENUM_CASE(SoundDataError::kInvalidSoundFile)
+    SDE_OS_ENUM_CASE(SoundDataError::kAssetCookFailed)
   }
   // clang-format on
   return os;
 }
 
-void SoundDataBufferDeleter::operator()(void* data) const { std::free(data); }
+void SoundDataBufferDeleter::operator()(void* data) const
+{
+  // Aliased samples are released when their last shared owner is destroyed
+  if (shared == nullptr)
+  {
+    std::free(data);
+  }
+}
 
 SoundDataHandle SoundDataCache::to_handle(const asset::path& path) const
 {
@@ -85,13 +182,76 @@ expected<void, SoundDataError> SoundDataCache::unload([[maybe_unused]] dependenc
 
 expected<void, SoundDataError> SoundDataCache::reload([[maybe_unused]] dependencies deps, SoundData& sound)
 {
+  // Read sound file through file system, if set
+  std::optional<AssetData> encoded;
+  if (file_system_ != nullptr)
+  {
+    auto data_or_error = file_system_->read(sound.path);
+    if (!data_or_error.has_value())
+    {
+      SDE_LOG_ERROR() << "MissingSoundFile: " << SDE_OSNV(sound.path) << " (" << data_or_error.error() << ')';
+      return make_unexpected(SoundDataError::kMissingSoundFile);
+    }
+    encoded = std::move(data_or_error).value();
+  }
   // Check that sound file exists
-  if (!asset::exists(sound.path))
+  else if (!asset::exists(sound.path))
   {
     SDE_LOG_ERROR() << "MissingSoundFile: " << SDE_OSNV(sound.path);
     return make_unexpected(SoundDataError::kMissingSoundFile);
   }
 
+  // Key sound content by file contents for aliasing and cooked lookup
+  std::optional<Hash> content_key;
+  if (content_index_.enabled() or (cooked_assets_ != nullptr))
+  {
+    content_key = encoded.has_value()
+      ? std::optional<Hash>{ComputeContentHash(encoded->bytes.data(), encoded->bytes.size())}
+      : ComputeContentHash(sound.path);
+  }
+
+  // Check if identical sound content was already loaded
+  if (content_key.has_value() and content_index_.enabled())
+  {
+    if (auto content = content_index_.find(*content_key); content.has_value())
+    {
+      SDE_LOG_DEBUG() << "Aliased sound: " << SDE_OSNV(sound.path) << ", " << SDE_OSNV(content->info.buffer_length);
+      sound.buffered_samples = SoundDataBuffer{content->data.get(), SoundDataBufferDeleter{std::move(content->data)}};
+      sound.buffer_length = content->info.buffer_length;
+      sound.buffer_channel_format = content->info.buffer_channel_format;
+      return {};
+    }
+  }
+
+  const auto decode_start = Clock::now();
+
+  // Use PCM samples which were extracted ahead of time, if available
+  if (content_key.has_value() and (cooked_assets_ != nullptr))
+  {
+    if (auto cooked = cooked_assets_->find<CookedSoundInfo>(*content_key); cooked.has_value())
+    {
+      const auto channel_count_opt = toSoundChannelCount(cooked->info.channels);
+      const auto channel_element_type_opt = toSoundChannelBitDepth(cooked->info.bits_per_sample);
+      if (channel_count_opt.has_value() and channel_element_type_opt.has_value())
+      {
+        sound.buffer_length = cooked->payload.size();
+        sound.buffer_channel_format = {
+          .count = (*channel_count_opt),
+          .element_type = (*channel_element_type_opt),
+          .bits_per_second = static_cast<std::size_t>(cooked->info.sample_rate)};
+        set_samples(sound, cooked->payload, std::move(cooked->owner), content_key, decode_start);
+        SDE_LOG_DEBUG() << "Loaded cooked sound: " << SDE_OSNV(sound.path) << ", " << SDE_OSNV(sound.buffer_length);
+        return {};
+      }
+      SDE_LOG_WARN() << "Ignoring invalid cooked sound: " << SDE_OSNV(sound.path);
+    }
+  }
+
+  if (encoded.has_value())
+  {
+    return reload_from_memory(sound, std::move(encoded).value(), content_key, decode_start);
+  }
+
   // Read WAV meta information
   auto wave =
     UniqueResource{WaveOpenFileForReading(sound.path.c_str()), [](WaveInfo* wave_ptr) { WaveCloseFile(wave_ptr); }};
@@ -132,17 +292,125 @@ expected<void, SoundDataError> SoundDataCache::reload([[maybe_unused]] dependenc
     return make_unexpected(SoundDataError::kInvalidSoundFile);
   }
 
-  sound.buffered_samples = SoundDataBuffer{wave_data};
   sound.buffer_length = static_cast<std::size_t>(wave->dataSize);
   sound.buffer_channel_format = {
     .count = std::move(channel_count_opt).value(),
     .element_type = std::move(channel_element_type_opt).value(),
     .bits_per_second = static_cast<std::size_t>(wave->sampleRate)};
 
+  // Share samples with subsequently loaded sounds with identical content
+  if (content_key.has_value() and content_index_.enabled())
+  {
+    std::shared_ptr<void> shared{wave_data, SoundDataBufferDeleter{}};
+    sound.buffered_samples = SoundDataBuffer{wave_data, SoundDataBufferDeleter{shared}};
+    content_index_.insert(
+      *content_key,
+      {.data = std::move(shared),
+       .info = {.buffer_length = sound.buffer_length, .buffer_channel_format = sound.buffer_channel_format}},
+      sound.buffer_length,
+      Clock::now() - decode_start);
+  }
+  else
+  {
+    sound.buffered_samples = SoundDataBuffer{wave_data};
+  }
+
   SDE_LOG_DEBUG() << "Loaded sound from file: " << SDE_OSNV(sound.path) << ", " << SDE_OSNV(sound.buffer_length);
   return {};
 }
 
+expected<void, SoundDataError> SoundDataCache::reload_from_memory(
+  SoundData& sound,
+  AssetData encoded,
+  const std::optional<Hash>& content_key,
+  Clock::time_point decode_start)
+{
+  const auto wave = toWaveView(encoded.bytes);
+  if (!wave.has_value())
+  {
+    SDE_LOG_ERROR() << "InvalidSoundFile: " << SDE_OSNV(sound.path);
+    return make_unexpected(SoundDataError::kInvalidSoundFile);
+  }
+
+  auto channel_count_opt = toSoundChannelCount(wave->channels);
+  if (!channel_count_opt.has_value())
+  {
+    SDE_LOG_ERROR() << "InvalidSoundFile: " << SDE_OSNV(sound.path) << " (" << SDE_OSNV(wave->channels) << ')';
+    return make_unexpected(SoundDataError::kInvalidSoundFile);
+  }
+
+  auto channel_element_type_opt = toSoundChannelBitDepth(wave->bits_per_sample);
+  if (!channel_element_type_opt.has_value())
+  {
+    SDE_LOG_ERROR() << "InvalidSoundFile: " << SDE_OSNV(sound.path) << " (" << SDE_OSNV(wave->bits_per_sample) << ')';
+    return make_unexpected(SoundDataError::kInvalidSoundFile);
+  }
+
+  sound.buffer_length = wave->samples.size();
+  sound.buffer_channel_format = {
+    .count = std::move(channel_count_opt).value(),
+    .element_type = std::move(channel_element_type_opt).value(),
+    .bits_per_second = static_cast<std::size_t>(wave->sample_rate)};
+
+  set_samples(sound, wave->samples, std::move(encoded.owner), content_key, decode_start);
+
+  SDE_LOG_DEBUG() << "Loaded sound from file system: " << SDE_OSNV(sound.path) << ", " << SDE_OSNV(sound.buffer_length);
+  return {};
+}
+
+void SoundDataCache::set_samples(
+  SoundData& sound,
+  std::span<const std::byte> samples,
+  std::shared_ptr<const void> owner,
+  const std::optional<Hash>& content_key,
+  Clock::time_point decode_start)
+{
+  // PCM samples are used in place; the shared owner keeps the underlying file bytes alive
+  auto* samples_ptr = const_cast<std::byte*>(samples.data());
+  std::shared_ptr<void> shared{std::const_pointer_cast<void>(std::move(owner)), samples_ptr};
+  sound.buffered_samples = SoundDataBuffer{samples_ptr, SoundDataBufferDeleter{shared}};
+
+  // Share samples with subsequently loaded sounds with identical content
+  if (content_key.has_value() and content_index_.enabled())
+  {
+    content_index_.insert(
+      *content_key,
+      {.data = std::move(shared),
+       .info = {.buffer_length = sound.buffer_length, .buffer_channel_format = sound.buffer_channel_format}},
+      sound.buffer_length,
+      Clock::now() - decode_start);
+  }
+}
+
+expected<void, SoundDataError> SoundDataCache::cook(const CookedAssetStore& cooked_assets, const asset::path& sound_path)
+{
+  const auto encoded_or_error = AssetFileSystem{}.read(sound_path);
+  if (!encoded_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << "MissingSoundFile: " << SDE_OSNV(sound_path) << " (" << encoded_or_error.error() << ')';
+    return make_unexpected(SoundDataError::kMissingSoundFile);
+  }
+
+  const auto wave = toWaveView(encoded_or_error->bytes);
+  if (
+    !wave.has_value() or !toSoundChannelCount(wave->channels).has_value() or
+    !toSoundChannelBitDepth(wave->bits_per_sample).has_value())
+  {
+    SDE_LOG_ERROR() << "InvalidSoundFile: " << SDE_OSNV(sound_path);
+    return make_unexpected(SoundDataError::kInvalidSoundFile);
+  }
+
+  const auto key = ComputeContentHash(encoded_or_error->bytes.data(), encoded_or_error->bytes.size());
+  const CookedSoundInfo info{
+    .channels = wave->channels, .bits_per_sample = wave->bits_per_sample, .sample_rate = wave->sample_rate};
+  if (auto ok_or_error = cooked_assets.write(key, info, wave->samples); !ok_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << "AssetCookFailed: " << SDE_OSNV(sound_path) << " (" << ok_or_error.error() << ')';
+    return make_unexpected(SoundDataError::kAssetCookFailed);
+  }
+  return {};
+}
+
 expected<SoundData, SoundDataError> SoundDataCache::generate(dependencies deps, const asset::path& sound_path)
 {
   SoundData sound{
@@ -0,0 +1,82 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file asset_file_system.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/asset_pack.hpp"
+#include "sde/expected.hpp"
+#include "sde/vector.hpp"
+
+namespace sde
+{
+
+/**
+ * @brief Bytes of an asset read through an AssetFileSystem
+ */
+struct AssetData
+{
+  /// Asset bytes
+  std::span<const std::byte> bytes;
+  /// Keeps asset bytes valid; may be shared with other assets read from the same pack
+  std::shared_ptr<const void> owner;
+};
+
+/**
+ * @brief Resolves asset paths to asset bytes from mounted asset packs, falling back to loose files
+ *
+ *        Each pack is mounted at a root directory. A path under that root is looked up in the pack by its path
+ *        relative to the root; packs mounted later take precedence. Paths which are not found in any pack are read
+ *        from a memory mapping of the loose file at that path.
+ */
+class AssetFileSystem
+{
+public:
+  /**
+   * @brief Mounts \p pack at \p root ; an empty root looks up paths in the pack as given
+   */
+  void mount(std::shared_ptr<const AssetPack> pack, const asset::path& root = {});
+
+  /**
+   * @brief Returns true if \p path is stored in a mounted pack, or exists as a loose file
+   */
+  [[nodiscard]] bool exists(const asset::path& path) const;
+
+  /**
+   * @brief Returns true if \p path is stored in a mounted pack
+   */
+  [[nodiscard]] bool packed(const asset::path& path) const { return find_packed(path).has_value(); }
+
+  /**
+   * @brief Returns all bytes of the asset at \p path
+   */
+  [[nodiscard]] expected<AssetData, AssetPackError> read(const asset::path& path) const;
+
+  /**
+   * @brief Returns the number of mounted packs
+   */
+  [[nodiscard]] std::size_t mount_count() const { return mounts_.size(); }
+
+private:
+  struct mount_point
+  {
+    asset::path root;
+    std::shared_ptr<const AssetPack> pack;
+  };
+
+  [[nodiscard]] std::optional<AssetData> find_packed(const asset::path& path) const;
+
+  /// Mounted packs, in mount order
+  sde::vector<mount_point> mounts_;
+};
+
+}  // namespace sde
@@ -0,0 +1,202 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file asset_pack.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/serialization_binary_file.hpp"
+#include "sde/string.hpp"
+#include "sde/vector.hpp"
+
+namespace sde
+{
+
+enum class AssetPackError
+{
+  kFileDoesNotExist,
+  kFileOpenFailed,
+  kFileWriteFailed,
+  kInvalidHeader,
+  kInvalidTable,
+  kInvalidDirectory,
+  kInvalidPath,
+  kDuplicatePath,
+};
+
+std::ostream& operator<<(std::ostream& os, AssetPackError error);
+
+/**
+ * @brief Returns the key used to look up \p path in an asset pack
+ *
+ *        Keys are lexically normalized, '/' separated paths, so that equivalent spellings of the same relative path
+ *        resolve to the same asset on all platforms.
+ */
+sde::string AssetPackPathKey(const asset::path& path);
+
+/**
+ * @brief Returns the hash of an asset pack path key
+ */
+std::uint64_t AssetPackPathHash(std::string_view key);
+
+/**
+ * @brief Asset pack file header
+ */
+struct AssetPackHeader
+{
+  static constexpr std::size_t kMagic = 0x314B434150454453UL;  // "SDEPACK1"
+
+  std::size_t magic = kMagic;
+  /// Number of entries in the path table
+  std::size_t entry_count = 0;
+  /// Offset of the path table from the start of the file, in bytes
+  std::size_t table_offset = 0;
+};
+
+/**
+ * @brief Describes where a single asset lives in an asset pack
+ */
+struct AssetPackEntry
+{
+  /// Hash of the asset path key (see AssetPackPathHash)
+  std::uint64_t path_hash;
+  /// Offset of the asset path key from the start of the file, in bytes
+  std::size_t path_offset;
+  /// Length of the asset path key, in bytes
+  std::size_t path_length;
+  /// Offset of the asset data from the start of the file, in bytes
+  std::size_t data_offset;
+  /// Length of the asset data, in bytes
+  std::size_t data_length;
+
+  constexpr bool operator<(const AssetPackEntry& other) const { return path_hash < other.path_hash; }
+};
+
+/**
+ * @brief Writes assets to an asset pack file
+ *
+ *        An asset pack is laid out as an AssetPackHeader, followed by the raw bytes of each asset, each starting on a
+ *        kDataAlignment byte boundary, followed by all asset path keys, followed by a table of AssetPackEntry sorted
+ *        by path hash. Asset bytes are stored as-is, so they may be handed directly to decoders from a memory mapping
+ *        of the pack.
+ */
+class AssetPackWriter
+{
+public:
+  /// Alignment of asset data from the start of the file, in bytes
+  static constexpr std::size_t kDataAlignment = 64;
+
+  static expected<AssetPackWriter, AssetPackError> create(const asset::path& path);
+
+  /**
+   * @brief Adds \p data under \p pack_path
+   */
+  [[nodiscard]] expected<void, AssetPackError> add(const asset::path& pack_path, std::span<const std::byte> data);
+
+  /**
+   * @brief Adds the contents of the file at \p file_path under \p pack_path
+   */
+  [[nodiscard]] expected<void, AssetPackError> add_file(const asset::path& pack_path, const asset::path& file_path);
+
+  /**
+   * @brief Adds all regular files under \p directory , recursively, keyed by their path relative to \p directory
+   *
+   * @return number of files added
+   */
+  [[nodiscard]] expected<std::size_t, AssetPackError> add_directory(const asset::path& directory);
+
+  /**
+   * @brief Writes path table and header; must be called once all assets have been added
+   */
+  [[nodiscard]] expected<void, AssetPackError> finish();
+
+  AssetPackWriter(AssetPackWriter&&) = default;
+
+private:
+  explicit AssetPackWriter(serial::file_ostream&& stream);
+
+  /// Pads file with zeros up to the next multiple of \p alignment
+  [[nodiscard]] bool pad(std::size_t alignment);
+
+  /// Pack file
+  serial::file_ostream stream_;
+  /// Path keys of all added assets, in the order they were added
+  sde::vector<sde::string> keys_;
+  /// Entries of all added assets, in the order they were added
+  sde::vector<AssetPackEntry> table_;
+};
+
+/**
+ * @brief Read-only, memory-mapped view of an asset pack file
+ *
+ *        Only the path table is read when a pack is opened; asset bytes are returned as views into the mapping, which
+ *        remain valid for the lifetime of the pack.
+ */
+class AssetPack
+{
+public:
+  static expected<AssetPack, AssetPackError> open(const asset::path& path);
+
+  /**
+   * @brief Returns the bytes of the asset stored under \p path (relative to the packed directory)
+   */
+  [[nodiscard]] std::optional<std::span<const std::byte>> find(const asset::path& path) const;
+
+  /**
+   * @brief Returns true if an asset is stored under \p path (relative to the packed directory)
+   */
+  [[nodiscard]] bool contains(const asset::path& path) const { return find(path).has_value(); }
+
+  /**
+   * @brief Returns entries for all assets in the pack, sorted by path hash
+   */
+  [[nodiscard]] std::span<const AssetPackEntry> entries() const { return {table_.data(), table_.size()}; }
+
+  /**
+   * @brief Returns the path key of \p entry
+   */
+  [[nodiscard]] std::string_view key(const AssetPackEntry& entry) const;
+
+  /**
+   * @brief Returns the number of assets in the pack
+   */
+  [[nodiscard]] std::size_t size() const { return table_.size(); }
+
+  AssetPack(AssetPack&&) = default;
+  AssetPack& operator=(AssetPack&&) = default;
+
+private:
+  AssetPack(serial::mmap_istream&& stream, std::span<const std::byte> bytes, sde::vector<AssetPackEntry>&& table);
+
+  /// Mapped pack file
+  serial::mmap_istream stream_;
+  /// All bytes of the mapped pack file
+  std::span<const std::byte> bytes_;
+  /// Entries of all assets in the pack
+  sde::vector<AssetPackEntry> table_;
+};
+
+}  // namespace sde
+
+namespace sde::serial
+{
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, AssetPackHeader> : std::true_type
+{};
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, AssetPackEntry> : std::true_type
+{};
+
+}  // namespace sde::serial
@@ -0,0 +1,132 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file async_file_writer.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/serial/mem_buffer_pool.hpp"
+#include "sde/serial/mem_ostream.hpp"
+
+namespace sde
+{
+
+enum class AsyncFileWriterError
+{
+  kFileOpenFailed,
+  kFileWriteFailed,
+  kFileRenameFailed,
+  kFileSyncFailed,
+};
+
+std::ostream& operator<<(std::ostream& os, AsyncFileWriterError error);
+
+/**
+ * @brief Writes serialized buffers to files on a background thread
+ *
+ *        Data is serialized into a serial::mem_ostream by the caller and handed over with submit(), which does not
+ *        touch the file system. The writer thread writes each buffer to a temporary file next to its destination,
+ *        syncs it to disk, renames it over the destination, then syncs the destination directory. A destination file
+ *        always holds either its previous contents or the complete new contents, even if the process or system stops
+ *        part way through a write. Writes are applied in the order they were submitted.
+ */
+class AsyncFileWriter
+{
+public:
+  AsyncFileWriter();
+
+  /**
+   * @brief Finishes all pending writes before returning
+   */
+  ~AsyncFileWriter();
+
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  /**
+   * @brief Queues \p buffer to be written to \p path
+   */
+  void submit(asset::path path, serial::mem_ostream buffer);
+
+  /**
+   * @brief Blocks until there are no pending writes to \p path
+   */
+  void wait(const asset::path& path);
+
+  /**
+   * @brief Blocks until all pending writes are finished
+   *
+   * @return error from the most recent failed write since the last flush, if any
+   */
+  [[nodiscard]] expected<void, AsyncFileWriterError> flush();
+
+  /**
+   * @brief Returns the number of pending writes
+   */
+  [[nodiscard]] std::size_t pending() const;
+
+  /**
+   * @brief Returns a pool of buffers for streams to be submitted to this writer
+   *
+   *        Streams created from this pool hand their storage back to it once written, so that repeated saves of
+   *        similar size do not reallocate.
+   */
+  [[nodiscard]] serial::mem_buffer_pool& buffers() { return buffers_; }
+
+  /**
+   * @brief Returns the path of the temporary file written before renaming it to \p path
+   */
+  [[nodiscard]] static asset::path temporary_path(const asset::path& path);
+
+  /**
+   * @brief Writes \p len bytes at \p data to \p path , replacing its contents atomically
+   *
+   * @return AsyncFileWriterError::kFileSyncFailed if data could not be synced to disk; if only the directory could
+   *         not be synced, \p path already holds the new contents, but the replacement may not survive a crash
+   */
+  [[nodiscard]] static expected<void, AsyncFileWriterError>
+  write(const asset::path& path, const void* data, std::size_t len);
+
+private:
+  struct Job
+  {
+    asset::path path;
+    serial::mem_ostream buffer;
+  };
+
+  /**
+   * @brief Writer thread loop; runs until stopped and all jobs are finished
+   */
+  void run();
+
+  /// Storage recycled between submitted buffers; outlives all jobs
+  serial::mem_buffer_pool buffers_;
+  /// Protects all members below
+  mutable std::mutex mutex_;
+  /// Signaled when a job is submitted or the writer is stopped
+  std::condition_variable job_submitted_;
+  /// Signaled when a job is finished
+  std::condition_variable job_finished_;
+  /// Pending jobs; front job is being written while it remains in the queue
+  std::deque<Job> jobs_;
+  /// Set when the writer thread should exit after finishing pending jobs
+  bool stopped_ = false;
+  /// Most recent write error since last flush
+  std::optional<AsyncFileWriterError> error_;
+  /// Thread which performs all file IO
+  std::thread thread_;
+};
+
+}  // namespace sde
@@ -0,0 +1,153 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file cooked_asset.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstring>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
+#include "sde/expected.hpp"
+#include "sde/hash.hpp"
+#include "sde/serialization_binary_file.hpp"
+
+namespace sde
+{
+
+enum class CookedAssetError
+{
+  kFileOpenFailed,
+  kFileWriteFailed,
+};
+
+std::ostream& operator<<(std::ostream& os, CookedAssetError error);
+
+/**
+ * @brief Cooked asset file header
+ */
+struct CookedAssetHeader
+{
+  static constexpr std::size_t kMagic = 0x314B4F4F43454453UL;  // "SDECOOK1"
+
+  std::size_t magic = kMagic;
+  /// Key of the cooked asset, derived from source content hash and load options
+  Hash key = {};
+  /// Type hash of the cooked asset meta-information
+  std::size_t info_type = 0;
+  /// Length of the cooked asset meta-information, in bytes
+  std::size_t info_length = 0;
+  /// Offset of the payload from the start of the file, in bytes
+  std::size_t payload_offset = 0;
+  /// Length of the payload, in bytes
+  std::size_t payload_length = 0;
+};
+
+/**
+ * @brief Cooked asset read from a CookedAssetStore
+ *
+ * @tparam InfoT  trivially copyable meta-information needed to interpret payload
+ */
+template <typename InfoT> struct CookedAsset
+{
+  /// Payload meta-information
+  InfoT info;
+  /// Asset data ready to be used without decoding
+  std::span<const std::byte> payload;
+  /// Keeps payload bytes valid
+  std::shared_ptr<const void> owner;
+};
+
+/**
+ * @brief Directory of assets which were decoded ahead of time
+ *
+ *        Each cooked asset is stored in its own file, named after a key derived from the content hash of its source
+ *        asset and the options it was decoded with, so cooked assets are found without a manifest and go stale
+ *        automatically when their source changes. A cooked asset file is laid out as a CookedAssetHeader, followed by
+ *        meta-information, followed by payload bytes starting on a kPayloadAlignment byte boundary. Files are read in
+ *        a single read through an AssetFileSystem, so cooked directories may also be packed.
+ */
+class CookedAssetStore
+{
+public:
+  /// Alignment of payload from the start of a cooked asset file, in bytes
+  static constexpr std::size_t kPayloadAlignment = 64;
+
+  explicit CookedAssetStore(asset::path directory, std::shared_ptr<const AssetFileSystem> file_system = nullptr);
+
+  /**
+   * @brief Returns the directory which holds cooked assets
+   */
+  [[nodiscard]] const asset::path& directory() const { return directory_; }
+
+  /**
+   * @brief Returns the path of the cooked asset file for \p key
+   */
+  [[nodiscard]] asset::path path(const Hash& key) const;
+
+  /**
+   * @brief Returns the content hash of the source asset at \p source_path
+   */
+  [[nodiscard]] std::optional<Hash> source_hash(const asset::path& source_path) const;
+
+  /**
+   * @brief Returns the cooked asset stored under \p key , if one exists with meta-information of type \p InfoT
+   */
+  template <typename InfoT> [[nodiscard]] std::optional<CookedAsset<InfoT>> find(const Hash& key) const
+  {
+    static_assert(std::is_trivially_copyable_v<InfoT>);
+    InfoT info;
+    auto data = read(key, type_hash_value_v<InfoT>, &info, sizeof(InfoT));
+    if (!data.has_value())
+    {
+      return std::nullopt;
+    }
+    return CookedAsset<InfoT>{.info = info, .payload = data->bytes, .owner = std::move(data->owner)};
+  }
+
+  /**
+   * @brief Writes a cooked asset with meta-information \p info and \p payload under \p key
+   */
+  template <typename InfoT>
+  [[nodiscard]] expected<void, CookedAssetError>
+  write(const Hash& key, const InfoT& info, std::span<const std::byte> payload) const
+  {
+    static_assert(std::is_trivially_copyable_v<InfoT>);
+    return write(key, type_hash_value_v<InfoT>, &info, sizeof(InfoT), payload);
+  }
+
+private:
+  [[nodiscard]] std::optional<AssetData>
+  read(const Hash& key, std::size_t info_type, void* info, std::size_t info_length) const;
+
+  [[nodiscard]] expected<void, CookedAssetError> write(
+    const Hash& key,
+    std::size_t info_type,
+    const void* info,
+    std::size_t info_length,
+    std::span<const std::byte> payload) const;
+
+  /// Directory which holds cooked assets
+  asset::path directory_;
+  /// File system used to read source and cooked assets
+  std::shared_ptr<const AssetFileSystem> file_system_;
+};
+
+}  // namespace sde
+
+namespace sde::serial
+{
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, CookedAssetHeader> : std::true_type
+{};
+
+}  // namespace sde::serial
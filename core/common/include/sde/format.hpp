@@ -7,7 +7,9 @@
 
 // C++ Standard Library
 #include <cstdio>
+#include <cstring>
 #include <cwchar>
+#include <memory_resource>
 #include <type_traits>
 #include <utility>
 
@@ -54,4 +56,41 @@ const CharT* format(const CharT* fmt_str, FormatArgTs&&... fmt_args)
   return kFormatErrorString<CharT>;
 }
 
+/**
+ * @brief Formats a string into memory allocated from \p resource and returns a char pointer to it
+ *
+ *        Output is not limited to \p BufferLen ; longer strings are formatted a second time, directly into
+ *        \p resource . Intended for use with a linear arena (e.g. AppProperties::frame_arena), so that
+ *        temporary strings cost a pointer bump and are reclaimed all at once.
+ *
+ * @param resource  memory resource from which the formatted string is allocated
+ * @param fmt_str  format specification string
+ * @param fmt_args...  args use to replace format placeholders in \c fmt_str
+ *
+ * @retval fmt  formatted c-string, valid until it is reclaimed by \p resource
+ * @retval err  c-string indicating error
+ */
+template <std::size_t BufferLen = 128UL, typename... FormatArgTs>
+const char* format(std::pmr::memory_resource& resource, const char* fmt_str, FormatArgTs&&... fmt_args)
+{
+  char stack_buffer[BufferLen];
+  const int formatted_len = std::snprintf(stack_buffer, sizeof(stack_buffer), fmt_str, fmt_args...);
+  if (formatted_len < 0)
+  {
+    return kFormatErrorString<char>;
+  }
+
+  const std::size_t output_len = static_cast<std::size_t>(formatted_len) + 1;
+  auto* output = static_cast<char*>(resource.allocate(output_len, alignof(char)));
+  if (output_len <= sizeof(stack_buffer))
+  {
+    std::memcpy(output, stack_buffer, output_len);
+  }
+  else
+  {
+    std::snprintf(output, output_len, fmt_str, fmt_args...);
+  }
+  return output;
+}
+
 }  // namespace sde
@@ -66,14 +66,22 @@ template <typename T, int N, int M> struct Hasher<Eigen::Matrix<T, N, M, Eigen::
 {
   auto operator()(const Eigen::Matrix<T, N, M, Eigen::ColMajor>& m) const
   {
-    Hash h{};
-    const T* p_beg = m.data();
-    const T* p_end = m.data() + m.size();
-    for (const T* p = p_beg; p != p_end; ++p)
+    if constexpr (is_trivially_bytes_hashable_v<T>)
     {
-      h += Hasher<T>{}(*p);
+      const void* data = m.data();
+      return Hash{ComputeBytesHashValue(data, m.size() * sizeof(T))};
+    }
+    else
+    {
+      Hash h{};
+      const T* p_beg = m.data();
+      const T* p_end = m.data() + m.size();
+      for (const T* p = p_beg; p != p_end; ++p)
+      {
+        h += Hasher<T>{}(*p);
+      }
+      return h;
     }
-    return h;
   }
 };
 
@@ -6,12 +6,18 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
-#include <iosfwd>
+#include <iterator>
+#include <ostream>
+#include <string_view>
 #include <type_traits>
 
 // SDE
 #include "sde/traits.hpp"
+#include "sde/type_name.hpp"
 
 namespace sde
 {
@@ -28,7 +34,7 @@ struct Hash
 {
   std::size_t value = hash_digest(0);
 
-  Hash& operator+=(const Hash& other)
+  constexpr Hash& operator+=(const Hash& other)
   {
     this->value = hash_digest(this->value, other.value);
     return *this;
@@ -45,6 +51,246 @@ constexpr bool operator==(Hash lhs, std::size_t rhs_value) { return lhs.value ==
 
 constexpr bool operator!=(Hash lhs, std::size_t rhs_value) { return lhs.value != rhs_value; }
 
+namespace detail
+{
+
+/// Default secret parameters for bulk hashing (wyhash)
+constexpr std::uint64_t kBytesHashSecret[4] = {
+  0x2d358dccaa6c78a5UL,
+  0x8bb84b93962eacc9UL,
+  0x4b33a62ed433d4a3UL,
+  0x4d5a2da51de1aa47UL};
+
+constexpr void bytes_hash_mum(std::uint64_t& a, std::uint64_t& b)
+{
+  const __uint128_t r = static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b);
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64);
+}
+
+constexpr std::uint64_t bytes_hash_mix(std::uint64_t a, std::uint64_t b)
+{
+  bytes_hash_mum(a, b);
+  return a ^ b;
+}
+
+template <typename ByteT> constexpr std::uint64_t bytes_hash_read(const ByteT* p, std::size_t n)
+{
+  static_assert(sizeof(ByteT) == 1, "'ByteT' must be a byte-like type");
+  if (std::is_constant_evaluated())
+  {
+    std::uint64_t v = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      v |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[i])) << (8 * i);
+    }
+    return v;
+  }
+  else if (n == sizeof(std::uint64_t))
+  {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+  else
+  {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+  }
+}
+
+template <typename ByteT> constexpr std::uint64_t bytes_hash_read8(const ByteT* p) { return bytes_hash_read(p, 8); }
+
+template <typename ByteT> constexpr std::uint64_t bytes_hash_read4(const ByteT* p) { return bytes_hash_read(p, 4); }
+
+template <typename ByteT> constexpr std::uint64_t bytes_hash_read3(const ByteT* p, std::size_t k)
+{
+  return (static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[0])) << 16) |
+    (static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[k >> 1])) << 8) |
+    static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[k - 1]));
+}
+
+constexpr std::uint64_t bytes_hash_seed(std::uint64_t seed)
+{
+  return seed ^ bytes_hash_mix(seed ^ kBytesHashSecret[0], kBytesHashSecret[1]);
+}
+
+/**
+ * @brief Mixes a 48-byte stripe into three independent lanes
+ */
+template <typename ByteT> constexpr void bytes_hash_stripe(const ByteT* p, std::uint64_t lanes[3])
+{
+  lanes[0] = bytes_hash_mix(bytes_hash_read8(p) ^ kBytesHashSecret[1], bytes_hash_read8(p + 8) ^ lanes[0]);
+  lanes[1] = bytes_hash_mix(bytes_hash_read8(p + 16) ^ kBytesHashSecret[2], bytes_hash_read8(p + 24) ^ lanes[1]);
+  lanes[2] = bytes_hash_mix(bytes_hash_read8(p + 32) ^ kBytesHashSecret[3], bytes_hash_read8(p + 40) ^ lanes[2]);
+}
+
+/**
+ * @brief Hashes the last (at most 48) bytes of a sequence of length \p len
+ *
+ * @param end  one past the last byte of the sequence; when \p len > 16, 16 bytes before \p end must be readable
+ * @param i  number of bytes remaining after all 48-byte stripes were consumed
+ */
+template <typename ByteT>
+constexpr std::uint64_t bytes_hash_finish(const ByteT* end, std::size_t i, std::size_t len, std::uint64_t seed)
+{
+  std::uint64_t a = 0;
+  std::uint64_t b = 0;
+  if (len <= 16)
+  {
+    const ByteT* p = end - len;
+    if (len >= 4)
+    {
+      a = (bytes_hash_read4(p) << 32) | bytes_hash_read4(p + ((len >> 3) << 2));
+      b = (bytes_hash_read4(p + len - 4) << 32) | bytes_hash_read4(p + len - 4 - ((len >> 3) << 2));
+    }
+    else if (len > 0)
+    {
+      a = bytes_hash_read3(p, len);
+    }
+  }
+  else
+  {
+    const ByteT* p = end - i;
+    while (i > 16)
+    {
+      seed = bytes_hash_mix(bytes_hash_read8(p) ^ kBytesHashSecret[1], bytes_hash_read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = bytes_hash_read8(p + i - 16);
+    b = bytes_hash_read8(p + i - 8);
+  }
+  a ^= kBytesHashSecret[1];
+  b ^= seed;
+  bytes_hash_mum(a, b);
+  return bytes_hash_mix(a ^ kBytesHashSecret[0] ^ len, b ^ kBytesHashSecret[1]);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes a fast, 64-bit, non-cryptographic hash over a contiguous block of bytes
+ *
+ *        Implements wyhash (final version 4). Usable in constant expressions when \p data
+ *        points to \c char data (e.g. a \c std::string_view ).
+ */
+template <typename ByteT, typename = std::enable_if_t<sizeof(ByteT) == 1>>
+constexpr std::uint64_t ComputeBytesHashValue(const ByteT* data, std::size_t len, std::uint64_t seed = 0)
+{
+  const ByteT* p = data;
+  std::size_t i = len;
+  seed = detail::bytes_hash_seed(seed);
+  if (i > 48)
+  {
+    std::uint64_t lanes[3] = {seed, seed, seed};
+    do
+    {
+      detail::bytes_hash_stripe(p, lanes);
+      p += 48;
+      i -= 48;
+    } while (i > 48);
+    seed = lanes[0] ^ lanes[1] ^ lanes[2];
+  }
+  return detail::bytes_hash_finish(p + i, i, len, seed);
+}
+
+inline std::uint64_t ComputeBytesHashValue(const void* data, std::size_t len, std::uint64_t seed = 0)
+{
+  return ComputeBytesHashValue(reinterpret_cast<const std::uint8_t*>(data), len, seed);
+}
+
+constexpr std::uint64_t ComputeBytesHashValue(std::string_view str, std::uint64_t seed = 0)
+{
+  return ComputeBytesHashValue(str.data(), str.size(), seed);
+}
+
+/**
+ * @brief Streaming version of ComputeBytesHashValue
+ *
+ *        Produces the same value as ComputeBytesHashValue over the concatenation of all
+ *        bytes passed to BytesHasher::update, regardless of how input was split.
+ */
+class BytesHasher
+{
+public:
+  explicit BytesHasher(std::uint64_t seed = 0) : seed_{detail::bytes_hash_seed(seed)} {}
+
+  /**
+   * @brief Adds bytes to the hash
+   */
+  BytesHasher& update(const void* data, std::size_t len)
+  {
+    const auto* p = reinterpret_cast<const std::uint8_t*>(data);
+    total_len_ += len;
+
+    // Complete buffered stripe; stripes are only consumed once it is known that more bytes follow
+    if (buffer_len_ > 0)
+    {
+      const std::size_t fill_len = std::min(len, kStripeLen - buffer_len_);
+      std::memcpy(buffer_ + kTailLen + buffer_len_, p, fill_len);
+      buffer_len_ += fill_len;
+      p += fill_len;
+      len -= fill_len;
+      if (len == 0)
+      {
+        return *this;
+      }
+      consume(buffer_ + kTailLen);
+      buffer_len_ = 0;
+    }
+
+    // Consume stripes directly from input
+    while (len > kStripeLen)
+    {
+      consume(p);
+      p += kStripeLen;
+      len -= kStripeLen;
+    }
+
+    std::memcpy(buffer_ + kTailLen, p, len);
+    buffer_len_ = len;
+    return *this;
+  }
+
+  /**
+   * @brief Returns hash of all bytes added so far
+   */
+  [[nodiscard]] std::uint64_t digest() const
+  {
+    const std::uint64_t seed = stripe_count_ ? (lanes_[0] ^ lanes_[1] ^ lanes_[2]) : seed_;
+    return detail::bytes_hash_finish(buffer_ + kTailLen + buffer_len_, buffer_len_, total_len_, seed);
+  }
+
+private:
+  static constexpr std::size_t kStripeLen = 48;
+  static constexpr std::size_t kTailLen = 16;
+
+  void consume(const std::uint8_t* stripe)
+  {
+    if (stripe_count_ == 0)
+    {
+      lanes_[0] = lanes_[1] = lanes_[2] = seed_;
+    }
+    detail::bytes_hash_stripe(stripe, lanes_);
+    ++stripe_count_;
+    // Retain the last bytes of the stripe, which may be re-read when finishing
+    std::memmove(buffer_, stripe + kStripeLen - kTailLen, kTailLen);
+  }
+
+  std::uint64_t seed_;
+  std::uint64_t lanes_[3] = {0, 0, 0};
+  std::size_t stripe_count_ = 0;
+  std::size_t total_len_ = 0;
+  std::size_t buffer_len_ = 0;
+  std::uint8_t buffer_[kTailLen + kStripeLen] = {};
+};
+
+template <typename T>
+constexpr bool is_trivially_bytes_hashable_v =
+  std::is_trivially_copyable_v<T> and (std::is_arithmetic_v<T> or std::has_unique_object_representations_v<T>);
+
 template <typename T, bool U = T::kDoNotHash> constexpr bool has_do_not_hash_tag(T*) { return U; }
 
 constexpr bool has_do_not_hash_tag(...) { return false; }
@@ -53,6 +299,20 @@ template <typename T> constexpr bool do_not_hash_v = has_do_not_hash_tag(static_
 
 template <typename T> struct Hasher
 {
+  /// Returns true if T is a contiguous range of elements which may be hashed as raw bytes
+  static constexpr bool is_contiguous_bytes_hashable()
+  {
+    if constexpr (requires(const T& r) {
+                    std::data(r);
+                    std::size(r);
+                  })
+    {
+      using element_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<const T&>()))>>;
+      return is_trivially_bytes_hashable_v<element_type>;
+    }
+    return false;
+  }
+
   template <bool U = do_not_hash_v<T>> constexpr std::enable_if_t<U, Hash> operator()(const T& v) const { return {0}; }
 
   template <bool U = do_not_hash_v<T>> constexpr std::enable_if_t<!U, Hash> operator()(const T& v) const
@@ -62,6 +322,11 @@ template <typename T> struct Hasher
     {
       return {std::hash<T>{}(v)};
     }
+    else if constexpr (is_contiguous_bytes_hashable())
+    {
+      const void* data = std::data(v);
+      return {ComputeBytesHashValue(data, std::size(v) * sizeof(*std::data(v)))};
+    }
     else if constexpr (is_iterable<T>())
     {
       Hash h;
@@ -85,15 +350,19 @@ template <typename F, typename S> struct Hasher<std::pair<F, S>>
 
 template <typename T> using hashable_t = std::remove_const_t<std::remove_reference_t<T>>;
 
-template <typename T> constexpr std::size_t ComputeTypeHashValue()
-{
-  return std::hash<std::string_view>{}(std::string_view{__PRETTY_FUNCTION__});
-}
+/**
+ * @brief Returns a hash of the fully-qualified name of \p T
+ *
+ *        Always evaluated at compile time, so the result may be used as a template argument or \c case label.
+ */
+template <typename T> consteval std::size_t ComputeTypeHashValue() { return ComputeBytesHashValue(type_name<T>()); }
 
-template <typename T> constexpr Hash ComputeTypeHash()
-{
-  return {ComputeTypeHashValue<std::remove_reference_t<std::remove_const_t<T>>>()};
-}
+/**
+ * @brief Compile-time hash of the fully-qualified name of \p T
+ */
+template <typename T> constexpr std::size_t type_hash_value_v = ComputeTypeHashValue<T>();
+
+template <typename T> constexpr Hash ComputeTypeHash() { return {type_hash_value_v<bare_t<T>>}; }
 
 constexpr Hash ComputeHash() { return {}; }
 
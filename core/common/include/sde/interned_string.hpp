@@ -0,0 +1,92 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file interned_string.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string_view>
+
+// SDE
+#include "sde/hash.hpp"
+
+namespace sde
+{
+
+/**
+ * @brief Immutable string which is stored once in a global symbol table
+ *
+ *        Each distinct string is assigned a stable 32-bit id for the lifetime of the process, so
+ *        interned strings are cheap to copy, compare and hash. Ids are not stable across processes;
+ *        interned strings are serialized as their text and re-interned on load.
+ *
+ * @note  Interning is thread-safe. Interned text is never released.
+ * @note  shared libraries which link their own copy share the symbol table of the executable which loads them only if
+ *        it exports its symbols (e.g. is linked with -rdynamic)
+ */
+class InternedString
+{
+public:
+  using id_type = std::uint32_t;
+
+  /**
+   * @brief Empty string; always has id 0
+   */
+  constexpr InternedString() = default;
+
+  /**
+   * @brief Interns \p str , adding it to the symbol table if it was not already present
+   */
+  explicit InternedString(std::string_view str);
+
+  /**
+   * @brief Returns interned string matching \p str , if \p str was previously interned
+   *
+   * @note  does not modify the symbol table
+   */
+  [[nodiscard]] static std::optional<InternedString> find(std::string_view str);
+
+  /**
+   * @brief Returns the number of distinct strings which have been interned
+   */
+  [[nodiscard]] static std::size_t count();
+
+  [[nodiscard]] constexpr id_type id() const { return id_; }
+
+  [[nodiscard]] std::string_view str() const;
+
+  [[nodiscard]] const char* c_str() const { return this->str().data(); }
+
+  [[nodiscard]] bool empty() const { return id_ == 0; }
+
+  operator std::string_view() const { return this->str(); }
+
+  constexpr bool operator==(const InternedString& other) const { return id_ == other.id_; }
+  constexpr bool operator!=(const InternedString& other) const { return id_ != other.id_; }
+
+private:
+  constexpr explicit InternedString(id_type id) : id_{id} {}
+
+  id_type id_ = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const InternedString& str);
+
+template <> struct Hasher<InternedString>
+{
+  constexpr Hash operator()(const InternedString& str) const { return {str.id()}; }
+};
+
+}  // namespace sde
+
+namespace std
+{
+template <> struct hash<sde::InternedString>
+{
+  std::size_t operator()(const sde::InternedString& str) const { return str.id(); }
+};
+}  // namespace std
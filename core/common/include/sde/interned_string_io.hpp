@@ -0,0 +1,40 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file interned_string_io.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <string>
+
+// SDE
+#include "sde/interned_string.hpp"
+#include "sde/serialization.hpp"
+
+namespace sde::serial
+{
+
+template <typename Archive> struct save<Archive, InternedString>
+{
+  void operator()(Archive& ar, const InternedString& str) const
+  {
+    const std::string_view value{str};
+    ar << named{"len", value.size()};
+    ar << named{"data", make_packet(value.data(), value.size())};
+  }
+};
+
+template <typename Archive> struct load<Archive, InternedString>
+{
+  void operator()(Archive& ar, InternedString& str) const
+  {
+    std::size_t len{0};
+    ar >> named{"len", len};
+    std::string value(len, '\0');
+    ar >> named{"data", make_packet(value.data(), value.size())};
+    str = InternedString{value};
+  }
+};
+
+}  // namespace sde::serial
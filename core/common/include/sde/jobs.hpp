@@ -0,0 +1,250 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file jobs.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// SDE
+#include "sde/vector.hpp"
+
+namespace sde::jobs
+{
+
+/**
+ * @brief Thread on which a job may run
+ */
+enum class Affinity
+{
+  /// Any worker, or a thread waiting on a counter
+  kAny,
+  /// Thread which created the JobSystem; used for work which must happen on the thread owning a GL/AL context
+  kMain,
+};
+
+class Counter;
+
+/**
+ * @brief Unit of work, with its completion and dependency counters
+ */
+struct Job
+{
+  /// Work to do
+  std::function<void()> work;
+  /// Decremented once the job has run
+  Counter* signal = nullptr;
+  /// Thread on which the job may run
+  Affinity affinity = Affinity::kAny;
+};
+
+/**
+ * @brief Options for JobSystem::submit
+ */
+struct JobOptions
+{
+  /// Counter which is incremented on submission and decremented once the job has run
+  Counter* signal = nullptr;
+  /// Counter which must reach zero before the job may start
+  Counter* after = nullptr;
+  /// Thread on which the job may run
+  Affinity affinity = Affinity::kAny;
+};
+
+/**
+ * @brief Number of outstanding jobs or dependencies
+ *
+ *        A counter must outlive all jobs which signal or wait on it; JobSystem::wait may be used to ensure this.
+ */
+class Counter
+{
+public:
+  Counter() = default;
+
+  explicit Counter(std::size_t initial) : value_{initial} {}
+
+  Counter(const Counter&) = delete;
+  Counter& operator=(const Counter&) = delete;
+
+  /**
+   * @brief Adds \p count outstanding items, to be released with JobSystem::signal
+   */
+  void add(std::size_t count) { value_.fetch_add(count, std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns the number of outstanding items
+   */
+  [[nodiscard]] std::size_t value() const { return value_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Returns true once all outstanding items have been released
+   */
+  [[nodiscard]] bool done() const { return value() == 0; }
+
+private:
+  friend class JobSystem;
+
+  /// Number of outstanding items
+  std::atomic<std::size_t> value_ = 0;
+  /// Protects waiting_, and release of this counter
+  std::mutex mutex_;
+  /// Jobs which start once this counter reaches zero
+  sde::vector<Job> waiting_;
+};
+
+/**
+ * @brief Runs jobs on a pool of worker threads
+ *
+ *        Each worker owns a queue of jobs. Jobs submitted from a worker are pushed to, and run last-in-first-out from,
+ *        that worker's queue, which keeps related work on the same thread. Jobs submitted from other threads are shared
+ *        between all workers. A worker which runs out of jobs steals the oldest job queued by another worker.
+ *
+ *        Threads which wait on a counter run queued jobs until the counter is released, so waiting never blocks
+ *        progress, even with no workers. Jobs with Affinity::kMain only run on the thread which created the JobSystem,
+ *        while it waits on a counter or calls runMainJobs().
+ */
+class JobSystem
+{
+public:
+  /**
+   * @param worker_count  number of worker threads; with none, jobs run on threads which wait for them
+   */
+  explicit JobSystem(std::size_t worker_count = std::max(1U, std::thread::hardware_concurrency()) - 1U);
+
+  /**
+   * @brief Stops workers once they have finished all queued jobs they may run
+   *
+   *        Jobs which are still queued afterwards (Affinity::kMain jobs, or all jobs with no workers) are dropped.
+   */
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  /**
+   * @brief Queues \p work to run once \c options.after (if any) reaches zero
+   */
+  void submit(std::function<void()> work, const JobOptions& options = {});
+
+  /**
+   * @brief Releases one outstanding item of \p counter , starting jobs waiting on it once it reaches zero
+   */
+  void signal(Counter& counter);
+
+  /**
+   * @brief Runs queued jobs until \p counter reaches zero
+   */
+  void wait(Counter& counter);
+
+  /**
+   * @brief Runs all queued Affinity::kMain jobs; must be called from the thread which created the JobSystem
+   *
+   * @return number of jobs run
+   */
+  std::size_t runMainJobs();
+
+  /**
+   * @brief Calls \c fn(i) for each \c i in [ \p first , \p last ), in chunks of \p grain indices run as jobs
+   *
+   *        Returns once all calls have finished. The calling thread runs chunks while it waits.
+   */
+  template <typename FnT> void parallel_for(std::size_t first, std::size_t last, std::size_t grain, FnT&& fn)
+  {
+    grain = std::max<std::size_t>(grain, 1);
+    Counter counter;
+    for (std::size_t chunk_first = first; chunk_first < last; chunk_first += grain)
+    {
+      const std::size_t chunk_last = std::min(last, chunk_first + grain);
+      this->submit(
+        [&fn, chunk_first, chunk_last] {
+          for (std::size_t i = chunk_first; i < chunk_last; ++i)
+          {
+            fn(i);
+          }
+        },
+        {.signal = &counter});
+    }
+    this->wait(counter);
+  }
+
+  /**
+   * @brief Returns the number of worker threads
+   */
+  [[nodiscard]] std::size_t workers() const { return worker_count_; }
+
+  /**
+   * @brief Returns true if called from the thread which created the JobSystem
+   */
+  [[nodiscard]] bool isMainThread() const { return std::this_thread::get_id() == main_thread_; }
+
+private:
+  /// Jobs queue, locked on access
+  struct Queue
+  {
+    void push(Job&& job);
+    bool pop_front(Job& job);
+    bool pop_back(Job& job);
+
+    std::mutex mutex;
+    std::deque<Job> jobs;
+    /// Number of queued jobs, checked before locking
+    std::atomic<std::size_t> size = 0;
+  };
+
+  /// Queues \p job to run as soon as possible
+  void enqueue(Job&& job);
+
+  /// Runs a single queued job which may run on the calling thread, if there is one
+  bool tryRun();
+
+  /// Takes a queued job which may run on the calling thread, if there is one
+  bool tryTake(Job& job);
+
+  /// Runs \p job , then signals its counter
+  void run(Job& job);
+
+  /// Blocks until a job may have been queued or a counter released since \p epoch was read
+  void sleep(std::uint64_t epoch);
+
+  /// Wakes one sleeping thread, or \p all of them
+  void wake(bool all);
+
+  /// Worker thread loop
+  void work(std::size_t index);
+
+  /// Thread which created this JobSystem
+  std::thread::id main_thread_;
+  /// Number of workers; fixed before they start, unlike workers_.size()
+  std::size_t worker_count_;
+  /// One queue per worker; owners push and pop at the back, thieves pop at the front
+  std::unique_ptr<Queue[]> queues_;
+  /// Jobs submitted from threads other than workers
+  Queue shared_;
+  /// Affinity::kMain jobs
+  Queue main_;
+  /// Worker threads
+  sde::vector<std::thread> workers_;
+  /// Incremented each time a job is queued or a counter is released
+  std::atomic<std::uint64_t> epoch_ = 0;
+  /// Number of threads sleeping, or about to sleep
+  std::atomic<std::size_t> sleepers_ = 0;
+  /// Protects sleeping
+  std::mutex sleep_mutex_;
+  /// Signals sleeping threads
+  std::condition_variable sleep_cv_;
+  /// Set when workers should stop
+  std::atomic<bool> stop_ = false;
+};
+
+}  // namespace sde::jobs
@@ -9,7 +9,12 @@
 #define SDE_COMMON_LOG
 
 // C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
+#include <optional>
 
 // SDE
 #include "sde/format.hpp"
@@ -40,12 +45,73 @@ struct LogFileInfo
 
 std::ostream& operator<<(std::ostream& os, const LogFileInfo& info);
 
+/// Maximum length of a single log message, in characters; longer messages are truncated
+static constexpr std::size_t kLogMessageMaxLength = 1024UL;
+
+namespace detail
+{
+class LogLine;
+extern std::atomic<LogSeverity> log_threshold;
+}  // namespace detail
+
+/**
+ * @brief Sets the minimum severity of messages which are logged
+ */
+void SetLogThreshold(LogSeverity severity);
+
+/**
+ * @brief Returns the minimum severity of messages which are logged
+ */
+LogSeverity GetLogThreshold();
+
+/**
+ * @brief Returns true if messages of \p severity are logged
+ */
+inline bool LogEnabled(LogSeverity severity)
+{
+  return severity >= detail::log_threshold.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Sets the stream which log messages are written to; \c std::cout if \p sink is \c nullptr
+ *
+ *        Pending messages are written to the previous sink first. \p sink must outlive its use as a sink.
+ */
+void SetLogSink(std::ostream* sink);
+
+/**
+ * @brief Blocks until all messages logged before this call are written to the sink
+ */
+void FlushLog();
+
+/**
+ * @brief Writes pending messages on SIGSEGV, SIGABRT and std::terminate, before deferring to previous handlers
+ *
+ *        Opt-in, since it replaces process-wide handlers; safe to call more than once. From a signal handler, messages
+ *        are written straight to the standard output descriptor if the sink is \c std::cout, and to standard error
+ *        otherwise.
+ */
+void InstallLogCrashHandlers();
+
+/**
+ * @brief Writes a single log message
+ *
+ *        Messages are formatted on the calling thread and queued; a background thread writes queued messages to the
+ *        log sink (see SetLogSink), so logging does not wait on console IO. Messages from the same thread are written
+ *        in the order they were logged. Fatal messages are written before the destructor returns. Pending messages
+ *        are written at exit, and on crashes once InstallLogCrashHandlers is called.
+ */
 class Log
 {
 public:
   ~Log();
 
   Log();
+  explicit Log(LogSeverity severity);
+
+  /**
+   * @brief Writes directly to \p target , on the calling thread
+   */
   explicit Log(std::ostream* target);
 
   Log(Log&& other);
@@ -67,9 +133,46 @@ private:
   Log(const Log& other) = delete;
   Log& operator=(const Log& other) = delete;
 
-  std::ostream* os_;
+  std::ostream* os_ = nullptr;
+  detail::LogLine* line_ = nullptr;
+  LogSeverity severity_ = LogSeverity::kInfo;
+};
+
+/**
+ * @brief Limits how often a single log site writes messages
+ */
+class LogRateLimit
+{
+public:
+  explicit LogRateLimit(std::chrono::nanoseconds period);
+
+  /**
+   * @brief Checks whether a message may be written now
+   *
+   * @return number of messages suppressed since the last message written; \c std::nullopt if this message should be
+   *         suppressed
+   */
+  std::optional<std::size_t> acquire();
+
+private:
+  /// Minimum time between messages
+  std::chrono::nanoseconds period_;
+  /// Earliest time of the next message, as nanoseconds since steady clock epoch
+  std::atomic<std::int64_t> next_;
+  /// Messages suppressed since the last message written
+  std::atomic<std::size_t> suppressed_;
 };
 
+/**
+ * @brief Number of messages suppressed by a LogRateLimit, written before a rate limited message
+ */
+struct LogSuppressed
+{
+  std::size_t count;
+};
+
+std::ostream& operator<<(std::ostream& os, const LogSuppressed& suppressed);
+
 class Abort : public Log
 {
 public:
@@ -95,6 +198,7 @@ private:
 
 #define SDE_LOG_FMT(severity, fmt, ...) (void)0
 #define SDE_LOG(severity, msg) (void)0
+#define SDE_LOG_RATE_LIMITED(severity, period) (void)0
 
 #else
 
@@ -105,7 +209,19 @@ private:
 #include <cstdlib>
 #include <iosfwd>
 
-#define SDE_LOG(severity) sde::Log{} << "[SDE LOG] (" << SDE_LOG_GENERATE_FILE_INFO(severity) << ") "
+#define SDE_LOG_STREAM(severity) sde::Log{severity} << "[SDE LOG] (" << SDE_LOG_GENERATE_FILE_INFO(severity) << ") "
+#define SDE_LOG(severity)                                                                                              \
+  if (!::sde::LogEnabled(severity))                                                                                    \
+  {}                                                                                                                   \
+  else                                                                                                                 \
+    SDE_LOG_STREAM(severity)
+#define SDE_LOG_RATE_LIMITED(severity, period)                                                                         \
+  if (static ::sde::LogRateLimit __sde_log_rate_limit{period}; !::sde::LogEnabled(severity))                           \
+  {}                                                                                                                   \
+  else if (const auto __sde_log_suppressed = __sde_log_rate_limit.acquire(); !__sde_log_suppressed.has_value())        \
+  {}                                                                                                                   \
+  else                                                                                                                 \
+    SDE_LOG_STREAM(severity) << ::sde::LogSuppressed{*__sde_log_suppressed}
 #define SDE_LOG_FMT(severity, fmt, ...) SDE_LOG(severity) << sde::format<1024UL>(fmt, __VA_ARGS__)
 
 #endif  // SDE_LOGGING_DISABLED
@@ -121,13 +237,21 @@ private:
   if constexpr (false)                                                                                                 \
     sde::Log {}
 #else
-#define SDE_LOG_DEBUG() sde::Log{} << SDE_LOG_GENERATE_FILE_INFO(::sde::LogSeverity::kDebug) << ' '
+#define SDE_LOG_DEBUG()                                                                                                \
+  if (!::sde::LogEnabled(::sde::LogSeverity::kDebug))                                                                  \
+  {}                                                                                                                   \
+  else                                                                                                                 \
+    sde::Log{::sde::LogSeverity::kDebug} << SDE_LOG_GENERATE_FILE_INFO(::sde::LogSeverity::kDebug) << ' '
 #endif
 
 #define SDE_LOG_INFO() SDE_LOG(::sde::LogSeverity::kInfo)
 #define SDE_LOG_WARN() SDE_LOG(::sde::LogSeverity::kWarn)
 #define SDE_LOG_ERROR() SDE_LOG(::sde::LogSeverity::kError)
-#define SDE_LOG_FATAL() SDE_LOG(::sde::LogSeverity::kError)
+#define SDE_LOG_FATAL() SDE_LOG(::sde::LogSeverity::kFatal)
+
+#define SDE_LOG_INFO_RATE_LIMITED(period) SDE_LOG_RATE_LIMITED(::sde::LogSeverity::kInfo, period)
+#define SDE_LOG_WARN_RATE_LIMITED(period) SDE_LOG_RATE_LIMITED(::sde::LogSeverity::kWarn, period)
+#define SDE_LOG_ERROR_RATE_LIMITED(period) SDE_LOG_RATE_LIMITED(::sde::LogSeverity::kError, period)
 
 #define SDE_FAIL() sde::Abort{} << SDE_LOG_GENERATE_FILE_INFO(::sde::LogSeverity::kFatal) << "\n\n"
 #define SDE_ASSERT(condition)                                                                                          \
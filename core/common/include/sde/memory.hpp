@@ -6,9 +6,322 @@
 #pragma once
 
 // C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 
 namespace sde
 {
-template <typename T> using allocator = ::std::allocator<T>;
+
+/**
+ * @brief Subsystem to which allocations made through an sde::tagged_allocator are attributed
+ */
+enum class MemoryTag : std::uint8_t
+{
+  kDefault,
+  kGraphics,
+  kAudio,
+  kGame,
+  kSerialization,
+  _Count_
+};
+
+std::ostream& operator<<(std::ostream& os, MemoryTag tag);
+
+/**
+ * @brief Snapshot of allocation statistics for a single MemoryTag
+ */
+struct MemoryStats
+{
+  /// Bytes currently allocated
+  std::size_t live_bytes = 0;
+  /// Largest value of live_bytes observed since the last reset_memory_peak
+  std::size_t peak_bytes = 0;
+  /// Allocations which have not yet been freed
+  std::size_t live_allocations = 0;
+  /// Total number of allocations made
+  std::size_t allocation_count = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const MemoryStats& stats);
+
+/**
+ * @brief Live allocation counters for a single MemoryTag
+ *
+ * @note  all updates are relaxed atomic operations
+ */
+class MemoryCounters
+{
+public:
+  void on_allocate(std::size_t bytes)
+  {
+    const std::size_t live_bytes = live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    live_allocations_.fetch_add(1, std::memory_order_relaxed);
+    allocation_count_.fetch_add(1, std::memory_order_relaxed);
+    std::size_t peak_bytes = peak_bytes_.load(std::memory_order_relaxed);
+    while ((live_bytes > peak_bytes) and
+           !peak_bytes_.compare_exchange_weak(peak_bytes, live_bytes, std::memory_order_relaxed))
+    {}
+  }
+
+  void on_deallocate(std::size_t bytes)
+  {
+    live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    live_allocations_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void reset_peak() { peak_bytes_.store(live_bytes_.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+  [[nodiscard]] MemoryStats stats() const
+  {
+    return {
+      .live_bytes = live_bytes_.load(std::memory_order_relaxed),
+      .peak_bytes = peak_bytes_.load(std::memory_order_relaxed),
+      .live_allocations = live_allocations_.load(std::memory_order_relaxed),
+      .allocation_count = allocation_count_.load(std::memory_order_relaxed)};
+  }
+
+private:
+  std::atomic<std::size_t> live_bytes_ = 0;
+  std::atomic<std::size_t> peak_bytes_ = 0;
+  std::atomic<std::size_t> live_allocations_ = 0;
+  std::atomic<std::size_t> allocation_count_ = 0;
+};
+
+/**
+ * @brief Returns allocation counters for \p tag
+ */
+MemoryCounters& memory_counters(MemoryTag tag);
+
+/**
+ * @brief Returns a snapshot of allocation statistics for \p tag
+ */
+inline MemoryStats memory_stats(MemoryTag tag) { return memory_counters(tag).stats(); }
+
+/**
+ * @brief Resets peak byte count of \p tag to its current live byte count
+ */
+inline void reset_memory_peak(MemoryTag tag) { memory_counters(tag).reset_peak(); }
+
+/**
+ * @brief Returns the memory resource used by newly constructed allocators with \p tag
+ */
+std::pmr::memory_resource* memory_resource(MemoryTag tag);
+
+/**
+ * @brief Sets the memory resource used by newly constructed allocators with \p tag
+ *
+ *        Allocators (and the containers which own them) hold on to the resource they were constructed with,
+ *        so memory is always returned to the resource it came from. \p resource must outlive every allocator
+ *        constructed while it is set.
+ *
+ * @param resource  memory resource; resets to \c std::pmr::new_delete_resource() if nullptr
+ *
+ * @return previously set memory resource
+ */
+std::pmr::memory_resource* set_memory_resource(MemoryTag tag, std::pmr::memory_resource* resource);
+
+/**
+ * @brief Sets the memory resource of a MemoryTag for the lifetime of this object
+ */
+class MemoryResourceScope
+{
+public:
+  MemoryResourceScope(MemoryTag tag, std::pmr::memory_resource* resource) :
+      tag_{tag}, previous_{set_memory_resource(tag, resource)}
+  {}
+
+  ~MemoryResourceScope() { set_memory_resource(tag_, previous_); }
+
+private:
+  MemoryResourceScope(const MemoryResourceScope&) = delete;
+  MemoryResourceScope& operator=(const MemoryResourceScope&) = delete;
+
+  MemoryTag tag_;
+  std::pmr::memory_resource* previous_;
+};
+
+/**
+ * @brief Allocator which draws memory from a pluggable memory resource and records statistics against \p Tag
+ *
+ *        The memory resource is captured on construction (see sde::set_memory_resource) and propagated with
+ *        the container which owns this allocator.
+ */
+template <typename T, MemoryTag Tag = MemoryTag::kDefault> class tagged_allocator
+{
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U> struct rebind
+  {
+    using other = tagged_allocator<U, Tag>;
+  };
+
+  static constexpr MemoryTag tag = Tag;
+
+  tagged_allocator() noexcept : resource_{memory_resource(Tag)}, counters_{&memory_counters(Tag)} {}
+
+  explicit tagged_allocator(std::pmr::memory_resource* resource) noexcept :
+      resource_{resource}, counters_{&memory_counters(Tag)}
+  {}
+
+  template <typename U>
+  tagged_allocator(const tagged_allocator<U, Tag>& other) noexcept :
+      resource_{other.resource()}, counters_{other.counters()}
+  {}
+
+  [[nodiscard]] T* allocate(std::size_t n)
+  {
+    const std::size_t bytes = n * sizeof(T);
+    T* ptr = static_cast<T*>(resource_->allocate(bytes, alignof(T)));
+    counters_->on_allocate(bytes);
+    return ptr;
+  }
+
+  void deallocate(T* ptr, std::size_t n)
+  {
+    const std::size_t bytes = n * sizeof(T);
+    resource_->deallocate(ptr, bytes, alignof(T));
+    counters_->on_deallocate(bytes);
+  }
+
+  [[nodiscard]] std::pmr::memory_resource* resource() const { return resource_; }
+
+  [[nodiscard]] MemoryCounters* counters() const { return counters_; }
+
+  template <typename U> bool operator==(const tagged_allocator<U, Tag>& other) const
+  {
+    return resource_ == other.resource();
+  }
+
+  template <typename U> bool operator!=(const tagged_allocator<U, Tag>& other) const { return !(*this == other); }
+
+private:
+  std::pmr::memory_resource* resource_;
+  MemoryCounters* counters_;
+};
+
+template <typename T> using allocator = tagged_allocator<T, MemoryTag::kDefault>;
+
+/**
+ * @brief Monotonic memory resource which hands out memory from large blocks
+ *
+ *        Deallocation is a no-op; all memory is reclaimed at once with ArenaMemoryResource::reset, which keeps
+ *        previously allocated blocks around for reuse. Suited to short-lived, per-frame scratch allocations.
+ *
+ * @note  not thread-safe
+ */
+class ArenaMemoryResource final : public std::pmr::memory_resource
+{
+public:
+  explicit ArenaMemoryResource(
+    std::size_t block_size = 64UL * 1024UL,
+    std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+  ~ArenaMemoryResource() override;
+
+  /**
+   * @brief Reclaims all memory handed out by this arena, without returning blocks to upstream
+   */
+  void reset();
+
+  /**
+   * @brief Returns all blocks to upstream
+   */
+  void release();
+
+  /**
+   * @brief Returns total bytes handed out since the last reset
+   */
+  [[nodiscard]] std::size_t used() const { return used_; }
+
+  /**
+   * @brief Returns total bytes of blocks held by this arena
+   */
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+private:
+  ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+  ArenaMemoryResource& operator=(const ArenaMemoryResource&) = delete;
+
+  struct block;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  std::size_t block_size_;
+  std::pmr::memory_resource* upstream_;
+  block* head_ = nullptr;
+  block* current_ = nullptr;
+  std::size_t offset_ = 0;
+  std::size_t used_ = 0;
+  std::size_t capacity_ = 0;
+};
+
+/**
+ * @brief Memory resource which recycles fixed-size chunks for small allocations
+ *
+ *        Allocations are rounded up to power-of-two size classes, each served from a free list. Allocations
+ *        larger than the largest size class are forwarded to upstream. Chunks are only returned to upstream
+ *        when the pool is destroyed (or released).
+ *
+ * @note  not thread-safe
+ */
+class PoolMemoryResource final : public std::pmr::memory_resource
+{
+public:
+  /// Smallest size class, in bytes
+  static constexpr std::size_t kMinChunkSize = 16UL;
+  /// Largest size class, in bytes
+  static constexpr std::size_t kMaxChunkSize = 4096UL;
+
+  explicit PoolMemoryResource(
+    std::size_t chunks_per_block = 64UL,
+    std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+  ~PoolMemoryResource() override;
+
+  /**
+   * @brief Returns all blocks to upstream
+   *
+   * @warning invalidates all memory handed out by this pool
+   */
+  void release();
+
+private:
+  PoolMemoryResource(const PoolMemoryResource&) = delete;
+  PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+
+  static constexpr std::size_t kSizeClassCount = 9UL;
+
+  struct chunk
+  {
+    chunk* next;
+  };
+
+  struct block
+  {
+    block* next;
+    std::size_t bytes;
+  };
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  std::size_t chunks_per_block_;
+  std::pmr::memory_resource* upstream_;
+  chunk* free_lists_[kSizeClassCount] = {};
+  block* blocks_ = nullptr;
+};
+
 }  // namespace sde
@@ -0,0 +1,171 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file profiler.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
+#include <string_view>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/vector.hpp"
+
+namespace sde
+{
+
+enum class ProfileTraceError
+{
+  kFileOpenFailed,
+  kFileWriteFailed,
+};
+
+std::ostream& operator<<(std::ostream& os, ProfileTraceError error);
+
+/// Number of scope entry and exit events held per thread; older events are overwritten
+static constexpr std::size_t kProfileEventCapacity = 1UL << 15UL;
+
+namespace detail
+{
+extern std::atomic<bool> profiling_enabled;
+}  // namespace detail
+
+/**
+ * @brief A completed profiled scope
+ */
+struct ProfileSpan
+{
+  /// Scope name
+  const char* name;
+  /// Index of the thread which recorded the scope
+  std::size_t thread;
+  /// Number of enclosing scopes on the same thread
+  std::size_t depth;
+  /// Time scope was entered, in nanoseconds since steady clock epoch
+  std::int64_t begin_ns;
+  /// Time scope was exited, in nanoseconds since steady clock epoch
+  std::int64_t end_ns;
+};
+
+/**
+ * @brief Enables or disables recording of profiled scopes at runtime; enabled by default
+ */
+void SetProfilingEnabled(bool enabled);
+
+/**
+ * @brief Returns true if profiled scopes are being recorded
+ */
+inline bool IsProfilingEnabled() { return detail::profiling_enabled.load(std::memory_order_relaxed); }
+
+/**
+ * @brief Names the calling thread in collected profiles
+ *
+ * @param name  thread name; must outlive all uses of the profiler (e.g. a string literal)
+ */
+void SetProfileThreadName(const char* name);
+
+/**
+ * @brief Returns the name given to thread \p thread with SetProfileThreadName, or \c nullptr if it has none
+ */
+const char* GetProfileThreadName(std::size_t thread);
+
+/**
+ * @brief Returns current time on the profiler clock, in nanoseconds since steady clock epoch
+ */
+std::int64_t ProfileNow();
+
+/**
+ * @brief Returns a copy of \p name which lives as long as the profiler, for naming scopes with runtime strings
+ *
+ * @note  copies are shared by equal names and are never released
+ */
+const char* ProfileName(std::string_view name);
+
+/**
+ * @brief Records entry into a profiled scope on the calling thread
+ *
+ * @param name  scope name; must outlive all uses of the profiler (e.g. a string literal, InternedString::c_str(), or
+ *              from ProfileName)
+ *
+ * @note  shared libraries which link their own copy of the profiler record into the profiler of the executable which
+ *        loads them only if it exports its symbols (e.g. is linked with -rdynamic)
+ */
+void ProfileBegin(const char* name);
+
+/**
+ * @brief Records exit from the innermost profiled scope on the calling thread
+ */
+void ProfileEnd();
+
+/**
+ * @brief Returns all recorded scopes, from all threads, which ended at or after \p since_ns
+ *
+ *        Each thread records into its own fixed-size ring of events, so only the most recent events of each thread
+ *        are available. Scopes which have not yet ended, or whose entry has been overwritten, are not returned.
+ *
+ * @return spans sorted by thread, then by entry time
+ */
+sde::vector<ProfileSpan> ProfileCollect(std::int64_t since_ns = std::numeric_limits<std::int64_t>::min());
+
+/**
+ * @brief Writes \p spans as Chrome \c trace_event JSON, which can be opened with chrome://tracing or Perfetto
+ */
+void WriteChromeTrace(std::ostream& os, std::span<const ProfileSpan> spans);
+
+/**
+ * @brief Writes \p spans as Chrome \c trace_event JSON to the file at \p path
+ */
+[[nodiscard]] expected<void, ProfileTraceError>
+WriteChromeTrace(const asset::path& path, std::span<const ProfileSpan> spans);
+
+/**
+ * @brief Records a profiled scope which lasts for the lifetime of this object
+ */
+class ProfileScope
+{
+public:
+  explicit ProfileScope(const char* name) : active_{IsProfilingEnabled()}
+  {
+    if (active_)
+    {
+      ProfileBegin(name);
+    }
+  }
+
+  ~ProfileScope()
+  {
+    if (active_)
+    {
+      ProfileEnd();
+    }
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+  /// Set if profiling was enabled on entry, so that entry and exit are always recorded in pairs
+  bool active_;
+};
+
+}  // namespace sde
+
+#ifdef SDE_PROFILING_DISABLED
+
+#define SDE_PROFILE_SCOPE(name) (void)0
+
+#else
+
+#define __SDE_PROFILE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define __SDE_PROFILE_CONCAT(lhs, rhs) __SDE_PROFILE_CONCAT_IMPL(lhs, rhs)
+#define SDE_PROFILE_SCOPE(name) const ::sde::ProfileScope __SDE_PROFILE_CONCAT(__sde_profile_scope_, __LINE__){name}
+
+#endif  // SDE_PROFILING_DISABLED
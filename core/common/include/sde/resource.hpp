@@ -40,7 +40,7 @@ template <typename T> struct BasicField
 
 template <typename T> constexpr Hash Version(const BasicField<T>& field)
 {
-  return ComputeHash(std::string_view{field.name}) + ComputeTypeHash<T>();
+  return Hash{ComputeBytesHashValue(std::string_view{field.name})} + ComputeTypeHash<T>();
 }
 
 template <typename L, typename R> constexpr bool operator==(const BasicField<L>& lhs, const BasicField<R>& rhs)
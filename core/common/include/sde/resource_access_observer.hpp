@@ -0,0 +1,31 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file resource_access_observer.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <string_view>
+
+namespace sde
+{
+
+/**
+ * @brief Notified of cache accesses made through a ResourceCollection
+ */
+class ResourceAccessObserver
+{
+public:
+  virtual ~ResourceAccessObserver() = default;
+
+  /**
+   * @brief Called on each access to a cache
+   *
+   * @param label  label of the accessed cache
+   * @param write  true if the cache was accessed mutably
+   */
+  virtual void onAccess(std::string_view label, bool write) = 0;
+};
+
+}  // namespace sde
@@ -0,0 +1,248 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file resource_bundle.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/hash.hpp"
+#include "sde/resource_cache.hpp"
+#include "sde/resource_io.hpp"
+#include "sde/serialization_binary_file.hpp"
+#include "sde/vector.hpp"
+
+namespace sde
+{
+
+enum class ResourceBundleError
+{
+  kFileDoesNotExist,
+  kFileOpenFailed,
+  kFileWriteFailed,
+  kInvalidHeader,
+  kInvalidIndex,
+  kInvalidElement,
+  kDuplicateElement,
+};
+
+std::ostream& operator<<(std::ostream& os, ResourceBundleError error);
+
+enum class ResourceBundleLoadMode
+{
+  /// Read all elements up front
+  kEager,
+  /// Read each element when it is first accessed from its cache
+  kLazy,
+};
+
+std::ostream& operator<<(std::ostream& os, ResourceBundleLoadMode mode);
+
+/**
+ * @brief Resource bundle file header
+ */
+struct ResourceBundleHeader
+{
+  static constexpr std::size_t kMagic = 0x314C444E42454453UL;  // "SDEBNDL1"
+
+  std::size_t magic = kMagic;
+  /// Number of entries in the index
+  std::size_t entry_count = 0;
+  /// Offset of the index from the start of the file, in bytes
+  std::size_t index_offset = 0;
+};
+
+/**
+ * @brief Describes where a single serialized cache element lives in a resource bundle
+ */
+struct ResourceBundleEntry
+{
+  /// Type hash of the cache which owns the element
+  std::size_t cache_type;
+  /// Handle ID of the element
+  std::size_t handle;
+  /// Offset of the serialized value from the start of the file, in bytes
+  std::size_t offset;
+  /// Length of the serialized value, in bytes
+  std::size_t length;
+  /// Element version
+  Hash version;
+
+  constexpr bool operator<(const ResourceBundleEntry& other) const
+  {
+    return (cache_type < other.cache_type) or ((cache_type == other.cache_type) and (handle < other.handle));
+  }
+};
+
+/**
+ * @brief Writes cache elements to a resource bundle file
+ *
+ *        A resource bundle is laid out as a ResourceBundleHeader, followed by each element value serialized
+ *        back-to-back, followed by an index of ResourceBundleEntry sorted by {cache_type, handle}. The index lets
+ *        readers find and read any single element without touching the rest of the file.
+ */
+class ResourceBundleWriter
+{
+public:
+  static expected<ResourceBundleWriter, ResourceBundleError> create(const asset::path& path);
+
+  /**
+   * @brief Writes all elements of \p cache , materializing deferred elements first
+   */
+  template <typename CacheT> void write(const ResourceCache<CacheT>& cache)
+  {
+    cache.materialize();
+    for (const auto& [handle, element] : cache)
+    {
+      const std::size_t offset = stream_.tell();
+      {
+        serial::binary_oarchive oar{stream_};
+        oar << serial::named{"value", element.value};
+      }
+      index_.push_back(
+        {.cache_type = type_hash_value_v<CacheT>,
+         .handle = handle.id(),
+         .offset = offset,
+         .length = stream_.tell() - offset,
+         .version = element.version});
+    }
+  }
+
+  /**
+   * @brief Writes bundle index and header; must be called once all caches have been written
+   *
+   * @return ResourceBundleError::kFileWriteFailed if the bundle could not be completely written out
+   */
+  [[nodiscard]] expected<void, ResourceBundleError> finish();
+
+  ResourceBundleWriter(ResourceBundleWriter&&) = default;
+
+private:
+  explicit ResourceBundleWriter(serial::file_ostream&& stream);
+
+  /// Bundle file
+  serial::file_ostream stream_;
+  /// Entries of all written elements
+  sde::vector<ResourceBundleEntry> index_;
+};
+
+/**
+ * @brief Read-only view of a resource bundle file
+ *
+ *        Only the index is read when a bundle is opened; element values are read from a memory mapping of the file
+ *        on load. Lazily loaded caches share ownership of the mapping, so the bundle itself may be destroyed first.
+ *
+ * @note  reads are not thread-safe, including reads triggered by accessing lazily loaded elements
+ */
+class ResourceBundle
+{
+public:
+  static expected<ResourceBundle, ResourceBundleError> open(const asset::path& path);
+
+  /**
+   * @brief Returns entries for all elements in the bundle, sorted by {cache_type, handle}
+   */
+  [[nodiscard]] std::span<const ResourceBundleEntry> entries() const { return {index_.data(), index_.size()}; }
+
+  /**
+   * @brief Returns entries for all elements of \p CacheT , sorted by handle
+   */
+  template <typename CacheT> [[nodiscard]] std::span<const ResourceBundleEntry> entries() const
+  {
+    const auto [first, last] = std::equal_range(
+      std::begin(index_),
+      std::end(index_),
+      ResourceBundleEntry{.cache_type = type_hash_value_v<CacheT>, .handle = 0},
+      [](const auto& lhs, const auto& rhs) { return lhs.cache_type < rhs.cache_type; });
+    return {first, last};
+  }
+
+  /**
+   * @brief Adds all elements of \p CacheT in this bundle to \p cache
+   *
+   *        In ResourceBundleLoadMode::kLazy mode, elements are added as deferred elements (see ResourceCache::defer),
+   *        and are only read on first access. In either mode, ResourceCache::refresh should be called afterwards,
+   *        as with the sequential cache loader.
+   *
+   * @return number of elements added
+   */
+  template <typename CacheT>
+  [[nodiscard]] expected<std::size_t, ResourceBundleError>
+  load(ResourceCache<CacheT>& cache, ResourceBundleLoadMode mode = ResourceBundleLoadMode::kEager) const
+  {
+    using handle_type = typename ResourceCache<CacheT>::handle_type;
+    using value_type = typename ResourceCache<CacheT>::value_type;
+
+    const auto cache_entries = this->template entries<CacheT>();
+    for (const auto& entry : cache_entries)
+    {
+      const handle_type handle{entry.handle};
+      if (mode == ResourceBundleLoadMode::kLazy)
+      {
+        auto loader = [stream = stream_, entry](value_type& value) { return read_element(*stream, entry, value); };
+        if (!cache.defer(handle, entry.version, std::move(loader)).has_value())
+        {
+          return make_unexpected(ResourceBundleError::kDuplicateElement);
+        }
+        continue;
+      }
+
+      value_type value;
+      if (!read_element(*stream_, entry, value))
+      {
+        return make_unexpected(ResourceBundleError::kInvalidElement);
+      }
+      else if (!cache.insert(handle, entry.version, std::move(value)).has_value())
+      {
+        return make_unexpected(ResourceBundleError::kDuplicateElement);
+      }
+    }
+    return cache_entries.size();
+  }
+
+  ResourceBundle(ResourceBundle&&) = default;
+  ResourceBundle& operator=(ResourceBundle&&) = default;
+
+private:
+  ResourceBundle(std::shared_ptr<serial::mmap_istream> stream, sde::vector<ResourceBundleEntry>&& index);
+
+  template <typename ValueT>
+  [[nodiscard]] static bool read_element(serial::mmap_istream& stream, const ResourceBundleEntry& entry, ValueT& value)
+  {
+    if (!stream.seek(entry.offset))
+    {
+      return false;
+    }
+    serial::binary_iarchive iar{stream};
+    iar >> serial::named{"value", value};
+    return stream.tell() == (entry.offset + entry.length);
+  }
+
+  /// Mapped bundle file
+  std::shared_ptr<serial::mmap_istream> stream_;
+  /// Entries of all elements in the bundle
+  sde::vector<ResourceBundleEntry> index_;
+};
+
+}  // namespace sde
+
+namespace sde::serial
+{
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, ResourceBundleHeader> : std::true_type
+{};
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, ResourceBundleEntry> : std::true_type
+{};
+
+}  // namespace sde::serial
@@ -6,8 +6,12 @@
 #pragma once
 
 // C++ Standard Library
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <iosfwd>
+#include <mutex>
+#include <optional>
 #include <type_traits>
 
 // Dont
@@ -18,6 +22,7 @@
 #include "sde/expected.hpp"
 #include "sde/hash.hpp"
 #include "sde/memory.hpp"
+#include "sde/profiler.hpp"
 #include "sde/resource.hpp"
 #include "sde/resource_cache_traits.hpp"
 #include "sde/resource_handle.hpp"
@@ -135,6 +140,24 @@ public:
   >;
   // clang-format on
 
+  /// Reads the value of a deferred element; returns false on failure
+  using deferred_loader = std::function<bool(value_type&)>;
+
+  struct deferred_element
+  {
+    version_type version;
+    deferred_loader load;
+  };
+
+  // clang-format off
+  using DeferredElementMap = sde::unordered_map<
+    handle_type,
+    deferred_element,
+    handle_type_hash,
+    std::equal_to<handle_type>
+  >;
+  // clang-format on
+
   template <typename... CreateArgTs>
   [[nodiscard]] expected<element_ref, error_type> create(dependencies deps, CreateArgTs&&... args)
   {
@@ -158,7 +181,7 @@ public:
       return create(deps, std::forward<CreateArgTs>(args)...);
     }
 
-    const auto itr = handle_to_value_cache_.find(handle);
+    const auto itr = this->find_element(handle);
     if (itr == handle_to_value_cache_.end())
     {
       return create_at_handle(handle, deps, std::forward<CreateArgTs>(args)...);
@@ -177,7 +200,7 @@ public:
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
 
-    const auto itr = handle_to_value_cache_.find(handle);
+    const auto itr = this->find_element(handle);
 
     if (itr == handle_to_value_cache_.end())
     {
@@ -222,6 +245,10 @@ public:
     {
       return make_unexpected(error_type::kInvalidHandle);
     }
+    else if (deferred_elements_.count(handle) != 0)
+    {
+      return make_unexpected(error_type::kElementAlreadyExists);
+    }
 
     // clang-format off
     // Add it to the cache
@@ -242,10 +269,53 @@ public:
     return make_unexpected(error_type::kElementAlreadyExists);
   }
 
+  /**
+   * @brief Adds an element whose value is only read, using \p loader , when it is first accessed
+   *
+   *        Deferred elements count as existing, but are not part of size() or iteration until they are
+   *        materialized. If the cache has been refreshed, materialized elements are reloaded with the dependencies
+   *        given to the last refresh call, which must still be valid at that point.
+   */
+  template <typename HandleT>
+  [[nodiscard]] expected<void, error_type> defer(HandleT&& handle_or, version_type version, deferred_loader loader)
+  {
+    const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
+    if (handle.isNull())
+    {
+      return make_unexpected(error_type::kInvalidHandle);
+    }
+    else if (handle_to_value_cache_.count(handle) != 0)
+    {
+      return make_unexpected(error_type::kElementAlreadyExists);
+    }
+    else if (!deferred_elements_.emplace(handle, deferred_element{version, std::move(loader)}).second)
+    {
+      return make_unexpected(error_type::kElementAlreadyExists);
+    }
+    deferred_count_.fetch_add(1, std::memory_order_release);
+    handle_lower_bound_ = std::max(handle_lower_bound_, handle);
+    return {};
+  }
+
+  /**
+   * @brief Materializes all deferred elements
+   *
+   * @note  must be called before iterating over the cache while other threads may be looking up elements
+   */
+  void materialize() const
+  {
+    const auto lock = this->lock_deferred();
+    auto& self = const_cast<ResourceCache&>(*this);
+    while (!self.deferred_elements_.empty())
+    {
+      [[maybe_unused]] const auto _ = self.materialize_element(std::begin(self.deferred_elements_)->first);
+    }
+  }
+
   template <typename HandleT> [[nodiscard]] const value_type* get_if(HandleT&& handle_or) const
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    if (auto itr = handle_to_value_cache_.find(handle); itr != std::end(handle_to_value_cache_))
+    if (auto itr = this->find_element(handle); itr != std::end(handle_to_value_cache_))
     {
       return std::addressof(itr->second.value);
     }
@@ -267,13 +337,14 @@ public:
   template <typename HandleT> [[nodiscard]] bool exists(HandleT&& handle_or) const
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    return handle_to_value_cache_.count(handle) != 0;
+    const auto lock = this->lock_deferred();
+    return (handle_to_value_cache_.count(handle) != 0) or (deferred_elements_.count(handle) != 0);
   }
 
   template <typename HandleT> [[nodiscard]] expected<void, error_type> borrow(HandleT&& handle_or)
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    const auto itr = handle_to_value_cache_.find(handle);
+    const auto itr = this->find_element(handle);
     if (itr == std::end(handle_to_value_cache_))
     {
       return make_unexpected(error_type::kInvalidHandle);
@@ -285,7 +356,7 @@ public:
   template <typename HandleT> [[nodiscard]] expected<void, error_type> restore(HandleT&& handle_or)
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    const auto itr = handle_to_value_cache_.find(handle);
+    const auto itr = this->find_element(handle);
     if (itr == std::end(handle_to_value_cache_))
     {
       return make_unexpected(error_type::kInvalidHandle);
@@ -298,7 +369,11 @@ public:
     return {};
   }
 
-  [[nodiscard]] bool empty() const { return handle_to_value_cache_.empty(); }
+  [[nodiscard]] bool empty() const
+  {
+    const auto lock = this->lock_deferred();
+    return handle_to_value_cache_.empty() and deferred_elements_.empty();
+  }
 
   [[nodiscard]] const auto& cache() const { return handle_to_value_cache_; }
 
@@ -306,10 +381,17 @@ public:
 
   [[nodiscard]] const auto end() const { return std::end(handle_to_value_cache_); }
 
-  [[nodiscard]] std::size_t size() const { return handle_to_value_cache_.size(); }
+  [[nodiscard]] std::size_t size() const
+  {
+    const auto lock = this->lock_deferred();
+    return handle_to_value_cache_.size();
+  }
+
+  [[nodiscard]] std::size_t deferred_size() const { return deferred_count_.load(std::memory_order_acquire); }
 
   [[nodiscard]] expected<void, error_type> refresh(dependencies deps)
   {
+    deferred_dependencies_ = deps;
     for (auto& [handle, element] : handle_to_value_cache_)
     {
       if (auto ok_or_error = this->derived().reload(deps, element.value); !ok_or_error.has_value())
@@ -326,6 +408,7 @@ public:
 
   [[nodiscard]] expected<void, error_type> relinquish(dependencies deps)
   {
+    deferred_dependencies_.reset();
     for (auto& [handle, element] : handle_to_value_cache_)
     {
       if (!on_removal(deps, handle, std::addressof(element.value)))
@@ -343,7 +426,7 @@ public:
   template <typename HandleT, typename UpdateFn> void update_if_exists(HandleT&& handle_or, UpdateFn update)
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    const auto handle_to_value_itr = handle_to_value_cache_.find(handle);
+    const auto handle_to_value_itr = this->find_element(handle);
     if (handle_to_value_itr != handle_to_value_cache_.end())
     {
       update(handle_to_value_itr->second.value);
@@ -354,12 +437,17 @@ public:
   {
     std::swap(this->handle_lower_bound_, other.handle_lower_bound_);
     std::swap(this->handle_to_value_cache_, other.handle_to_value_cache_);
+    std::swap(this->deferred_elements_, other.deferred_elements_);
+    std::swap(this->deferred_dependencies_, other.deferred_dependencies_);
+    this->deferred_count_.store(
+      other.deferred_count_.exchange(this->deferred_count_.load(std::memory_order_relaxed), std::memory_order_relaxed),
+      std::memory_order_relaxed);
   }
 
   template <typename HandleT> expected<void, error_type> remove(HandleT&& handle_or, dependencies deps)
   {
     const auto handle = this->derived().to_handle(std::forward<HandleT>(handle_or));
-    const auto itr = handle_to_value_cache_.find(handle);
+    const auto itr = this->find_element(handle);
     if (itr == std::end(handle_to_value_cache_))
     {
       return make_unexpected(error_type::kInvalidHandle);
@@ -403,6 +491,9 @@ public:
       }
     }
     handle_to_value_cache_.clear();
+    deferred_elements_.clear();
+    deferred_count_.store(0, std::memory_order_relaxed);
+    deferred_dependencies_.reset();
     handle_lower_bound_ = handle_type::null();
     return true;
   }
@@ -426,6 +517,19 @@ protected:
   /// Map of {resource_handle, resource_value} objects
   ElementMap handle_to_value_cache_;
 
+  /// Map of {resource_handle, loader} objects for elements which have not been read yet
+  DeferredElementMap deferred_elements_;
+
+  /// Dependencies used to reload elements materialized after a refresh
+  std::optional<dependencies> deferred_dependencies_;
+
+  /// Number of elements in deferred_elements_; lookups only lock deferred_mutex_ while this is non-zero
+  std::atomic<std::size_t> deferred_count_ = 0;
+
+  /// Serializes materialization of deferred elements from const lookups; recursive, since reloading an element may
+  /// look up other elements of the same cache
+  mutable std::recursive_mutex deferred_mutex_;
+
 private:
   ResourceCache(const ResourceCache&) = delete;
   ResourceCache& operator=(const ResourceCache&) = delete;
@@ -434,13 +538,14 @@ private:
   [[nodiscard]] expected<element_ref, error_type>
   create_at_handle(handle_type handle, dependencies deps, CreateArgTs&&... args)
   {
-    if (handle.isNull())
+    if (handle.isNull() or (deferred_elements_.count(handle) != 0))
     {
       return make_unexpected(error_type::kInvalidHandle);
     }
     const auto current_version = ComputeHash(args...);
 
     // Create a new element
+    SDE_PROFILE_SCOPE("ResourceCache::generate");
     auto value_or_error = this->derived().generate(deps, std::forward<CreateArgTs>(args)...);
     if (!value_or_error.has_value())
     {
@@ -469,6 +574,89 @@ private:
     return make_unexpected(error_type::kInvalidHandle);
   }
 
+  /**
+   * @brief Returns a lock on deferred_mutex_ if any elements are deferred; otherwise, an unlocked lock
+   *
+   *        Deferred elements are only added through non-const methods, which may not be called concurrently with
+   *        lookups, so lookups which see no deferred elements can not race with materialization.
+   */
+  [[nodiscard]] std::unique_lock<std::recursive_mutex> lock_deferred() const
+  {
+    if (deferred_count_.load(std::memory_order_acquire) == 0)
+    {
+      return std::unique_lock{deferred_mutex_, std::defer_lock};
+    }
+    return std::unique_lock{deferred_mutex_};
+  }
+
+  /**
+   * @brief Finds an element, materializing it first if it is deferred; failed loads are treated as missing
+   *
+   * @note  materialized elements are logically already part of the cache, so this is allowed from const accessors.
+   *        While any elements are deferred, lookups are serialized by deferred_mutex_ so that concurrent const
+   *        lookups are safe; once all elements are materialized, lookups take no lock.
+   */
+  [[nodiscard]] typename ElementMap::iterator find_element(handle_type handle) const
+  {
+    const auto lock = this->lock_deferred();
+    auto& self = const_cast<ResourceCache&>(*this);
+    if (auto itr = self.handle_to_value_cache_.find(handle); itr != std::end(self.handle_to_value_cache_))
+    {
+      return itr;
+    }
+    return lock.owns_lock() ? self.materialize_element(handle) : std::end(self.handle_to_value_cache_);
+  }
+
+  /**
+   * @brief Moves a deferred element into the cache
+   *
+   * @note  requires a lock on deferred_mutex_ when called from a const method
+   */
+  [[nodiscard]] typename ElementMap::iterator materialize_element(handle_type handle)
+  {
+    const auto deferred_itr = deferred_elements_.find(handle);
+    if (deferred_itr == std::end(deferred_elements_))
+    {
+      return std::end(handle_to_value_cache_);
+    }
+
+    auto deferred = std::move(deferred_itr->second);
+    deferred_elements_.erase(deferred_itr);
+    const auto itr = this->load_deferred_element(handle, deferred);
+
+    // Released after the element is added, so that lookups which see no deferred elements also see the element
+    deferred_count_.fetch_sub(1, std::memory_order_release);
+    return itr;
+  }
+
+  [[nodiscard]] typename ElementMap::iterator load_deferred_element(handle_type handle, deferred_element& deferred)
+  {
+    value_type value;
+    if (!deferred.load(value))
+    {
+      return std::end(handle_to_value_cache_);
+    }
+
+    const auto [itr, added] = handle_to_value_cache_.emplace(
+      std::piecewise_construct,
+      std::forward_as_tuple(handle),
+      std::forward_as_tuple(deferred.version, std::move(value)));
+
+    // Reload as refresh would have, had this element been loaded eagerly
+    if (!deferred_dependencies_.has_value())
+    {
+      return itr;
+    }
+    else if (
+      this->derived().reload(*deferred_dependencies_, itr->second.value).has_value() and
+      on_creation(*deferred_dependencies_, itr->first, std::addressof(itr->second.value)))
+    {
+      return itr;
+    }
+    handle_to_value_cache_.erase(itr);
+    return std::end(handle_to_value_cache_);
+  }
+
   template <typename Iterator, typename... CreateArgTs>
   [[nodiscard]] expected<element_ref, error_type>
   replace_at_position(Iterator itr, dependencies deps, CreateArgTs&&... args)
@@ -476,6 +664,7 @@ private:
     const auto current_version = ComputeHash(args...);
 
     // Create a new element
+    SDE_PROFILE_SCOPE("ResourceCache::generate");
     auto value_or_error = this->derived().generate(deps, std::forward<CreateArgTs>(args)...);
     if (!value_or_error.has_value())
     {
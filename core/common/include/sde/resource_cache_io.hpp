@@ -18,6 +18,7 @@ template <typename Archive, typename CacheT> struct save<Archive, ResourceCache<
 {
   void operator()(Archive& ar, const ResourceCache<CacheT>& cache) const
   {
+    cache.materialize();
     ar << named{"element_count", cache.size()};
     for (const auto& [handle, element] : cache)
     {
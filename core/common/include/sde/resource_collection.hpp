@@ -16,6 +16,7 @@
 
 // SDE
 #include "sde/resource.hpp"
+#include "sde/resource_access_observer.hpp"
 #include "sde/resource_cache.hpp"
 #include "sde/resource_handle.hpp"
 
@@ -109,15 +110,28 @@ public:
   template <typename CacheT> constexpr CacheT& get()
   {
     using EntryType = dont::map_lookup_t<cache_to_entry_map, CacheT>;
+    if (access_observer_ != nullptr)
+    {
+      access_observer_->onAccess(EntryType::name(), true);
+    }
     return std::get<EntryType>(caches_).cache;
   }
 
   template <typename CacheT> constexpr const CacheT& get() const
   {
     using EntryType = dont::map_lookup_t<cache_to_entry_map, CacheT>;
+    if (access_observer_ != nullptr)
+    {
+      access_observer_->onAccess(EntryType::name(), false);
+    }
     return std::get<EntryType>(caches_).cache;
   }
 
+  /**
+   * @brief Sets an observer which is notified of every access through get(); \c nullptr to disable
+   */
+  void setAccessObserver(ResourceAccessObserver* observer) { access_observer_ = observer; }
+
   constexpr auto all() { return ResourceDependencies{std::get<ResourceCollectionEntryTs>(caches_).cache...}; }
 
   constexpr operator ResourceDependencies<typename ResourceCollectionEntryTs::type...>()
@@ -262,6 +276,8 @@ public:
 private:
   std::tuple<ResourceCollectionEntryTs...> caches_;
 
+  ResourceAccessObserver* access_observer_ = nullptr;
+
   auto field_list() { return FieldList(std::get<ResourceCollectionEntryTs>(caches_).as_field()...); }
 };
 
@@ -0,0 +1,150 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file resource_content.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/hash.hpp"
+#include "sde/time.hpp"
+#include "sde/unordered_map.hpp"
+
+namespace sde
+{
+
+/**
+ * @brief Computes a (non-cryptographic) hash over a block of bytes
+ */
+Hash ComputeContentHash(const void* data, std::size_t len);
+
+/**
+ * @brief Computes a (non-cryptographic) hash over the raw bytes of a file
+ *
+ * @return hash of file contents; nullopt if file could not be read
+ */
+std::optional<Hash> ComputeContentHash(const asset::path& path);
+
+/**
+ * @brief Statistics collected by a ResourceContentIndex
+ */
+struct ResourceContentStats
+{
+  /// Number of loads which decoded new content
+  std::size_t decode_count = 0;
+  /// Number of loads which were aliased to previously decoded content
+  std::size_t alias_count = 0;
+  /// Total bytes of decoded data which were shared instead of re-allocated
+  std::size_t bytes_saved = 0;
+  /// Total decode time skipped by sharing previously decoded data
+  TimeOffset decode_time_saved = TimeOffset::zero();
+};
+
+std::ostream& operator<<(std::ostream& os, const ResourceContentStats& stats);
+
+/**
+ * @brief Default (empty) decode meta-information for ResourceContentIndex
+ */
+struct ResourceContentNoInfo
+{};
+
+/**
+ * @brief Maps content hashes to decoded data, shared between resources with identical content
+ *
+ *        Decoded data is reference counted through a \c std::shared_ptr<void> ; the index itself
+ *        only holds weak references, so content is released once the last resource using it is
+ *        unloaded. Content is only aliased while the index is enabled.
+ *
+ * @tparam InfoT  meta-information about decoded data required to restore an aliased resource
+ */
+template <typename InfoT = ResourceContentNoInfo> class ResourceContentIndex
+{
+public:
+  /**
+   * @brief Shared decoded data and its associated meta-information
+   */
+  struct content
+  {
+    std::shared_ptr<void> data;
+    InfoT info;
+  };
+
+  /**
+   * @brief Enables or disables content aliasing
+   */
+  void enable(bool enabled) { enabled_ = enabled; }
+
+  /**
+   * @brief Returns true if content aliasing is enabled
+   */
+  [[nodiscard]] bool enabled() const { return enabled_; }
+
+  /**
+   * @brief Returns previously decoded content matching \p key, if it is still alive
+   */
+  [[nodiscard]] std::optional<content> find(const Hash& key)
+  {
+    const auto itr = key_to_content_.find(key);
+    if (itr == std::end(key_to_content_))
+    {
+      return std::nullopt;
+    }
+    else if (auto data = itr->second.data.lock(); data != nullptr)
+    {
+      ++stats_.alias_count;
+      stats_.bytes_saved += itr->second.bytes;
+      stats_.decode_time_saved += itr->second.decode_time;
+      return content{std::move(data), itr->second.info};
+    }
+    key_to_content_.erase(itr);
+    return std::nullopt;
+  }
+
+  /**
+   * @brief Registers newly decoded content under \p key
+   */
+  void insert(const Hash& key, const content& decoded, std::size_t bytes, TimeOffset decode_time)
+  {
+    ++stats_.decode_count;
+    key_to_content_.insert_or_assign(
+      key, entry{.data = decoded.data, .info = decoded.info, .bytes = bytes, .decode_time = decode_time});
+  }
+
+  /**
+   * @brief Returns content aliasing statistics
+   */
+  [[nodiscard]] const ResourceContentStats& stats() const { return stats_; }
+
+  /**
+   * @brief Returns number of indexed content entries (including ones which may have expired)
+   */
+  [[nodiscard]] std::size_t size() const { return key_to_content_.size(); }
+
+private:
+  struct entry
+  {
+    std::weak_ptr<void> data;
+    InfoT info;
+    std::size_t bytes;
+    TimeOffset decode_time;
+  };
+
+  struct key_hash
+  {
+    std::size_t operator()(const Hash& h) const { return h.value; }
+  };
+
+  bool enabled_ = false;
+  ResourceContentStats stats_;
+  sde::unordered_map<Hash, entry, key_hash> key_to_content_;
+};
+
+}  // namespace sde
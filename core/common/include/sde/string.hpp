@@ -6,6 +6,8 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -18,4 +20,28 @@ namespace sde
 
 using string = std::basic_string<char, std::char_traits<char>, allocator<char>>;
 
+/**
+ * @brief Transparent string hash, for looking up \c sde::string keys with \c std::string_view
+ *
+ * @note  use with \c std::equal_to<> ; for example, \c sde::unordered_map<sde::string, V, string_hash, std::equal_to<>>
+ */
+struct string_hash
+{
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+};
+
 }  // namespace sde
+
+namespace std
+{
+template <typename CharT, typename Traits, ::sde::MemoryTag Tag>
+struct hash<basic_string<CharT, Traits, ::sde::tagged_allocator<CharT, Tag>>>
+{
+  std::size_t operator()(const basic_string<CharT, Traits, ::sde::tagged_allocator<CharT, Tag>>& str) const
+  {
+    return std::hash<std::basic_string_view<CharT, Traits>>{}(str);
+  }
+};
+}  // namespace std
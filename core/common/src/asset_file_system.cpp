@@ -0,0 +1,78 @@
+// C++ Standard Library
+#include <ostream>
+
+// SDE
+#include "sde/asset_file_system.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+namespace
+{
+
+std::optional<asset::path> relative_to_root(const asset::path& path, const asset::path& root)
+{
+  if (root.empty())
+  {
+    return path;
+  }
+  auto relative = path.lexically_normal().lexically_relative(root.lexically_normal());
+  if (relative.empty() or (*relative.begin() == ".."))
+  {
+    return std::nullopt;
+  }
+  return relative;
+}
+
+}  // namespace
+
+void AssetFileSystem::mount(std::shared_ptr<const AssetPack> pack, const asset::path& root)
+{
+  SDE_ASSERT_NE(pack, nullptr);
+  SDE_LOG_INFO() << "Mounted asset pack: " << SDE_OSNV(root) << ", " << SDE_OSNV(pack->size());
+  mounts_.push_back({.root = root, .pack = std::move(pack)});
+}
+
+std::optional<AssetData> AssetFileSystem::find_packed(const asset::path& path) const
+{
+  for (auto itr = mounts_.rbegin(); itr != mounts_.rend(); ++itr)
+  {
+    const auto relative = relative_to_root(path, itr->root);
+    if (!relative.has_value())
+    {
+      continue;
+    }
+    else if (const auto bytes = itr->pack->find(*relative); bytes.has_value())
+    {
+      return AssetData{.bytes = *bytes, .owner = itr->pack};
+    }
+  }
+  return std::nullopt;
+}
+
+bool AssetFileSystem::exists(const asset::path& path) const { return packed(path) or asset::exists(path); }
+
+expected<AssetData, AssetPackError> AssetFileSystem::read(const asset::path& path) const
+{
+  if (auto data = find_packed(path); data.has_value())
+  {
+    return std::move(data).value();
+  }
+
+  auto ifs_or_error = serial::mmap_istream::create(path);
+  if (!ifs_or_error.has_value())
+  {
+    if (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist)
+    {
+      return make_unexpected(AssetPackError::kFileDoesNotExist);
+    }
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AssetPackError::kFileOpenFailed);
+  }
+
+  auto stream = std::make_shared<serial::mmap_istream>(std::move(ifs_or_error).value());
+  const auto bytes = stream->read_view(stream->available());
+  return AssetData{.bytes = bytes, .owner = std::move(stream)};
+}
+
+}  // namespace sde
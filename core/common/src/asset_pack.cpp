@@ -0,0 +1,293 @@
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ostream>
+
+// SDE
+#include "sde/asset_pack.hpp"
+#include "sde/hash.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+
+std::ostream& operator<<(std::ostream& os, AssetPackError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(AssetPackError::kFileDoesNotExist)
+    SDE_OS_ENUM_CASE(AssetPackError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(AssetPackError::kFileWriteFailed)
+    SDE_OS_ENUM_CASE(AssetPackError::kInvalidHeader)
+    SDE_OS_ENUM_CASE(AssetPackError::kInvalidTable)
+    SDE_OS_ENUM_CASE(AssetPackError::kInvalidDirectory)
+    SDE_OS_ENUM_CASE(AssetPackError::kInvalidPath)
+    SDE_OS_ENUM_CASE(AssetPackError::kDuplicatePath)
+  }
+  return os;
+}
+
+sde::string AssetPackPathKey(const asset::path& path)
+{
+  const auto key = path.lexically_normal().generic_string();
+  return sde::string{std::string_view{key}};
+}
+
+std::uint64_t AssetPackPathHash(std::string_view key) { return ComputeBytesHashValue(key); }
+
+AssetPackWriter::AssetPackWriter(serial::file_ostream&& stream) : stream_{std::move(stream)}
+{
+  // Placeholder header, re-written by AssetPackWriter::finish
+  const AssetPackHeader header;
+  serial::binary_oarchive oar{stream_};
+  oar << serial::named{"header", header};
+}
+
+expected<AssetPackWriter, AssetPackError> AssetPackWriter::create(const asset::path& path)
+{
+  auto ofs_or_error = serial::file_ostream::create(
+    path, serial::file_ostream::default_flags, serial::file_ostream::default_block_size);
+  if (!ofs_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AssetPackError::kFileOpenFailed);
+  }
+  return AssetPackWriter{std::move(ofs_or_error).value()};
+}
+
+bool AssetPackWriter::pad(std::size_t alignment)
+{
+  static constexpr std::array<std::byte, AssetPackWriter::kDataAlignment> kZeros{};
+  const std::size_t remainder = stream_.tell() % alignment;
+  if (remainder == 0)
+  {
+    return true;
+  }
+  const std::size_t padding = alignment - remainder;
+  return stream_.write(kZeros.data(), padding) == padding;
+}
+
+expected<void, AssetPackError> AssetPackWriter::add(const asset::path& pack_path, std::span<const std::byte> data)
+{
+  auto key = AssetPackPathKey(pack_path);
+  if (key.empty() or (key == ".") or (key.front() == '/') or key.starts_with(".."))
+  {
+    SDE_LOG_ERROR() << "InvalidPath: " << SDE_OSNV(pack_path);
+    return make_unexpected(AssetPackError::kInvalidPath);
+  }
+
+  if (!pad(kDataAlignment))
+  {
+    return make_unexpected(AssetPackError::kFileWriteFailed);
+  }
+
+  const std::size_t data_offset = stream_.tell();
+  if (stream_.write(data.data(), data.size()) != data.size())
+  {
+    return make_unexpected(AssetPackError::kFileWriteFailed);
+  }
+
+  table_.push_back(
+    {.path_hash = AssetPackPathHash(key),
+     .path_offset = 0,
+     .path_length = key.size(),
+     .data_offset = data_offset,
+     .data_length = data.size()});
+  keys_.push_back(std::move(key));
+  return {};
+}
+
+expected<void, AssetPackError> AssetPackWriter::add_file(const asset::path& pack_path, const asset::path& file_path)
+{
+  auto ifs_or_error = serial::mmap_istream::create(file_path);
+  if (!ifs_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(file_path);
+    return make_unexpected(
+      (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist) ? AssetPackError::kFileDoesNotExist
+                                                                            : AssetPackError::kFileOpenFailed);
+  }
+  return add(pack_path, ifs_or_error->read_view(ifs_or_error->available()));
+}
+
+expected<std::size_t, AssetPackError> AssetPackWriter::add_directory(const asset::path& directory)
+{
+  if (!asset::is_directory(directory))
+  {
+    SDE_LOG_ERROR() << "InvalidDirectory: " << SDE_OSNV(directory);
+    return make_unexpected(AssetPackError::kInvalidDirectory);
+  }
+
+  // Sort files so that pack contents do not depend on directory iteration order
+  sde::vector<asset::path> file_paths;
+  for (const auto& entry : asset::recursive_directory_iterator{directory})
+  {
+    if (entry.is_regular_file())
+    {
+      file_paths.push_back(entry.path());
+    }
+  }
+  std::sort(std::begin(file_paths), std::end(file_paths));
+
+  for (const auto& file_path : file_paths)
+  {
+    if (auto ok_or_error = add_file(file_path.lexically_relative(directory), file_path); !ok_or_error.has_value())
+    {
+      return make_unexpected(ok_or_error.error());
+    }
+  }
+  return file_paths.size();
+}
+
+expected<void, AssetPackError> AssetPackWriter::finish()
+{
+  // Order entries by {path_hash, key} so that colliding hashes are stored next to each other
+  sde::vector<std::size_t> order(table_.size());
+  std::iota(std::begin(order), std::end(order), 0UL);
+  std::sort(std::begin(order), std::end(order), [this](std::size_t lhs, std::size_t rhs) {
+    return (table_[lhs].path_hash < table_[rhs].path_hash) or
+      ((table_[lhs].path_hash == table_[rhs].path_hash) and (keys_[lhs] < keys_[rhs]));
+  });
+
+  if (const auto itr = std::adjacent_find(
+        std::begin(order), std::end(order), [this](std::size_t lhs, std::size_t rhs) { return keys_[lhs] == keys_[rhs]; });
+      itr != std::end(order))
+  {
+    SDE_LOG_ERROR() << "DuplicatePath: " << SDE_OSNV(keys_[*itr]);
+    return make_unexpected(AssetPackError::kDuplicatePath);
+  }
+
+  sde::vector<AssetPackEntry> table;
+  table.reserve(order.size());
+  for (const std::size_t i : order)
+  {
+    auto& entry = table.emplace_back(table_[i]);
+    entry.path_offset = stream_.tell();
+    if (stream_.write(keys_[i].data(), keys_[i].size()) != keys_[i].size())
+    {
+      return make_unexpected(AssetPackError::kFileWriteFailed);
+    }
+  }
+
+  if (!pad(alignof(AssetPackEntry)))
+  {
+    return make_unexpected(AssetPackError::kFileWriteFailed);
+  }
+
+  const AssetPackHeader header{.entry_count = table.size(), .table_offset = stream_.tell()};
+
+  serial::binary_oarchive oar{stream_};
+  for (const auto& entry : table)
+  {
+    oar << serial::named{"entry", entry};
+  }
+
+  if (!stream_.seek(0))
+  {
+    return make_unexpected(AssetPackError::kFileWriteFailed);
+  }
+  oar << serial::named{"header", header};
+  stream_.flush();
+  return {};
+}
+
+AssetPack::AssetPack(
+  serial::mmap_istream&& stream,
+  std::span<const std::byte> bytes,
+  sde::vector<AssetPackEntry>&& table) :
+    stream_{std::move(stream)}, bytes_{bytes}, table_{std::move(table)}
+{}
+
+expected<AssetPack, AssetPackError> AssetPack::open(const asset::path& path)
+{
+  auto ifs_or_error = serial::mmap_istream::create(path);
+  if (!ifs_or_error.has_value())
+  {
+    if (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist)
+    {
+      return make_unexpected(AssetPackError::kFileDoesNotExist);
+    }
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(AssetPackError::kFileOpenFailed);
+  }
+
+  auto& stream = ifs_or_error.value();
+  const std::size_t file_size = stream.available();
+  if (file_size < sizeof(AssetPackHeader))
+  {
+    return make_unexpected(AssetPackError::kInvalidHeader);
+  }
+
+  // Mapping stays valid when the stream is moved into the pack
+  const auto bytes = stream.read_view(file_size);
+  if (!stream.seek(0))
+  {
+    return make_unexpected(AssetPackError::kInvalidHeader);
+  }
+
+  AssetPackHeader header{.magic = 0};
+  serial::binary_iarchive iar{stream};
+  iar >> serial::named{"header", header};
+  if (header.magic != AssetPackHeader::kMagic)
+  {
+    return make_unexpected(AssetPackError::kInvalidHeader);
+  }
+  else if (
+    (header.table_offset < sizeof(AssetPackHeader)) or (header.table_offset > file_size) or
+    ((file_size - header.table_offset) != (header.entry_count * sizeof(AssetPackEntry))) or
+    !stream.seek(header.table_offset))
+  {
+    return make_unexpected(AssetPackError::kInvalidTable);
+  }
+
+  const auto in_bounds = [&header](std::size_t offset, std::size_t length) {
+    return (offset >= sizeof(AssetPackHeader)) and (offset <= header.table_offset) and
+      (length <= (header.table_offset - offset));
+  };
+
+  sde::vector<AssetPackEntry> table;
+  table.resize(header.entry_count);
+  for (auto& entry : table)
+  {
+    iar >> serial::named{"entry", entry};
+    if (!in_bounds(entry.path_offset, entry.path_length) or !in_bounds(entry.data_offset, entry.data_length))
+    {
+      return make_unexpected(AssetPackError::kInvalidTable);
+    }
+
+    const std::string_view key{reinterpret_cast<const char*>(bytes.data() + entry.path_offset), entry.path_length};
+    if (entry.path_hash != AssetPackPathHash(key))
+    {
+      return make_unexpected(AssetPackError::kInvalidTable);
+    }
+  }
+
+  if (!std::is_sorted(std::begin(table), std::end(table)))
+  {
+    return make_unexpected(AssetPackError::kInvalidTable);
+  }
+  return AssetPack{std::move(stream), bytes, std::move(table)};
+}
+
+std::string_view AssetPack::key(const AssetPackEntry& entry) const
+{
+  return {reinterpret_cast<const char*>(bytes_.data() + entry.path_offset), entry.path_length};
+}
+
+std::optional<std::span<const std::byte>> AssetPack::find(const asset::path& path) const
+{
+  const auto path_key = AssetPackPathKey(path);
+  const auto [first, last] = std::equal_range(
+    std::begin(table_), std::end(table_), AssetPackEntry{.path_hash = AssetPackPathHash(path_key)});
+  for (auto itr = first; itr != last; ++itr)
+  {
+    if (key(*itr) == path_key)
+    {
+      return bytes_.subspan(itr->data_offset, itr->data_length);
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace sde
@@ -0,0 +1,208 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ostream>
+#include <system_error>
+#include <utility>
+
+// POSIX
+#include <fcntl.h>
+#include <unistd.h>
+
+// SDE
+#include "sde/async_file_writer.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+namespace
+{
+
+/**
+ * @brief Writes all \p len bytes at \p data to \p fd , retrying partial and interrupted writes
+ */
+bool writeAll(int fd, const void* data, std::size_t len)
+{
+  const auto* bytes = static_cast<const char*>(data);
+  while (len > 0)
+  {
+    const ::ssize_t written = ::write(fd, bytes, len);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return false;
+    }
+    bytes += written;
+    len -= static_cast<std::size_t>(written);
+  }
+  return true;
+}
+
+/**
+ * @brief Flushes the directory holding \p path to disk, so that a rename into it survives a crash
+ */
+bool syncParentDirectory(const asset::path& path)
+{
+  const auto directory = path.has_parent_path() ? path.parent_path() : asset::path{"."};
+  const int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return false;
+  }
+  const bool synced = (::fsync(fd) == 0);
+  ::close(fd);
+  return synced;
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, AsyncFileWriterError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(AsyncFileWriterError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(AsyncFileWriterError::kFileWriteFailed)
+    SDE_OS_ENUM_CASE(AsyncFileWriterError::kFileRenameFailed)
+    SDE_OS_ENUM_CASE(AsyncFileWriterError::kFileSyncFailed)
+  }
+  return os;
+}
+
+AsyncFileWriter::AsyncFileWriter() : thread_{[this] { run(); }} {}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+  {
+    std::lock_guard lock{mutex_};
+    stopped_ = true;
+  }
+  job_submitted_.notify_one();
+  thread_.join();
+}
+
+void AsyncFileWriter::submit(asset::path path, serial::mem_ostream buffer)
+{
+  {
+    std::lock_guard lock{mutex_};
+    jobs_.push_back(Job{.path = std::move(path), .buffer = std::move(buffer)});
+  }
+  job_submitted_.notify_one();
+}
+
+void AsyncFileWriter::wait(const asset::path& path)
+{
+  std::unique_lock lock{mutex_};
+  job_finished_.wait(lock, [this, &path] {
+    return std::none_of(jobs_.begin(), jobs_.end(), [&path](const auto& job) { return job.path == path; });
+  });
+}
+
+expected<void, AsyncFileWriterError> AsyncFileWriter::flush()
+{
+  std::unique_lock lock{mutex_};
+  job_finished_.wait(lock, [this] { return jobs_.empty(); });
+  if (error_.has_value())
+  {
+    const auto error = *error_;
+    error_.reset();
+    return make_unexpected(error);
+  }
+  return {};
+}
+
+std::size_t AsyncFileWriter::pending() const
+{
+  std::lock_guard lock{mutex_};
+  return jobs_.size();
+}
+
+asset::path AsyncFileWriter::temporary_path(const asset::path& path)
+{
+  asset::path temporary{path};
+  temporary += ".tmp";
+  return temporary;
+}
+
+expected<void, AsyncFileWriterError> AsyncFileWriter::write(const asset::path& path, const void* data, std::size_t len)
+{
+  const auto temporary = temporary_path(path);
+  std::error_code ec;
+  const int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0)
+  {
+    SDE_LOG_ERROR() << "Failed to open: " << SDE_OSNV(temporary) << " (" << std::strerror(errno) << ')';
+    return make_unexpected(AsyncFileWriterError::kFileOpenFailed);
+  }
+  else if (!writeAll(fd, data, len))
+  {
+    SDE_LOG_ERROR() << "Failed to write: " << SDE_OSNV(temporary) << " (" << std::strerror(errno) << ')';
+    ::close(fd);
+    asset::remove(temporary, ec);
+    return make_unexpected(AsyncFileWriterError::kFileWriteFailed);
+  }
+  // New contents must be on disk before the rename is, or a crash could leave the destination empty
+  else if (::fsync(fd) != 0)
+  {
+    SDE_LOG_ERROR() << "Failed to sync: " << SDE_OSNV(temporary) << " (" << std::strerror(errno) << ')';
+    ::close(fd);
+    asset::remove(temporary, ec);
+    return make_unexpected(AsyncFileWriterError::kFileSyncFailed);
+  }
+  else if (::close(fd) != 0)
+  {
+    SDE_LOG_ERROR() << "Failed to close: " << SDE_OSNV(temporary) << " (" << std::strerror(errno) << ')';
+    asset::remove(temporary, ec);
+    return make_unexpected(AsyncFileWriterError::kFileWriteFailed);
+  }
+
+  // Replace destination only once its new contents are completely written
+  asset::rename(temporary, path, ec);
+  if (ec)
+  {
+    SDE_LOG_ERROR() << "Failed to rename: " << SDE_OSNV(temporary) << " to " << SDE_OSNV(path) << " (" << ec.message()
+                    << ')';
+    asset::remove(temporary, ec);
+    return make_unexpected(AsyncFileWriterError::kFileRenameFailed);
+  }
+
+  // Destination already holds the new contents; syncing its directory makes the rename itself durable
+  if (!syncParentDirectory(path))
+  {
+    SDE_LOG_ERROR() << "Failed to sync directory of: " << SDE_OSNV(path) << " (" << std::strerror(errno) << ')';
+    return make_unexpected(AsyncFileWriterError::kFileSyncFailed);
+  }
+  return {};
+}
+
+void AsyncFileWriter::run()
+{
+  std::unique_lock lock{mutex_};
+  while (true)
+  {
+    job_submitted_.wait(lock, [this] { return stopped_ or !jobs_.empty(); });
+    if (jobs_.empty())
+    {
+      return;
+    }
+
+    // Front job stays queued while it is written so that wait() covers it; references to queued jobs stay valid
+    // while other jobs are pushed to the back
+    const auto& job = jobs_.front();
+    lock.unlock();
+    auto ok_or_error = write(job.path, job.buffer.data(), job.buffer.size());
+    lock.lock();
+
+    if (!ok_or_error.has_value())
+    {
+      error_ = ok_or_error.error();
+    }
+    jobs_.pop_front();
+    job_finished_.notify_all();
+  }
+}
+
+}  // namespace sde
@@ -0,0 +1,121 @@
+// C++ Standard Library
+#include <array>
+#include <cstdio>
+#include <ostream>
+
+// SDE
+#include "sde/cooked_asset.hpp"
+#include "sde/logging.hpp"
+#include "sde/resource_content.hpp"
+
+namespace sde
+{
+
+std::ostream& operator<<(std::ostream& os, CookedAssetError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(CookedAssetError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(CookedAssetError::kFileWriteFailed)
+  }
+  return os;
+}
+
+CookedAssetStore::CookedAssetStore(asset::path directory, std::shared_ptr<const AssetFileSystem> file_system) :
+    directory_{std::move(directory)},
+    file_system_{(file_system == nullptr) ? std::make_shared<const AssetFileSystem>() : std::move(file_system)}
+{}
+
+asset::path CookedAssetStore::path(const Hash& key) const
+{
+  std::array<char, 2 * sizeof(std::size_t) + 1> name;
+  std::snprintf(name.data(), name.size(), "%016lx", static_cast<unsigned long>(key.value));
+  return directory_ / (std::string{name.data()} + ".cooked");
+}
+
+std::optional<Hash> CookedAssetStore::source_hash(const asset::path& source_path) const
+{
+  const auto data_or_error = file_system_->read(source_path);
+  if (!data_or_error.has_value())
+  {
+    return std::nullopt;
+  }
+  return ComputeContentHash(data_or_error->bytes.data(), data_or_error->bytes.size());
+}
+
+std::optional<AssetData>
+CookedAssetStore::read(const Hash& key, std::size_t info_type, void* info, std::size_t info_length) const
+{
+  const auto cooked_path = path(key);
+  auto data_or_error = file_system_->read(cooked_path);
+  if (!data_or_error.has_value())
+  {
+    return std::nullopt;
+  }
+
+  const auto bytes = data_or_error->bytes;
+  CookedAssetHeader header{.magic = 0};
+  if (bytes.size() < sizeof(CookedAssetHeader))
+  {
+    SDE_LOG_WARN() << "Ignoring invalid cooked asset: " << SDE_OSNV(cooked_path);
+    return std::nullopt;
+  }
+  std::memcpy(&header, bytes.data(), sizeof(CookedAssetHeader));
+
+  if (
+    (header.magic != CookedAssetHeader::kMagic) or (header.key.value != key.value) or
+    (header.info_type != info_type) or (header.info_length != info_length) or
+    (header.payload_offset < (sizeof(CookedAssetHeader) + info_length)) or (header.payload_offset > bytes.size()) or
+    (header.payload_length > (bytes.size() - header.payload_offset)))
+  {
+    SDE_LOG_WARN() << "Ignoring invalid cooked asset: " << SDE_OSNV(cooked_path);
+    return std::nullopt;
+  }
+
+  std::memcpy(info, bytes.data() + sizeof(CookedAssetHeader), info_length);
+  return AssetData{
+    .bytes = bytes.subspan(header.payload_offset, header.payload_length),
+    .owner = std::move(data_or_error->owner)};
+}
+
+expected<void, CookedAssetError> CookedAssetStore::write(
+  const Hash& key,
+  std::size_t info_type,
+  const void* info,
+  std::size_t info_length,
+  std::span<const std::byte> payload) const
+{
+  const auto cooked_path = path(key);
+  auto ofs_or_error = serial::file_ostream::create(
+    cooked_path, serial::file_ostream::default_flags, serial::file_ostream::default_block_size);
+  if (!ofs_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(cooked_path);
+    return make_unexpected(CookedAssetError::kFileOpenFailed);
+  }
+
+  const std::size_t info_end = sizeof(CookedAssetHeader) + info_length;
+  const std::size_t payload_offset = ((info_end + kPayloadAlignment - 1) / kPayloadAlignment) * kPayloadAlignment;
+  const CookedAssetHeader header{
+    .key = key,
+    .info_type = info_type,
+    .info_length = info_length,
+    .payload_offset = payload_offset,
+    .payload_length = payload.size()};
+
+  static constexpr std::array<std::byte, kPayloadAlignment> kZeros{};
+  {
+    serial::binary_oarchive oar{*ofs_or_error};
+    oar << serial::named{"header", header};
+  }
+  if (
+    (ofs_or_error->write(info, info_length) != info_length) or
+    (ofs_or_error->write(kZeros.data(), payload_offset - info_end) != (payload_offset - info_end)) or
+    (ofs_or_error->write(payload.data(), payload.size()) != payload.size()))
+  {
+    return make_unexpected(CookedAssetError::kFileWriteFailed);
+  }
+  return {};
+}
+
+}  // namespace sde
@@ -0,0 +1,107 @@
+// C++ Standard Library
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+// SDE
+#include "sde/interned_string.hpp"
+#include "sde/logging.hpp"
+
+namespace sde
+{
+namespace detail
+{
+
+class InternedStringTable
+{
+public:
+  InternedStringTable() { this->insert(std::string_view{}); }
+
+  std::optional<InternedString::id_type> find(std::string_view str) const
+  {
+    std::shared_lock lock{mutex_};
+    if (const auto itr = str_to_id_.find(str); itr != std::end(str_to_id_))
+    {
+      return itr->second;
+    }
+    return std::nullopt;
+  }
+
+  InternedString::id_type insert(std::string_view str)
+  {
+    if (const auto id = this->find(str); id.has_value())
+    {
+      return *id;
+    }
+
+    std::unique_lock lock{mutex_};
+    if (const auto itr = str_to_id_.find(str); itr != std::end(str_to_id_))
+    {
+      return itr->second;
+    }
+
+    SDE_ASSERT_LT(strs_.size(), std::numeric_limits<InternedString::id_type>::max()) << "too many interned strings";
+    const auto id = static_cast<InternedString::id_type>(strs_.size());
+
+    // Elements of a std::deque are not relocated on push_back, so views into them remain valid
+    const std::string_view interned{strs_.emplace_back(str)};
+    str_to_id_.emplace(interned, id);
+    return id;
+  }
+
+  std::string_view str(InternedString::id_type id) const
+  {
+    std::shared_lock lock{mutex_};
+    SDE_ASSERT_LT(id, strs_.size());
+    return strs_[id];
+  }
+
+  std::size_t size() const
+  {
+    std::shared_lock lock{mutex_};
+    return strs_.size();
+  }
+
+private:
+  mutable std::shared_mutex mutex_;
+  std::deque<std::string> strs_;
+  std::unordered_map<std::string_view, InternedString::id_type> str_to_id_;
+};
+
+/**
+ * @brief Returns the process-wide table
+ *
+ *        All table access goes through this single non-inline function, so that shared libraries which link their
+ *        own copy resolve it to the executable's table when the executable exports its symbols (e.g. -rdynamic)
+ */
+InternedStringTable& interned_string_table()
+{
+  // Never destroyed, so that strings interned by static objects remain valid while they are destroyed
+  static auto* table = new InternedStringTable{};
+  return *table;
+}
+
+}  // namespace detail
+
+InternedString::InternedString(std::string_view str) : id_{detail::interned_string_table().insert(str)} {}
+
+std::optional<InternedString> InternedString::find(std::string_view str)
+{
+  if (const auto id = detail::interned_string_table().find(str); id.has_value())
+  {
+    return InternedString{*id};
+  }
+  return std::nullopt;
+}
+
+std::size_t InternedString::count() { return detail::interned_string_table().size(); }
+
+std::string_view InternedString::str() const { return detail::interned_string_table().str(id_); }
+
+std::ostream& operator<<(std::ostream& os, const InternedString& str) { return os << str.str(); }
+
+}  // namespace sde
@@ -0,0 +1,281 @@
+// C++ Standard Library
+#include <utility>
+
+// SDE
+#include "sde/jobs.hpp"
+#include "sde/logging.hpp"
+#include "sde/profiler.hpp"
+
+namespace sde::jobs
+{
+namespace
+{
+
+/// JobSystem which this thread is a worker of, if any
+thread_local const JobSystem* worker_of = nullptr;
+
+/// Index of this thread's queue in worker_of
+thread_local std::size_t worker_index = 0;
+
+}  // namespace
+
+void JobSystem::Queue::push(Job&& job)
+{
+  std::lock_guard lock{mutex};
+  jobs.push_back(std::move(job));
+  size.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool JobSystem::Queue::pop_front(Job& job)
+{
+  if (size.load(std::memory_order_relaxed) == 0)
+  {
+    return false;
+  }
+  std::lock_guard lock{mutex};
+  if (jobs.empty())
+  {
+    return false;
+  }
+  job = std::move(jobs.front());
+  jobs.pop_front();
+  size.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool JobSystem::Queue::pop_back(Job& job)
+{
+  if (size.load(std::memory_order_relaxed) == 0)
+  {
+    return false;
+  }
+  std::lock_guard lock{mutex};
+  if (jobs.empty())
+  {
+    return false;
+  }
+  job = std::move(jobs.back());
+  jobs.pop_back();
+  size.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+JobSystem::JobSystem(std::size_t worker_count) :
+    main_thread_{std::this_thread::get_id()},
+    worker_count_{worker_count},
+    queues_{std::make_unique<Queue[]>(worker_count)}
+{
+  workers_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i)
+  {
+    workers_.emplace_back([this, i] { work(i); });
+  }
+}
+
+JobSystem::~JobSystem()
+{
+  stop_.store(true);
+  this->wake(/*all=*/true);
+  for (auto& worker : workers_)
+  {
+    worker.join();
+  }
+  if (const std::size_t dropped = main_.size.load(); dropped > 0)
+  {
+    SDE_LOG_WARN() << "Dropped " << dropped << " main-thread jobs which were never run";
+  }
+}
+
+void JobSystem::submit(std::function<void()> work, const JobOptions& options)
+{
+  Job job{.work = std::move(work), .signal = options.signal, .affinity = options.affinity};
+  if (job.signal != nullptr)
+  {
+    job.signal->value_.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (options.after != nullptr)
+  {
+    // Checked under the counter lock so that the job is either queued here or released by signal(), never neither
+    std::lock_guard lock{options.after->mutex_};
+    if (options.after->value_.load(std::memory_order_acquire) > 0)
+    {
+      options.after->waiting_.push_back(std::move(job));
+      return;
+    }
+  }
+  this->enqueue(std::move(job));
+}
+
+void JobSystem::signal(Counter& counter)
+{
+  sde::vector<Job> released;
+  bool done = false;
+  {
+    // Released under the counter lock; wait() takes the same lock before returning, after which the counter may be
+    // destroyed, so it must not be touched once the lock is released
+    std::lock_guard lock{counter.mutex_};
+    done = (counter.value_.fetch_sub(1, std::memory_order_acq_rel) == 1);
+    if (done)
+    {
+      released.swap(counter.waiting_);
+    }
+  }
+  for (auto& job : released)
+  {
+    this->enqueue(std::move(job));
+  }
+  if (done)
+  {
+    this->wake(/*all=*/true);
+  }
+}
+
+void JobSystem::wait(Counter& counter)
+{
+  while (true)
+  {
+    const auto epoch = epoch_.load();
+    if (counter.done())
+    {
+      break;
+    }
+    else if (!this->tryRun())
+    {
+      this->sleep(epoch);
+    }
+  }
+  std::lock_guard sync{counter.mutex_};
+}
+
+std::size_t JobSystem::runMainJobs()
+{
+  SDE_ASSERT_TRUE(this->isMainThread());
+  std::size_t count = 0;
+  for (Job job; main_.pop_front(job); ++count)
+  {
+    this->run(job);
+  }
+  return count;
+}
+
+void JobSystem::enqueue(Job&& job)
+{
+  if (job.affinity == Affinity::kMain)
+  {
+    main_.push(std::move(job));
+    // Any thread may be woken by a single notification; only the main thread can run this job
+    this->wake(/*all=*/true);
+    return;
+  }
+  else if (worker_of == this)
+  {
+    queues_[worker_index].push(std::move(job));
+  }
+  else
+  {
+    shared_.push(std::move(job));
+  }
+  this->wake(/*all=*/false);
+}
+
+bool JobSystem::tryTake(Job& job)
+{
+  if (this->isMainThread() and main_.pop_front(job))
+  {
+    return true;
+  }
+
+  const bool is_worker = (worker_of == this);
+  if (is_worker and queues_[worker_index].pop_back(job))
+  {
+    return true;
+  }
+  else if (shared_.pop_front(job))
+  {
+    return true;
+  }
+
+  // Steal the oldest job from another worker, starting with the next one along to spread out thieves
+  const std::size_t start = is_worker ? (worker_index + 1) : 0;
+  for (std::size_t n = 0; n < worker_count_; ++n)
+  {
+    const std::size_t victim = (start + n) % worker_count_;
+    if (!(is_worker and (victim == worker_index)) and queues_[victim].pop_front(job))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool JobSystem::tryRun()
+{
+  Job job;
+  if (!this->tryTake(job))
+  {
+    return false;
+  }
+  this->run(job);
+  return true;
+}
+
+void JobSystem::run(Job& job)
+{
+  job.work();
+  if (job.signal != nullptr)
+  {
+    this->signal(*job.signal);
+  }
+}
+
+void JobSystem::sleep(std::uint64_t epoch)
+{
+  std::unique_lock lock{sleep_mutex_};
+  sleepers_.fetch_add(1);
+  sleep_cv_.wait(lock, [this, epoch] { return (epoch_.load() != epoch) or stop_.load(); });
+  sleepers_.fetch_sub(1);
+}
+
+void JobSystem::wake(bool all)
+{
+  epoch_.fetch_add(1);
+  if (sleepers_.load() == 0)
+  {
+    return;
+  }
+  {
+    // Sleepers check the epoch under this lock, so a sleeper which missed the update is waiting once this is taken
+    std::lock_guard lock{sleep_mutex_};
+  }
+  if (all)
+  {
+    sleep_cv_.notify_all();
+  }
+  else
+  {
+    sleep_cv_.notify_one();
+  }
+}
+
+void JobSystem::work(std::size_t index)
+{
+  worker_of = this;
+  worker_index = index;
+  SetProfileThreadName("job_worker");
+  while (true)
+  {
+    const auto epoch = epoch_.load();
+    if (this->tryRun())
+    {
+      continue;
+    }
+    else if (stop_.load())
+    {
+      break;
+    }
+    this->sleep(epoch);
+  }
+  worker_of = nullptr;
+}
+
+}  // namespace sde::jobs
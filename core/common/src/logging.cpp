@@ -1,12 +1,355 @@
 // C++ Standard Library
+#include <atomic>
+#include <csignal>
+#include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <string_view>
+#include <thread>
+
+// POSIX
+#include <unistd.h>
 
 // SDE
 #include "sde/logging.hpp"
 
 namespace sde
 {
+namespace detail
+{
+
+std::atomic<LogSeverity> log_threshold{LogSeverity::kDebug};
+
+/**
+ * @brief Fixed-size buffer which a single message is formatted into
+ *
+ *        Characters past kLogMessageMaxLength are dropped.
+ */
+class LogLine final : public std::streambuf
+{
+public:
+  LogLine() : os_{this}, flags_{os_.flags()} { reset(); }
+
+  void reset()
+  {
+    setp(text_, text_ + kLogMessageMaxLength);
+    os_.clear();
+    os_.flags(flags_);
+    os_.precision(6);
+    os_.fill(' ');
+  }
+
+  std::ostream& stream() { return os_; }
+
+  std::string_view view() const { return {pbase(), static_cast<std::size_t>(pptr() - pbase())}; }
+
+  /// Set while a Log is formatting into this line
+  bool in_use = false;
+
+protected:
+  int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+
+private:
+  char text_[kLogMessageMaxLength];
+  std::ostream os_;
+  std::ios_base::fmtflags flags_;
+};
+
+namespace
+{
+
+/// Message formatting buffer for Log instances created on this thread
+thread_local LogLine thread_log_line;
+
+/**
+ * @brief Bounded multi-producer queue of formatted messages, drained to the log sink by a background thread
+ *
+ *        Producers claim slots without locking. Only one thread drains the queue at a time. If the queue is full, the
+ *        producer drains it itself, so logging never waits on a sink thread which is not running (e.g. after fork).
+ *        The sink thread sleeps until a message is published.
+ */
+class LogQueue
+{
+public:
+  /// Number of message slots; must be a power of two
+  static constexpr std::size_t kCapacity = 1024UL;
+
+  LogQueue() : slots_{std::make_unique<Slot[]>(kCapacity)}, sink_{std::addressof(std::cout)}, pid_{::getpid()}
+  {
+    for (std::size_t i = 0; i < kCapacity; ++i)
+    {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread{[this] { run(); }};
+  }
+
+  void push(std::string_view message)
+  {
+    while (!try_push(message))
+    {
+      if (std::unique_lock lock{drain_mutex_, std::try_to_lock}; lock.owns_lock())
+      {
+        drain_ready();
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+    published_.fetch_add(1, std::memory_order_release);
+    published_.notify_one();
+
+    // Without a sink thread, producers write their own messages
+    if (stopped_.load(std::memory_order_acquire))
+    {
+      flush();
+    }
+  }
+
+  /**
+   * @brief Stops the sink thread, then writes all pending messages
+   */
+  void stop()
+  {
+    if (stopped_.exchange(true, std::memory_order_acq_rel))
+    {
+      return;
+    }
+    published_.fetch_add(1, std::memory_order_release);
+    published_.notify_one();
+
+    // A forked process does not inherit the sink thread, so there is nothing to join
+    if (thread_.joinable() and (::getpid() == pid_))
+    {
+      thread_.join();
+    }
+    flush();
+  }
+
+  /**
+   * @brief Writes messages which are ready directly to the sink's file descriptor; async-signal-safe
+   *
+   *        Called when the process is crashing, so takes no locks: another thread may be draining the queue, and it may
+   *        be the thread which crashed. Skips messages which were never completely copied into the queue. Messages may
+   *        be repeated if they were being drained when the crash occurred.
+   */
+  void crash_write()
+  {
+    const int fd = sink_fd_.load(std::memory_order_relaxed);
+    const std::size_t until = enqueue_pos_.load(std::memory_order_acquire);
+    for (std::size_t pos = dequeue_pos_.load(std::memory_order_acquire); pos < until; ++pos)
+    {
+      const auto& slot = slots_[pos & (kCapacity - 1)];
+      if (slot.sequence.load(std::memory_order_acquire) == (pos + 1))
+      {
+        write_all(fd, slot.text, slot.length);
+        write_all(fd, "\n", 1);
+      }
+    }
+  }
+
+  void flush()
+  {
+    const std::size_t until = enqueue_pos_.load(std::memory_order_acquire);
+    std::lock_guard lock{drain_mutex_};
+    while (dequeue_pos_.load(std::memory_order_relaxed) < until)
+    {
+      // Wait on messages which are claimed but not yet copied by their producer
+      if (!drain_one())
+      {
+        std::this_thread::yield();
+      }
+    }
+    sink_->flush();
+  }
+
+  void set_sink(std::ostream* sink)
+  {
+    flush();
+    std::lock_guard lock{drain_mutex_};
+    sink_ = (sink == nullptr) ? std::addressof(std::cout) : sink;
+    sink_fd_.store((sink_ == std::addressof(std::cout)) ? STDOUT_FILENO : STDERR_FILENO, std::memory_order_relaxed);
+  }
+
+private:
+  /**
+   * @brief Writes \p len bytes to \p fd, retrying partial writes; async-signal-safe
+   */
+  static void write_all(int fd, const char* data, std::size_t len)
+  {
+    while (len > 0)
+    {
+      const auto written = ::write(fd, data, len);
+      if (written <= 0)
+      {
+        return;
+      }
+      data += written;
+      len -= static_cast<std::size_t>(written);
+    }
+  }
+
+  struct Slot
+  {
+    /// Equal to the claiming position when free; one past the claiming position when the message is ready
+    std::atomic<std::size_t> sequence;
+    std::size_t length;
+    char text[kLogMessageMaxLength];
+  };
+
+  bool try_push(std::string_view message)
+  {
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true)
+    {
+      slot = std::addressof(slots_[pos & (kCapacity - 1)]);
+      const auto diff = static_cast<std::ptrdiff_t>(slot->sequence.load(std::memory_order_acquire) - pos);
+      if (diff < 0)
+      {
+        return false;
+      }
+      else if (diff > 0)
+      {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+      else if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    slot->length = message.copy(slot->text, kLogMessageMaxLength);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Writes the next message to the sink, if it is ready; drain_mutex_ must be held
+   */
+  bool drain_one()
+  {
+    const std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    auto& slot = slots_[pos & (kCapacity - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != (pos + 1))
+    {
+      return false;
+    }
+    sink_->write(slot.text, slot.length).put('\n');
+    slot.sequence.store(pos + kCapacity, std::memory_order_release);
+    dequeue_pos_.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Writes all ready messages to the sink; drain_mutex_ must be held
+   */
+  std::size_t drain_ready()
+  {
+    std::size_t count = 0;
+    while (drain_one())
+    {
+      ++count;
+    }
+    if (count > 0)
+    {
+      sink_->flush();
+    }
+    return count;
+  }
+
+  void run()
+  {
+    while (true)
+    {
+      // Read before draining, so that a message published while draining ends the wait below
+      const auto published = published_.load(std::memory_order_acquire);
+      {
+        std::lock_guard lock{drain_mutex_};
+        drain_ready();
+      }
+      if (stopped_.load(std::memory_order_acquire))
+      {
+        return;
+      }
+      published_.wait(published, std::memory_order_acquire);
+    }
+  }
+
+  /// Message slots
+  std::unique_ptr<Slot[]> slots_;
+  /// Next position claimed by a producer
+  alignas(64) std::atomic<std::size_t> enqueue_pos_ = 0;
+  /// Incremented after each message is copied into its slot; the sink thread waits on changes
+  alignas(64) std::atomic<std::uint32_t> published_ = 0;
+  /// Set once the sink thread is stopped
+  std::atomic<bool> stopped_ = false;
+  /// Held by the thread draining the queue
+  alignas(64) std::mutex drain_mutex_;
+  /// Next position to drain; written while holding drain_mutex_, and read without it by crash_write
+  std::atomic<std::size_t> dequeue_pos_ = 0;
+  /// Stream messages are written to; guarded by drain_mutex_
+  std::ostream* sink_;
+  /// File descriptor which crash_write writes to in place of sink_
+  std::atomic<int> sink_fd_ = STDOUT_FILENO;
+  /// Process which started the sink thread
+  ::pid_t pid_;
+  /// Background sink thread
+  std::thread thread_;
+};
+
+LogQueue& log_queue()
+{
+  // Never destroyed, so that messages logged while other static objects are destroyed are still written
+  static LogQueue* queue = [] {
+    auto* q = new LogQueue{};
+    std::atexit([] { log_queue().stop(); });
+    return q;
+  }();
+  return *queue;
+}
+
+/// Queue written by crash handlers; set before handlers are installed, since log_queue() is not async-signal-safe
+LogQueue* crash_queue = nullptr;
+
+/// Set by the first crash handler to run, so that messages are not written again by handlers which it defers to
+std::atomic<bool> crash_written = false;
+
+/// Handlers replaced by crash_handler and terminate_handler, called once pending messages are written
+struct sigaction previous_sigsegv_action;
+struct sigaction previous_sigabrt_action;
+std::terminate_handler previous_terminate_handler = nullptr;
+
+void crash_write()
+{
+  if (!crash_written.exchange(true))
+  {
+    crash_queue->crash_write();
+  }
+}
+
+void crash_handler(int signal)
+{
+  crash_write();
+  ::sigaction(signal, (signal == SIGSEGV) ? &previous_sigsegv_action : &previous_sigabrt_action, nullptr);
+  std::raise(signal);
+}
+
+void terminate_handler()
+{
+  crash_write();
+  if (previous_terminate_handler != nullptr)
+  {
+    previous_terminate_handler();
+  }
+  std::abort();
+}
+
+}  // namespace
+}  // namespace detail
 
 std::ostream& operator<<(std::ostream& os, LogSeverity severity)
 {
@@ -31,9 +374,47 @@ std::ostream& operator<<(std::ostream& os, const LogFileInfo& info)
   return os << info.severity << ":" << info.file << ':' << info.line;
 }
 
+void SetLogThreshold(LogSeverity severity) { detail::log_threshold.store(severity, std::memory_order_relaxed); }
+
+LogSeverity GetLogThreshold() { return detail::log_threshold.load(std::memory_order_relaxed); }
+
+void SetLogSink(std::ostream* sink) { detail::log_queue().set_sink(sink); }
+
+void FlushLog() { detail::log_queue().flush(); }
+
+void InstallLogCrashHandlers()
+{
+  [[maybe_unused]] static const bool installed = [] {
+    detail::crash_queue = std::addressof(detail::log_queue());
+    struct sigaction action = {};
+    action.sa_handler = detail::crash_handler;
+    ::sigemptyset(&action.sa_mask);
+    ::sigaction(SIGSEGV, &action, &detail::previous_sigsegv_action);
+    ::sigaction(SIGABRT, &action, &detail::previous_sigabrt_action);
+    detail::previous_terminate_handler = std::set_terminate(detail::terminate_handler);
+    return true;
+  }();
+}
+
 Log::~Log()
 {
-  if (this->isValid())
+  if (line_ != nullptr)
+  {
+    detail::log_queue().push(line_->view());
+    if (line_ == std::addressof(detail::thread_log_line))
+    {
+      line_->in_use = false;
+    }
+    else
+    {
+      delete line_;
+    }
+    if (severity_ >= LogSeverity::kFatal)
+    {
+      FlushLog();
+    }
+  }
+  else if (this->isValid())
   {
     (*os_) << std::endl;
   }
@@ -41,7 +422,16 @@ Log::~Log()
 
 Log::Log(std::ostream* target) : os_{target} {}
 
-Log::Log() : Log{std::addressof(std::cout)} {}
+Log::Log(LogSeverity severity) : severity_{severity}
+{
+  // Messages logged while formatting another message (e.g. from an operator<<) get their own line
+  line_ = detail::thread_log_line.in_use ? new detail::LogLine{} : std::addressof(detail::thread_log_line);
+  line_->in_use = true;
+  line_->reset();
+  os_ = std::addressof(line_->stream());
+}
+
+Log::Log() : Log{LogSeverity::kInfo} {}
 
 Log::Log(Log&& other) { this->swap(other); }
 
@@ -53,7 +443,35 @@ Log& Log::operator=(Log&& other)
 
 void Log::flush() { this->os_->flush(); }
 
-void Log::swap(Log& other) { std::swap(this->os_, other.os_); }
+void Log::swap(Log& other)
+{
+  std::swap(this->os_, other.os_);
+  std::swap(this->line_, other.line_);
+  std::swap(this->severity_, other.severity_);
+}
+
+LogRateLimit::LogRateLimit(std::chrono::nanoseconds period) : period_{period}, next_{0}, suppressed_{0} {}
+
+std::optional<std::size_t> LogRateLimit::acquire()
+{
+  const std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+  std::int64_t next = next_.load(std::memory_order_relaxed);
+  if ((now < next) or !next_.compare_exchange_strong(next, now + period_.count(), std::memory_order_relaxed))
+  {
+    suppressed_.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+  }
+  return suppressed_.exchange(0, std::memory_order_relaxed);
+}
+
+std::ostream& operator<<(std::ostream& os, const LogSuppressed& suppressed)
+{
+  if (suppressed.count > 0)
+  {
+    os << '(' << suppressed.count << " similar suppressed) ";
+  }
+  return os;
+}
 
 
 Abort::~Abort()
@@ -69,6 +487,7 @@ Abort::Abort(std::ostream* target) : Log{target}
 {
   if (this->isValid())
   {
+    FlushLog();
     this->flush();
     (*this) << "********** RUNTIME ASSERTION FAILED **********\n\n";
   }
@@ -76,6 +495,6 @@ Abort::Abort(std::ostream* target) : Log{target}
 
 Abort::Abort() : Abort{std::addressof(std::cerr)} {}
 
-Abort::Abort(Abort&& other) { this->swap(other); }
+Abort::Abort(Abort&& other) : Log{nullptr} { this->swap(other); }
 
 }  // namespace sde
@@ -0,0 +1,254 @@
+// C++ Standard Library
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <ostream>
+
+// SDE
+#include "sde/logging.hpp"
+#include "sde/memory.hpp"
+
+namespace sde
+{
+namespace
+{
+
+constexpr std::size_t kMemoryTagCount = static_cast<std::size_t>(MemoryTag::_Count_);
+
+std::array<MemoryCounters, kMemoryTagCount>& memory_counters_table()
+{
+  static std::array<MemoryCounters, kMemoryTagCount> s_counters;
+  return s_counters;
+}
+
+struct MemoryResourceTable
+{
+  MemoryResourceTable()
+  {
+    for (auto& r : resources)
+    {
+      r.store(std::pmr::new_delete_resource());
+    }
+  }
+
+  std::array<std::atomic<std::pmr::memory_resource*>, kMemoryTagCount> resources;
+};
+
+std::array<std::atomic<std::pmr::memory_resource*>, kMemoryTagCount>& memory_resource_table()
+{
+  static MemoryResourceTable s_table;
+  return s_table.resources;
+}
+
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment)
+{
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, MemoryTag tag)
+{
+  switch (tag)
+  {
+    SDE_OS_ENUM_CASE(MemoryTag::kDefault)
+    SDE_OS_ENUM_CASE(MemoryTag::kGraphics)
+    SDE_OS_ENUM_CASE(MemoryTag::kAudio)
+    SDE_OS_ENUM_CASE(MemoryTag::kGame)
+    SDE_OS_ENUM_CASE(MemoryTag::kSerialization)
+  case MemoryTag::_Count_:
+    break;
+  }
+  return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const MemoryStats& stats)
+{
+  return os << "{ live_bytes: " << stats.live_bytes << ", peak_bytes: " << stats.peak_bytes
+            << ", live_allocations: " << stats.live_allocations << ", allocation_count: " << stats.allocation_count
+            << " }";
+}
+
+MemoryCounters& memory_counters(MemoryTag tag)
+{
+  SDE_ASSERT_LT(static_cast<std::size_t>(tag), kMemoryTagCount);
+  return memory_counters_table()[static_cast<std::size_t>(tag)];
+}
+
+std::pmr::memory_resource* memory_resource(MemoryTag tag)
+{
+  SDE_ASSERT_LT(static_cast<std::size_t>(tag), kMemoryTagCount);
+  return memory_resource_table()[static_cast<std::size_t>(tag)].load(std::memory_order_acquire);
+}
+
+std::pmr::memory_resource* set_memory_resource(MemoryTag tag, std::pmr::memory_resource* resource)
+{
+  SDE_ASSERT_LT(static_cast<std::size_t>(tag), kMemoryTagCount);
+  return memory_resource_table()[static_cast<std::size_t>(tag)].exchange(
+    (resource == nullptr) ? std::pmr::new_delete_resource() : resource, std::memory_order_acq_rel);
+}
+
+struct ArenaMemoryResource::block
+{
+  block* next;
+  std::size_t bytes;
+
+  std::uint8_t* data() { return reinterpret_cast<std::uint8_t*>(this) + sizeof(block); }
+};
+
+ArenaMemoryResource::ArenaMemoryResource(std::size_t block_size, std::pmr::memory_resource* upstream) :
+    block_size_{block_size}, upstream_{upstream}
+{
+  SDE_ASSERT_GT(block_size_, 0UL);
+  SDE_ASSERT_NE(upstream_, nullptr);
+}
+
+ArenaMemoryResource::~ArenaMemoryResource() { this->release(); }
+
+void ArenaMemoryResource::reset()
+{
+  current_ = head_;
+  offset_ = 0;
+  used_ = 0;
+}
+
+void ArenaMemoryResource::release()
+{
+  while (head_ != nullptr)
+  {
+    block* next = head_->next;
+    upstream_->deallocate(head_, sizeof(block) + head_->bytes, alignof(std::max_align_t));
+    head_ = next;
+  }
+  current_ = nullptr;
+  offset_ = 0;
+  used_ = 0;
+  capacity_ = 0;
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  // Walk forward through retained blocks (after a reset) until one fits
+  while (current_ != nullptr)
+  {
+    const auto base = reinterpret_cast<std::uintptr_t>(current_->data());
+    const std::size_t aligned_offset = align_up(base + offset_, alignment) - base;
+    if (aligned_offset + bytes <= current_->bytes)
+    {
+      offset_ = aligned_offset + bytes;
+      used_ += bytes;
+      return current_->data() + aligned_offset;
+    }
+    else if (current_->next == nullptr)
+    {
+      break;
+    }
+    current_ = current_->next;
+    offset_ = 0;
+  }
+
+  // Add a new block to the end of the chain; oversized requests get a dedicated block
+  const std::size_t block_bytes = std::max(block_size_, bytes + alignment);
+  auto* new_block = static_cast<block*>(upstream_->allocate(sizeof(block) + block_bytes, alignof(std::max_align_t)));
+  new_block->next = nullptr;
+  new_block->bytes = block_bytes;
+  capacity_ += block_bytes;
+
+  if (current_ == nullptr)
+  {
+    head_ = new_block;
+  }
+  else
+  {
+    current_->next = new_block;
+  }
+  current_ = new_block;
+  offset_ = 0;
+  return this->do_allocate(bytes, alignment);
+}
+
+void ArenaMemoryResource::do_deallocate(
+  [[maybe_unused]] void* ptr,
+  [[maybe_unused]] std::size_t bytes,
+  [[maybe_unused]] std::size_t alignment)
+{}
+
+PoolMemoryResource::PoolMemoryResource(std::size_t chunks_per_block, std::pmr::memory_resource* upstream) :
+    chunks_per_block_{chunks_per_block}, upstream_{upstream}
+{
+  SDE_ASSERT_GT(chunks_per_block_, 0UL);
+  SDE_ASSERT_NE(upstream_, nullptr);
+}
+
+PoolMemoryResource::~PoolMemoryResource() { this->release(); }
+
+void PoolMemoryResource::release()
+{
+  while (blocks_ != nullptr)
+  {
+    block* next = blocks_->next;
+    upstream_->deallocate(blocks_, blocks_->bytes, alignof(std::max_align_t));
+    blocks_ = next;
+  }
+  std::fill(std::begin(free_lists_), std::end(free_lists_), nullptr);
+}
+
+namespace
+{
+
+constexpr std::size_t size_class_index(std::size_t bytes, std::size_t alignment)
+{
+  const std::size_t chunk_size = std::bit_ceil(std::max({bytes, alignment, PoolMemoryResource::kMinChunkSize}));
+  return std::countr_zero(chunk_size) - std::countr_zero(PoolMemoryResource::kMinChunkSize);
+}
+
+}  // namespace
+
+void* PoolMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  if (bytes > kMaxChunkSize or alignment > alignof(std::max_align_t))
+  {
+    return upstream_->allocate(bytes, alignment);
+  }
+
+  const std::size_t index = size_class_index(bytes, alignment);
+  if (free_lists_[index] == nullptr)
+  {
+    // Carve a new block into chunks of this size class
+    const std::size_t chunk_size = kMinChunkSize << index;
+    const std::size_t header_size = align_up(sizeof(block), alignof(std::max_align_t));
+    const std::size_t block_bytes = header_size + chunk_size * chunks_per_block_;
+    auto* new_block = static_cast<block*>(upstream_->allocate(block_bytes, alignof(std::max_align_t)));
+    new_block->next = blocks_;
+    new_block->bytes = block_bytes;
+    blocks_ = new_block;
+
+    auto* data = reinterpret_cast<std::uint8_t*>(new_block) + header_size;
+    for (std::size_t i = 0; i < chunks_per_block_; ++i)
+    {
+      auto* c = reinterpret_cast<chunk*>(data + i * chunk_size);
+      c->next = free_lists_[index];
+      free_lists_[index] = c;
+    }
+  }
+
+  chunk* c = free_lists_[index];
+  free_lists_[index] = c->next;
+  return c;
+}
+
+void PoolMemoryResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+  if (bytes > kMaxChunkSize or alignment > alignof(std::max_align_t))
+  {
+    upstream_->deallocate(ptr, bytes, alignment);
+    return;
+  }
+
+  const std::size_t index = size_class_index(bytes, alignment);
+  auto* c = static_cast<chunk*>(ptr);
+  c->next = free_lists_[index];
+  free_lists_[index] = c;
+}
+
+}  // namespace sde
@@ -0,0 +1,436 @@
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+// SDE
+#include "sde/logging.hpp"
+#include "sde/profiler.hpp"
+
+namespace sde
+{
+namespace detail
+{
+
+std::atomic<bool> profiling_enabled{true};
+
+}  // namespace detail
+
+namespace
+{
+
+static_assert((kProfileEventCapacity & (kProfileEventCapacity - 1)) == 0, "capacity must be a power of two");
+
+/**
+ * @brief Ring of scope entry and exit events recorded by a single thread
+ *
+ *        Only the owning thread records events. Other threads may copy events out at any time; events which may have
+ *        been overwritten while they were being copied are discarded.
+ */
+class ProfileThreadEvents
+{
+public:
+  struct Event
+  {
+    const char* name;
+    /// Event time in nanoseconds, shifted left by one; low bit is set for scope exit events
+    std::int64_t stamp;
+    /// Number of enclosing scopes
+    std::uint32_t depth;
+  };
+
+  explicit ProfileThreadEvents(std::size_t index) :
+      index_{index}, events_{std::make_unique<Slot[]>(kProfileEventCapacity)}
+  {}
+
+  void begin(const char* name, std::int64_t time_ns) { record(name, time_ns << 1, depth_++); }
+
+  void end(std::int64_t time_ns)
+  {
+    if (depth_ > 0)
+    {
+      record(nullptr, (time_ns << 1) | 1, --depth_);
+    }
+  }
+
+  /**
+   * @brief Copies events needed to build all spans which ended at or after \p since_ns , oldest first
+   */
+  void snapshot(sde::vector<Event>& events, std::int64_t since_ns) const
+  {
+    events.clear();
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    const std::size_t tail = (head > kProfileEventCapacity) ? (head - kProfileEventCapacity) : 0;
+
+    // Walk back from the newest event until all events are older than since_ns, and every exit seen has its entry
+    std::size_t unmatched_exits = 0;
+    std::size_t i = head;
+    for (; i > tail; --i)
+    {
+      const auto& slot = events_[(i - 1) & (kProfileEventCapacity - 1)];
+      const Event event{
+        slot.name.load(std::memory_order_relaxed),
+        slot.stamp.load(std::memory_order_relaxed),
+        slot.depth.load(std::memory_order_relaxed)};
+      if (((event.stamp >> 1) < since_ns) and (unmatched_exits == 0))
+      {
+        break;
+      }
+      else if (event.stamp & 1)
+      {
+        ++unmatched_exits;
+      }
+      else if (unmatched_exits > 0)
+      {
+        --unmatched_exits;
+      }
+      events.push_back(event);
+    }
+
+    // Discard events whose slots were reused while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const std::size_t head_after = head_.load(std::memory_order_relaxed);
+    const std::size_t valid_tail =
+      ((head_after + 1) > kProfileEventCapacity) ? (head_after + 1 - kProfileEventCapacity) : 0;
+    if (i < valid_tail)
+    {
+      events.resize(events.size() - std::min(events.size(), valid_tail - i));
+    }
+    std::reverse(events.begin(), events.end());
+  }
+
+  std::size_t index() const { return index_; }
+
+  const char* name() const { return name_.load(std::memory_order_relaxed); }
+
+  void setName(const char* name) { name_.store(name, std::memory_order_relaxed); }
+
+  /**
+   * @brief Hands ring to a new owning thread; recorded events are kept
+   */
+  void reown()
+  {
+    setName(nullptr);
+    depth_ = 0;
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<const char*> name;
+    std::atomic<std::int64_t> stamp;
+    std::atomic<std::uint32_t> depth;
+  };
+
+  void record(const char* name, std::int64_t stamp, std::uint32_t depth)
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    auto& slot = events_[head & (kProfileEventCapacity - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.stamp.store(stamp, std::memory_order_relaxed);
+    slot.depth.store(depth, std::memory_order_relaxed);
+    head_.store(head + 1, std::memory_order_release);
+  }
+
+  /// Thread index, in order of first use of the profiler
+  std::size_t index_;
+  /// Thread name, if given
+  std::atomic<const char*> name_ = nullptr;
+  /// Event ring
+  std::unique_ptr<Slot[]> events_;
+  /// Number of events ever recorded
+  std::atomic<std::size_t> head_ = 0;
+  /// Number of open scopes; only used by the owning thread
+  std::uint32_t depth_ = 0;
+};
+
+/**
+ * @brief Event rings of all threads which have used the profiler
+ *
+ * @note  Rings are kept after their thread exits, so that its events can still be collected, and are handed to the
+ *        next new thread. Events of an exited thread are reported under the same thread index as those of the thread
+ *        which took over its ring.
+ */
+class ProfileRegistry
+{
+public:
+  ProfileThreadEvents& acquire()
+  {
+    std::lock_guard lock{mutex_};
+    if (!released_.empty())
+    {
+      auto* events = released_.back();
+      released_.pop_back();
+      events->reown();
+      return *events;
+    }
+    return *threads_.emplace_back(std::make_unique<ProfileThreadEvents>(threads_.size()));
+  }
+
+  void release(ProfileThreadEvents& events)
+  {
+    std::lock_guard lock{mutex_};
+    released_.push_back(std::addressof(events));
+  }
+
+  template <typename VisitorT> void visit(VisitorT&& visitor) const
+  {
+    std::lock_guard lock{mutex_};
+    for (const auto& thread : threads_)
+    {
+      visitor(*thread);
+    }
+  }
+
+  const ProfileThreadEvents* find(std::size_t thread) const
+  {
+    std::lock_guard lock{mutex_};
+    return (thread < threads_.size()) ? threads_[thread].get() : nullptr;
+  }
+
+  const char* name(std::string_view name)
+  {
+    std::lock_guard lock{mutex_};
+    // Node-based set, so that copies are not relocated on insertion
+    return names_.emplace(name).first->c_str();
+  }
+
+  static ProfileRegistry& get()
+  {
+    // Never destroyed, so that threads which outlive static objects may still record events
+    static auto* registry = new ProfileRegistry{};
+    return *registry;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::deque<std::unique_ptr<ProfileThreadEvents>> threads_;
+  sde::vector<ProfileThreadEvents*> released_;
+  std::unordered_set<std::string> names_;
+};
+
+/**
+ * @brief Holds the event ring of a thread, and returns it to the registry when the thread exits
+ */
+class ProfileThreadEventsOwner
+{
+public:
+  ProfileThreadEventsOwner() : events_{std::addressof(ProfileRegistry::get().acquire())} {}
+
+  ~ProfileThreadEventsOwner() { ProfileRegistry::get().release(*std::exchange(events_, nullptr)); }
+
+  /**
+   * @brief Returns ring of the calling thread, or \c nullptr once it has been released during thread exit
+   */
+  ProfileThreadEvents* events() const { return events_; }
+
+private:
+  ProfileThreadEvents* events_;
+};
+
+ProfileThreadEvents* this_thread_events()
+{
+  thread_local ProfileThreadEventsOwner owner;
+  return owner.events();
+}
+
+void write_json_string(std::ostream& os, std::string_view str)
+{
+  static constexpr const char* kHexDigits = "0123456789abcdef";
+  os << '"';
+  for (const char c : str)
+  {
+    switch (c)
+    {
+    case '"':
+      os << "\\\"";
+      break;
+    case '\\':
+      os << "\\\\";
+      break;
+    case '\n':
+      os << "\\n";
+      break;
+    case '\t':
+      os << "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20)
+      {
+        os << "\\u00" << kHexDigits[(c >> 4) & 0xF] << kHexDigits[c & 0xF];
+      }
+      else
+      {
+        os << c;
+      }
+      break;
+    }
+  }
+  os << '"';
+}
+
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, ProfileTraceError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(ProfileTraceError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(ProfileTraceError::kFileWriteFailed)
+  }
+  return os;
+}
+
+void SetProfilingEnabled(bool enabled) { detail::profiling_enabled.store(enabled, std::memory_order_relaxed); }
+
+void SetProfileThreadName(const char* name)
+{
+  if (auto* events = this_thread_events(); events != nullptr)
+  {
+    events->setName(name);
+  }
+}
+
+const char* GetProfileThreadName(std::size_t thread)
+{
+  const auto* events = ProfileRegistry::get().find(thread);
+  return (events == nullptr) ? nullptr : events->name();
+}
+
+std::int64_t ProfileNow()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+const char* ProfileName(std::string_view name) { return ProfileRegistry::get().name(name); }
+
+void ProfileBegin(const char* name)
+{
+  if (auto* events = this_thread_events(); events != nullptr)
+  {
+    events->begin(name, ProfileNow());
+  }
+}
+
+void ProfileEnd()
+{
+  if (auto* events = this_thread_events(); events != nullptr)
+  {
+    events->end(ProfileNow());
+  }
+}
+
+sde::vector<ProfileSpan> ProfileCollect(std::int64_t since_ns)
+{
+  sde::vector<ProfileSpan> spans;
+  sde::vector<ProfileThreadEvents::Event> events;
+  sde::vector<ProfileThreadEvents::Event> open;
+  ProfileRegistry::get().visit([&](const ProfileThreadEvents& thread) {
+    thread.snapshot(events, since_ns);
+    const std::size_t first = spans.size();
+    open.clear();
+    for (const auto& event : events)
+    {
+      if ((event.stamp & 1) == 0)
+      {
+        open.push_back(event);
+      }
+      else if (!open.empty() and (open.back().depth == event.depth))
+      {
+        const auto& begin = open.back();
+        if (const std::int64_t end_ns = (event.stamp >> 1); end_ns >= since_ns)
+        {
+          spans.push_back(
+            {.name = begin.name,
+             .thread = thread.index(),
+             .depth = begin.depth,
+             .begin_ns = (begin.stamp >> 1),
+             .end_ns = end_ns});
+        }
+        open.pop_back();
+      }
+    }
+
+    // Spans are completed innermost first; order by entry time
+    std::sort(spans.begin() + first, spans.end(), [](const auto& lhs, const auto& rhs) {
+      return (lhs.begin_ns < rhs.begin_ns) or ((lhs.begin_ns == rhs.begin_ns) and (lhs.depth < rhs.depth));
+    });
+  });
+  return spans;
+}
+
+void WriteChromeTrace(std::ostream& os, std::span<const ProfileSpan> spans)
+{
+  // Times are written relative to the earliest span, in microseconds
+  std::int64_t origin_ns = 0;
+  if (!spans.empty())
+  {
+    origin_ns = std::min_element(spans.begin(), spans.end(), [](const auto& lhs, const auto& rhs) {
+                  return lhs.begin_ns < rhs.begin_ns;
+                })->begin_ns;
+  }
+
+  const auto flags = os.flags();
+  const auto precision = os.precision();
+  os.setf(std::ios::fixed, std::ios::floatfield);
+  os.precision(3);
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  sde::vector<std::size_t> threads;
+  for (const auto& span : spans)
+  {
+    os << (first ? "\n" : ",\n") << "{\"name\":";
+    write_json_string(os, (span.name == nullptr) ? std::string_view{} : std::string_view{span.name});
+    os << ",\"cat\":\"sde\",\"ph\":\"X\",\"ts\":" << (static_cast<double>(span.begin_ns - origin_ns) * 1e-3)
+       << ",\"dur\":" << (static_cast<double>(span.end_ns - span.begin_ns) * 1e-3)
+       << ",\"pid\":0,\"tid\":" << span.thread << '}';
+    first = false;
+    if (std::find(threads.begin(), threads.end(), span.thread) == threads.end())
+    {
+      threads.push_back(span.thread);
+    }
+  }
+
+  for (const auto thread : threads)
+  {
+    if (const char* name = GetProfileThreadName(thread); name != nullptr)
+    {
+      os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":";
+      write_json_string(os, name);
+      os << "}}";
+    }
+  }
+  os << "\n]}\n";
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+expected<void, ProfileTraceError> WriteChromeTrace(const asset::path& path, std::span<const ProfileSpan> spans)
+{
+  std::ofstream ofs{path, std::ios::binary};
+  if (!ofs.is_open())
+  {
+    SDE_LOG_ERROR() << "Failed to open: " << SDE_OSNV(path);
+    return make_unexpected(ProfileTraceError::kFileOpenFailed);
+  }
+  WriteChromeTrace(ofs, spans);
+  if (!ofs.flush())
+  {
+    SDE_LOG_ERROR() << "Failed to write: " << SDE_OSNV(path);
+    return make_unexpected(ProfileTraceError::kFileWriteFailed);
+  }
+  return {};
+}
+
+}  // namespace sde
@@ -0,0 +1,151 @@
+// C++ Standard Library
+#include <algorithm>
+#include <ostream>
+
+// SDE
+#include "sde/logging.hpp"
+#include "sde/resource_bundle.hpp"
+
+namespace sde
+{
+
+std::ostream& operator<<(std::ostream& os, ResourceBundleError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(ResourceBundleError::kFileDoesNotExist)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kFileWriteFailed)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kInvalidHeader)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kInvalidIndex)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kInvalidElement)
+    SDE_OS_ENUM_CASE(ResourceBundleError::kDuplicateElement)
+  }
+  return os;
+}
+
+std::ostream& operator<<(std::ostream& os, ResourceBundleLoadMode mode)
+{
+  switch (mode)
+  {
+    SDE_OS_ENUM_CASE(ResourceBundleLoadMode::kEager)
+    SDE_OS_ENUM_CASE(ResourceBundleLoadMode::kLazy)
+  }
+  return os;
+}
+
+ResourceBundleWriter::ResourceBundleWriter(serial::file_ostream&& stream) : stream_{std::move(stream)}
+{
+  // Placeholder header, re-written by ResourceBundleWriter::finish
+  const ResourceBundleHeader header;
+  serial::binary_oarchive oar{stream_};
+  oar << serial::named{"header", header};
+}
+
+expected<ResourceBundleWriter, ResourceBundleError> ResourceBundleWriter::create(const asset::path& path)
+{
+  auto ofs_or_error = serial::file_ostream::create(
+    path, serial::file_ostream::default_flags, serial::file_ostream::default_block_size);
+  if (!ofs_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(ResourceBundleError::kFileOpenFailed);
+  }
+  return ResourceBundleWriter{std::move(ofs_or_error).value()};
+}
+
+expected<void, ResourceBundleError> ResourceBundleWriter::finish()
+{
+  std::sort(std::begin(index_), std::end(index_));
+  if (const auto itr = std::adjacent_find(
+        std::begin(index_),
+        std::end(index_),
+        [](const auto& lhs, const auto& rhs) { return !(lhs < rhs) and !(rhs < lhs); });
+      itr != std::end(index_))
+  {
+    return make_unexpected(ResourceBundleError::kDuplicateElement);
+  }
+
+  const ResourceBundleHeader header{.entry_count = index_.size(), .index_offset = stream_.tell()};
+
+  serial::binary_oarchive oar{stream_};
+  for (const auto& entry : index_)
+  {
+    oar << serial::named{"entry", entry};
+  }
+
+  if (!stream_.seek(0))
+  {
+    return make_unexpected(ResourceBundleError::kFileWriteFailed);
+  }
+  oar << serial::named{"header", header};
+
+  // Bundles are only complete once every byte, including the re-written header, has reached the file
+  if (!stream_.try_flush())
+  {
+    return make_unexpected(ResourceBundleError::kFileWriteFailed);
+  }
+  return {};
+}
+
+ResourceBundle::ResourceBundle(std::shared_ptr<serial::mmap_istream> stream, sde::vector<ResourceBundleEntry>&& index) :
+    stream_{std::move(stream)}, index_{std::move(index)}
+{}
+
+expected<ResourceBundle, ResourceBundleError> ResourceBundle::open(const asset::path& path)
+{
+  auto ifs_or_error = serial::mmap_istream::create(path);
+  if (!ifs_or_error.has_value())
+  {
+    if (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist)
+    {
+      return make_unexpected(ResourceBundleError::kFileDoesNotExist);
+    }
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(ResourceBundleError::kFileOpenFailed);
+  }
+
+  auto stream = std::make_shared<serial::mmap_istream>(std::move(ifs_or_error).value());
+  const std::size_t file_size = stream->available();
+
+  ResourceBundleHeader header{.magic = 0};
+  if (file_size < sizeof(ResourceBundleHeader))
+  {
+    return make_unexpected(ResourceBundleError::kInvalidHeader);
+  }
+
+  serial::binary_iarchive iar{*stream};
+  iar >> serial::named{"header", header};
+  if (header.magic != ResourceBundleHeader::kMagic)
+  {
+    return make_unexpected(ResourceBundleError::kInvalidHeader);
+  }
+  else if (
+    (header.index_offset < sizeof(ResourceBundleHeader)) or (header.index_offset > file_size) or
+    ((file_size - header.index_offset) != (header.entry_count * sizeof(ResourceBundleEntry))) or
+    !stream->seek(header.index_offset))
+  {
+    return make_unexpected(ResourceBundleError::kInvalidIndex);
+  }
+
+  sde::vector<ResourceBundleEntry> index;
+  index.resize(header.entry_count);
+  for (auto& entry : index)
+  {
+    iar >> serial::named{"entry", entry};
+    if (
+      (entry.offset < sizeof(ResourceBundleHeader)) or (entry.offset > header.index_offset) or
+      (entry.length > (header.index_offset - entry.offset)))
+    {
+      return make_unexpected(ResourceBundleError::kInvalidIndex);
+    }
+  }
+
+  if (!std::is_sorted(std::begin(index), std::end(index)))
+  {
+    return make_unexpected(ResourceBundleError::kInvalidIndex);
+  }
+  return ResourceBundle{std::move(stream), std::move(index)};
+}
+
+}  // namespace sde
@@ -0,0 +1,53 @@
+// C++ Standard Library
+#include <array>
+#include <cstdio>
+#include <ostream>
+
+// SDE
+#include "sde/resource_content.hpp"
+#include "sde/unique_resource.hpp"
+
+namespace sde
+{
+namespace
+{
+
+struct FileCloser
+{
+  void operator()(std::FILE* file) const { std::fclose(file); }
+};
+
+}  // namespace
+
+Hash ComputeContentHash(const void* data, std::size_t len) { return {ComputeBytesHashValue(data, len)}; }
+
+std::optional<Hash> ComputeContentHash(const asset::path& path)
+{
+  UniqueResource<std::FILE*, FileCloser> file{std::fopen(path.string().c_str(), "rb")};
+  if (file.isNull())
+  {
+    return std::nullopt;
+  }
+
+  std::array<std::uint8_t, 1UL << 16UL> block;
+  BytesHasher hasher;
+  while (const std::size_t read_len = std::fread(block.data(), 1, block.size(), file))
+  {
+    hasher.update(block.data(), read_len);
+  }
+
+  if (std::ferror(file) != 0)
+  {
+    return std::nullopt;
+  }
+  return Hash{hasher.digest()};
+}
+
+std::ostream& operator<<(std::ostream& os, const ResourceContentStats& stats)
+{
+  return os << "{ decode_count: " << stats.decode_count << ", alias_count: " << stats.alias_count
+            << ", bytes_saved: " << stats.bytes_saved << ", decode_time_saved: " << toSeconds(stats.decode_time_saved)
+            << "s }";
+}
+
+}  // namespace sde
@@ -0,0 +1,242 @@
+// C++ Standard Library
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/asset_file_system.hpp"
+#include "sde/asset_pack.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+std::string ToString(std::span<const std::byte> bytes)
+{
+  return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+void WriteFile(const asset::path& path, const std::string& contents)
+{
+  if (path.has_parent_path())
+  {
+    asset::create_directories(path.parent_path());
+  }
+  std::ofstream ofs{path, std::ios::binary};
+  ofs << contents;
+}
+
+}  // namespace
+
+class AssetPackTest : public ::testing::Test
+{
+protected:
+  static constexpr const char* kAssetDirectory = "AssetPackTest.assets";
+  static constexpr const char* kPackPath = "AssetPackTest.pack";
+
+  void SetUp() override
+  {
+    asset::remove_all(kAssetDirectory);
+    WriteFile(asset::path{kAssetDirectory} / "images" / "player.png", std::string(1000, 'p'));
+    WriteFile(asset::path{kAssetDirectory} / "images" / "tiles" / "grass.png", "grass");
+    WriteFile(asset::path{kAssetDirectory} / "sounds" / "jump.wav", std::string(4096, 'j'));
+    WriteFile(asset::path{kAssetDirectory} / "shaders" / "sprite.glsl", "void main() {}");
+    WriteFile(asset::path{kAssetDirectory} / "empty.txt", "");
+
+    auto writer_or_error = AssetPackWriter::create(kPackPath);
+    ASSERT_TRUE(writer_or_error.has_value()) << writer_or_error.error();
+    const auto count_or_error = writer_or_error->add_directory(kAssetDirectory);
+    ASSERT_TRUE(count_or_error.has_value()) << count_or_error.error();
+    ASSERT_EQ(*count_or_error, kAssetCount);
+    ASSERT_TRUE(writer_or_error->finish().has_value());
+  }
+
+  void TearDown() override
+  {
+    asset::remove_all(kAssetDirectory);
+    std::remove(kPackPath);
+  }
+
+  static constexpr std::size_t kAssetCount = 5;
+};
+
+TEST_F(AssetPackTest, Table)
+{
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+  ASSERT_EQ(pack_or_error->size(), kAssetCount);
+
+  for (const auto& entry : pack_or_error->entries())
+  {
+    ASSERT_EQ(entry.path_hash, AssetPackPathHash(pack_or_error->key(entry)));
+    ASSERT_EQ(entry.data_offset % AssetPackWriter::kDataAlignment, 0UL);
+  }
+}
+
+TEST_F(AssetPackTest, PackedMatchesLooseFiles)
+{
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+
+  AssetFileSystem loose;
+
+  AssetFileSystem packed;
+  packed.mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), kAssetDirectory);
+
+  for (const auto& entry : asset::recursive_directory_iterator{kAssetDirectory})
+  {
+    if (!entry.is_regular_file())
+    {
+      continue;
+    }
+    ASSERT_TRUE(packed.packed(entry.path())) << entry.path();
+    ASSERT_FALSE(loose.packed(entry.path())) << entry.path();
+
+    const auto from_loose = loose.read(entry.path());
+    ASSERT_TRUE(from_loose.has_value()) << from_loose.error();
+
+    const auto from_pack = packed.read(entry.path());
+    ASSERT_TRUE(from_pack.has_value()) << from_pack.error();
+
+    ASSERT_EQ(ToString(from_pack->bytes), ToString(from_loose->bytes)) << entry.path();
+  }
+}
+
+TEST_F(AssetPackTest, PackedDataOutlivesFileSystem)
+{
+  AssetData data;
+  {
+    auto pack_or_error = AssetPack::open(kPackPath);
+    ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+
+    AssetFileSystem fs;
+    fs.mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), kAssetDirectory);
+
+    auto data_or_error = fs.read(asset::path{kAssetDirectory} / "shaders" / "sprite.glsl");
+    ASSERT_TRUE(data_or_error.has_value()) << data_or_error.error();
+    data = std::move(data_or_error).value();
+  }
+  ASSERT_EQ(ToString(data.bytes), "void main() {}");
+}
+
+TEST_F(AssetPackTest, EquivalentPathSpellings)
+{
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+  ASSERT_TRUE(pack_or_error->contains("images/tiles/grass.png"));
+  ASSERT_TRUE(pack_or_error->contains("images/./tiles/../tiles/grass.png"));
+  ASSERT_FALSE(pack_or_error->contains("images/grass.png"));
+}
+
+TEST_F(AssetPackTest, FallsBackToLooseFilesOutsideOfMountRoot)
+{
+  static constexpr const char* kLoosePath = "AssetPackTest.loose.txt";
+  WriteFile(kLoosePath, "loose");
+
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+
+  AssetFileSystem fs;
+  fs.mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), kAssetDirectory);
+
+  ASSERT_FALSE(fs.packed(kLoosePath));
+  ASSERT_TRUE(fs.exists(kLoosePath));
+  const auto data_or_error = fs.read(kLoosePath);
+  ASSERT_TRUE(data_or_error.has_value()) << data_or_error.error();
+  ASSERT_EQ(ToString(data_or_error->bytes), "loose");
+
+  ASSERT_FALSE(fs.exists("AssetPackTest.missing.txt"));
+  const auto missing_or_error = fs.read("AssetPackTest.missing.txt");
+  ASSERT_FALSE(missing_or_error.has_value());
+  ASSERT_EQ(missing_or_error.error(), AssetPackError::kFileDoesNotExist);
+
+  std::remove(kLoosePath);
+}
+
+TEST_F(AssetPackTest, PackedTakesPrecedenceOverLooseFiles)
+{
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value()) << pack_or_error.error();
+
+  // Modify loose file after packing
+  const auto path = asset::path{kAssetDirectory} / "images" / "tiles" / "grass.png";
+  WriteFile(path, "dirt");
+
+  AssetFileSystem fs;
+  fs.mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), kAssetDirectory);
+
+  const auto data_or_error = fs.read(path);
+  ASSERT_TRUE(data_or_error.has_value()) << data_or_error.error();
+  ASSERT_EQ(ToString(data_or_error->bytes), "grass");
+}
+
+TEST(AssetPack, DuplicatePath)
+{
+  static constexpr const char* kPath = "AssetPack.duplicate.pack";
+  const std::string data{"data"};
+  const std::span<const std::byte> bytes{reinterpret_cast<const std::byte*>(data.data()), data.size()};
+
+  auto writer_or_error = AssetPackWriter::create(kPath);
+  ASSERT_TRUE(writer_or_error.has_value());
+  ASSERT_TRUE(writer_or_error->add("a/b.txt", bytes).has_value());
+  ASSERT_TRUE(writer_or_error->add("a/./b.txt", bytes).has_value());
+
+  const auto ok_or_error = writer_or_error->finish();
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), AssetPackError::kDuplicatePath);
+  std::remove(kPath);
+}
+
+TEST(AssetPack, InvalidPath)
+{
+  static constexpr const char* kPath = "AssetPack.invalid_path.pack";
+  auto writer_or_error = AssetPackWriter::create(kPath);
+  ASSERT_TRUE(writer_or_error.has_value());
+  ASSERT_EQ(writer_or_error->add("../outside.txt", {}).error(), AssetPackError::kInvalidPath);
+  ASSERT_EQ(writer_or_error->add("/absolute.txt", {}).error(), AssetPackError::kInvalidPath);
+  ASSERT_EQ(writer_or_error->add("", {}).error(), AssetPackError::kInvalidPath);
+  std::remove(kPath);
+}
+
+TEST(AssetPack, MissingFile)
+{
+  const auto pack_or_error = AssetPack::open("AssetPack.missing.pack");
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), AssetPackError::kFileDoesNotExist);
+}
+
+TEST(AssetPack, InvalidHeader)
+{
+  static constexpr const char* kPath = "AssetPack.invalid.pack";
+  WriteFile(kPath, std::string(64, 'x'));
+  const auto pack_or_error = AssetPack::open(kPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), AssetPackError::kInvalidHeader);
+  std::remove(kPath);
+}
+
+TEST(AssetPack, TruncatedTable)
+{
+  static constexpr const char* kPath = "AssetPack.truncated.pack";
+  {
+    const std::string data{"data"};
+    auto writer_or_error = AssetPackWriter::create(kPath);
+    ASSERT_TRUE(writer_or_error.has_value());
+    ASSERT_TRUE(writer_or_error
+                  ->add("a.txt", std::span<const std::byte>{reinterpret_cast<const std::byte*>(data.data()), data.size()})
+                  .has_value());
+    ASSERT_TRUE(writer_or_error->finish().has_value());
+  }
+  std::filesystem::resize_file(kPath, std::filesystem::file_size(kPath) - 1);
+  const auto pack_or_error = AssetPack::open(kPath);
+  ASSERT_FALSE(pack_or_error.has_value());
+  ASSERT_EQ(pack_or_error.error(), AssetPackError::kInvalidTable);
+  std::remove(kPath);
+}
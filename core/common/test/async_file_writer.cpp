@@ -0,0 +1,155 @@
+// C++ Standard Library
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+// POSIX
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/async_file_writer.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+serial::mem_ostream MakeBuffer(const std::string& contents)
+{
+  serial::mem_ostream buffer;
+  buffer.write(contents.data(), contents.size());
+  return buffer;
+}
+
+std::string ReadFile(const asset::path& path)
+{
+  std::ifstream ifs{path, std::ios::binary};
+  return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+}
+
+}  // namespace
+
+class AsyncFileWriterTest : public ::testing::Test
+{
+protected:
+  static constexpr const char* kDirectory = "AsyncFileWriterTest.out";
+
+  void SetUp() override
+  {
+    asset::remove_all(kDirectory);
+    asset::create_directories(kDirectory);
+  }
+
+  void TearDown() override { asset::remove_all(kDirectory); }
+};
+
+TEST_F(AsyncFileWriterTest, SubmitThenFlush)
+{
+  const auto path = asset::path{kDirectory} / "data.bin";
+  AsyncFileWriter writer;
+  writer.submit(path, MakeBuffer("contents"));
+  ASSERT_TRUE(writer.flush().has_value());
+  ASSERT_EQ(writer.pending(), 0UL);
+  ASSERT_EQ(ReadFile(path), "contents");
+  ASSERT_FALSE(asset::exists(AsyncFileWriter::temporary_path(path)));
+}
+
+TEST_F(AsyncFileWriterTest, WritesAppliedInOrder)
+{
+  const auto path = asset::path{kDirectory} / "data.bin";
+  AsyncFileWriter writer;
+  for (int i = 0; i < 10; ++i)
+  {
+    writer.submit(path, MakeBuffer(std::to_string(i)));
+  }
+  writer.wait(path);
+  ASSERT_EQ(ReadFile(path), "9");
+}
+
+TEST_F(AsyncFileWriterTest, DestructorFinishesPendingWrites)
+{
+  const auto path = asset::path{kDirectory} / "data.bin";
+  {
+    AsyncFileWriter writer;
+    writer.submit(path, MakeBuffer("contents"));
+  }
+  ASSERT_EQ(ReadFile(path), "contents");
+}
+
+TEST_F(AsyncFileWriterTest, SubmittedBufferRecycled)
+{
+  const auto path = asset::path{kDirectory} / "data.bin";
+  AsyncFileWriter writer;
+  serial::mem_ostream buffer{writer.buffers()};
+  buffer.write("contents", 8);
+  writer.submit(path, std::move(buffer));
+  ASSERT_TRUE(writer.flush().has_value());
+  ASSERT_EQ(writer.buffers().size(), 1UL);
+  ASSERT_EQ(ReadFile(path), "contents");
+}
+
+TEST_F(AsyncFileWriterTest, FlushReportsFailedWrite)
+{
+  AsyncFileWriter writer;
+  writer.submit(asset::path{kDirectory} / "missing" / "data.bin", MakeBuffer("contents"));
+  const auto ok_or_error = writer.flush();
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), AsyncFileWriterError::kFileOpenFailed);
+  ASSERT_TRUE(writer.flush().has_value());
+}
+
+TEST_F(AsyncFileWriterTest, PartialTemporaryFileIgnored)
+{
+  const auto path = asset::path{kDirectory} / "data.bin";
+  ASSERT_TRUE(AsyncFileWriter::write(path, "previous", 8).has_value());
+
+  // Leftover from a writer which stopped before renaming
+  std::ofstream{AsyncFileWriter::temporary_path(path)} << "part";
+  ASSERT_EQ(ReadFile(path), "previous");
+
+  AsyncFileWriter writer;
+  writer.submit(path, MakeBuffer("next"));
+  ASSERT_TRUE(writer.flush().has_value());
+  ASSERT_EQ(ReadFile(path), "next");
+}
+
+TEST_F(AsyncFileWriterTest, InterruptedWriterLeavesCompleteFile)
+{
+  static constexpr std::size_t kFileSize = 4UL * 1024UL * 1024UL;
+
+  const auto path = asset::path{kDirectory} / "data.bin";
+  ASSERT_TRUE(AsyncFileWriter::write(path, std::string(kFileSize, 'a').data(), kFileSize).has_value());
+
+  for (int delay_ms = 0; delay_ms < 50; delay_ms += 5)
+  {
+    const pid_t pid = ::fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0)
+    {
+      // Rewrite the file until killed, so that the kill lands in the middle of a write
+      AsyncFileWriter writer;
+      for (char c = 'b';; c = (c == 'z') ? 'b' : (c + 1))
+      {
+        writer.submit(path, MakeBuffer(std::string(kFileSize, c)));
+        writer.wait(path);
+      }
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{delay_ms});
+    ::kill(pid, SIGKILL);
+    ::waitpid(pid, nullptr, 0);
+
+    const auto contents = ReadFile(path);
+    ASSERT_EQ(contents.size(), kFileSize) << "delay_ms=" << delay_ms;
+    ASSERT_EQ(contents.find_first_not_of(contents.front()), std::string::npos) << "delay_ms=" << delay_ms;
+  }
+}
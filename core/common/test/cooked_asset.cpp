@@ -0,0 +1,150 @@
+// C++ Standard Library
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/asset_file_system.hpp"
+#include "sde/asset_pack.hpp"
+#include "sde/cooked_asset.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+struct PixelInfo
+{
+  std::int32_t width;
+  std::int32_t height;
+  std::int32_t channels;
+};
+
+struct OtherInfo
+{
+  std::int32_t width;
+  std::int32_t height;
+  std::int32_t channels;
+};
+
+std::span<const std::byte> AsBytes(const std::string& str)
+{
+  return {reinterpret_cast<const std::byte*>(str.data()), str.size()};
+}
+
+std::string ToString(std::span<const std::byte> bytes)
+{
+  return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+}  // namespace
+
+class CookedAssetStoreTest : public ::testing::Test
+{
+protected:
+  static constexpr const char* kDirectory = "CookedAssetStoreTest.cooked";
+
+  void SetUp() override
+  {
+    asset::remove_all(kDirectory);
+    asset::create_directories(kDirectory);
+  }
+
+  void TearDown() override { asset::remove_all(kDirectory); }
+};
+
+TEST_F(CookedAssetStoreTest, WriteThenFind)
+{
+  const CookedAssetStore store{kDirectory};
+  const Hash key{123};
+  const std::string pixels(3 * 4 * 4, 'x');
+  ASSERT_TRUE(store.write(key, PixelInfo{.width = 3, .height = 4, .channels = 4}, AsBytes(pixels)).has_value());
+
+  const auto cooked = store.find<PixelInfo>(key);
+  ASSERT_TRUE(cooked.has_value());
+  ASSERT_EQ(cooked->info.width, 3);
+  ASSERT_EQ(cooked->info.height, 4);
+  ASSERT_EQ(cooked->info.channels, 4);
+  ASSERT_EQ(ToString(cooked->payload), pixels);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(cooked->payload.data()) % CookedAssetStore::kPayloadAlignment, 0UL);
+}
+
+TEST_F(CookedAssetStoreTest, MissingKey)
+{
+  const CookedAssetStore store{kDirectory};
+  ASSERT_FALSE(store.find<PixelInfo>(Hash{1}).has_value());
+}
+
+TEST_F(CookedAssetStoreTest, InfoTypeMismatch)
+{
+  const CookedAssetStore store{kDirectory};
+  const Hash key{5};
+  ASSERT_TRUE(store.write(key, PixelInfo{}, AsBytes("data")).has_value());
+  ASSERT_FALSE(store.find<OtherInfo>(key).has_value());
+}
+
+TEST_F(CookedAssetStoreTest, KeyMismatch)
+{
+  const CookedAssetStore store{kDirectory};
+  ASSERT_TRUE(store.write(Hash{5}, PixelInfo{}, AsBytes("data")).has_value());
+  asset::rename(store.path(Hash{5}), store.path(Hash{6}));
+  ASSERT_FALSE(store.find<PixelInfo>(Hash{6}).has_value());
+}
+
+TEST_F(CookedAssetStoreTest, Truncated)
+{
+  const CookedAssetStore store{kDirectory};
+  const Hash key{7};
+  ASSERT_TRUE(store.write(key, PixelInfo{}, AsBytes(std::string(100, 'y'))).has_value());
+  std::filesystem::resize_file(store.path(key), std::filesystem::file_size(store.path(key)) - 1);
+  ASSERT_FALSE(store.find<PixelInfo>(key).has_value());
+}
+
+TEST_F(CookedAssetStoreTest, SourceHashMatchesContent)
+{
+  const auto path_a = asset::path{kDirectory} / "a.txt";
+  const auto path_b = asset::path{kDirectory} / "b.txt";
+  std::ofstream{path_a} << "same";
+  std::ofstream{path_b} << "same";
+
+  const CookedAssetStore store{kDirectory};
+  const auto hash_a = store.source_hash(path_a);
+  const auto hash_b = store.source_hash(path_b);
+  ASSERT_TRUE(hash_a.has_value());
+  ASSERT_TRUE(hash_b.has_value());
+  ASSERT_EQ(hash_a->value, hash_b->value);
+  ASSERT_FALSE(store.source_hash(asset::path{kDirectory} / "missing.txt").has_value());
+}
+
+TEST_F(CookedAssetStoreTest, FindFromPack)
+{
+  static constexpr const char* kPackPath = "CookedAssetStoreTest.pack";
+  const Hash key{42};
+  {
+    const CookedAssetStore store{kDirectory};
+    ASSERT_TRUE(store.write(key, PixelInfo{.width = 1, .height = 1, .channels = 1}, AsBytes("p")).has_value());
+
+    auto writer_or_error = AssetPackWriter::create(kPackPath);
+    ASSERT_TRUE(writer_or_error.has_value());
+    ASSERT_TRUE(writer_or_error->add_directory(kDirectory).has_value());
+    ASSERT_TRUE(writer_or_error->finish().has_value());
+  }
+  asset::remove_all(kDirectory);
+
+  auto pack_or_error = AssetPack::open(kPackPath);
+  ASSERT_TRUE(pack_or_error.has_value());
+
+  auto file_system = std::make_shared<AssetFileSystem>();
+  file_system->mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), kDirectory);
+
+  const CookedAssetStore store{kDirectory, file_system};
+  const auto cooked = store.find<PixelInfo>(key);
+  ASSERT_TRUE(cooked.has_value());
+  ASSERT_EQ(ToString(cooked->payload), "p");
+  std::filesystem::remove(kPackPath);
+}
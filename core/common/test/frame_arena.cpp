@@ -0,0 +1,152 @@
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/format.hpp"
+#include "sde/memory.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+std::atomic<std::size_t> global_allocation_count = 0;
+
+void* counted_allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+{
+  global_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  bytes = std::max<std::size_t>(bytes, 1UL);
+  // aligned_alloc requires a size which is a multiple of the alignment
+  if (alignment <= alignof(std::max_align_t))
+  {
+    return std::malloc(bytes);
+  }
+  return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+}
+
+void* counted_allocate_or_throw(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t))
+{
+  if (void* ptr = counted_allocate(bytes, alignment); ptr != nullptr)
+  {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+struct Vertex
+{
+  float x, y;
+};
+
+template <typename T> using graphics_vector = std::vector<T, tagged_allocator<T, MemoryTag::kGraphics>>;
+
+}  // namespace
+
+// Every replaceable form of operator new and delete is replaced, so that allocations from each form are counted, and
+// are released by the matching deallocation function
+
+void* operator new(std::size_t bytes) { return counted_allocate_or_throw(bytes); }
+void* operator new[](std::size_t bytes) { return counted_allocate_or_throw(bytes); }
+void* operator new(std::size_t bytes, std::align_val_t alignment)
+{
+  return counted_allocate_or_throw(bytes, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t bytes, std::align_val_t alignment)
+{
+  return counted_allocate_or_throw(bytes, static_cast<std::size_t>(alignment));
+}
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept { return counted_allocate(bytes); }
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept { return counted_allocate(bytes); }
+void* operator new(std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return counted_allocate(bytes, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return counted_allocate(bytes, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+TEST(FrameArena, FormatShortString)
+{
+  ArenaMemoryResource arena;
+  const char* str = format(arena, "pos: (%.3f, %.3f)", 1.0, 2.0);
+  ASSERT_STREQ(str, "pos: (1.000, 2.000)");
+  ASSERT_EQ(arena.used(), std::strlen(str) + 1);
+}
+
+TEST(FrameArena, FormatLongerThanBuffer)
+{
+  ArenaMemoryResource arena;
+  const std::string expected(300, 'x');
+  const char* str = format<16>(arena, "%s", expected.c_str());
+  ASSERT_EQ(std::string{str}, expected);
+}
+
+TEST(FrameArena, FormattedStringsAreIndependent)
+{
+  ArenaMemoryResource arena;
+  const char* a = format(arena, "%d", 1);
+  const char* b = format(arena, "%d", 2);
+  ASSERT_STREQ(a, "1");
+  ASSERT_STREQ(b, "2");
+}
+
+TEST(FrameArena, SteadyStateFrameDoesNotAllocate)
+{
+  ArenaMemoryResource frame_arena{4096};
+  graphics_vector<Vertex> vertices;
+
+  // Labels are longer than the default format buffer, so that each one takes the growth path
+  const std::string padding(200, ' ');
+
+  const auto run_frame = [&](int frame) {
+    // Mirrors RenderBuffer::reset(frame_arena), which rebinds buffers at the start of every frame
+    vertices = graphics_vector<Vertex>{tagged_allocator<Vertex, MemoryTag::kGraphics>{&frame_arena}};
+    for (int i = 0; i < 500; ++i)
+    {
+      vertices.push_back({static_cast<float>(i), static_cast<float>(frame)});
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+      [[maybe_unused]] const char* label = format(frame_arena, "entity %d : frame %d : %s", i, frame, padding.c_str());
+    }
+    frame_arena.reset();
+  };
+
+  // Warm-up frame sizes arena blocks
+  run_frame(0);
+
+  const auto graphics_before = memory_stats(MemoryTag::kGraphics);
+  const std::size_t heap_before = global_allocation_count.load();
+  for (int frame = 1; frame <= 10; ++frame)
+  {
+    run_frame(frame);
+  }
+  ASSERT_EQ(global_allocation_count.load(), heap_before);
+
+  // Allocations are still attributed to the graphics tag, even though they come from the arena
+  ASSERT_GT(memory_stats(MemoryTag::kGraphics).allocation_count, graphics_before.allocation_count);
+}
@@ -0,0 +1,181 @@
+// C++ Standard Library
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/hash.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+std::vector<std::uint8_t> RandomBytes(std::size_t len, std::uint32_t seed)
+{
+  std::mt19937 gen{seed};
+  std::uniform_int_distribution<int> dist{0, 255};
+  std::vector<std::uint8_t> bytes(len);
+  for (auto& b : bytes)
+  {
+    b = static_cast<std::uint8_t>(dist(gen));
+  }
+  return bytes;
+}
+
+}  // namespace
+
+TEST(BytesHash, DeterministicWithSeed)
+{
+  const auto bytes = RandomBytes(100, 0);
+  ASSERT_EQ(ComputeBytesHashValue(bytes.data(), bytes.size()), ComputeBytesHashValue(bytes.data(), bytes.size()));
+  ASSERT_NE(ComputeBytesHashValue(bytes.data(), bytes.size(), 0), ComputeBytesHashValue(bytes.data(), bytes.size(), 1));
+}
+
+TEST(BytesHash, ConstantEvaluatedMatchesRuntime)
+{
+  static constexpr std::string_view kShort{"abc"};
+  static constexpr std::string_view kMedium{"abcdefghijklmnopqrstuvwxyz"};
+  static constexpr std::string_view kLong{"sde::game::NativeScriptInstanceData sde::game::NativeScriptInstanceCache"};
+
+  constexpr auto kShortHash = ComputeBytesHashValue(kShort);
+  constexpr auto kMediumHash = ComputeBytesHashValue(kMedium);
+  constexpr auto kLongHash = ComputeBytesHashValue(kLong);
+
+  const void* short_data = kShort.data();
+  const void* medium_data = kMedium.data();
+  const void* long_data = kLong.data();
+  ASSERT_EQ(kShortHash, ComputeBytesHashValue(short_data, kShort.size()));
+  ASSERT_EQ(kMediumHash, ComputeBytesHashValue(medium_data, kMedium.size()));
+  ASSERT_EQ(kLongHash, ComputeBytesHashValue(long_data, kLong.size()));
+}
+
+TEST(BytesHash, EveryLengthDiffers)
+{
+  const auto bytes = RandomBytes(256, 1);
+  std::unordered_set<std::uint64_t> seen;
+  for (std::size_t len = 0; len <= bytes.size(); ++len)
+  {
+    ASSERT_TRUE(seen.insert(ComputeBytesHashValue(bytes.data(), len)).second) << "length: " << len;
+  }
+}
+
+TEST(BytesHash, StreamingMatchesOneShot)
+{
+  const auto bytes = RandomBytes(300, 2);
+  for (std::size_t len = 0; len <= bytes.size(); ++len)
+  {
+    const auto expected = ComputeBytesHashValue(bytes.data(), len);
+    for (std::size_t chunk_len : {1UL, 3UL, 16UL, 47UL, 48UL, 49UL, 96UL, 300UL})
+    {
+      BytesHasher hasher;
+      for (std::size_t offset = 0; offset < len; offset += chunk_len)
+      {
+        hasher.update(bytes.data() + offset, std::min(chunk_len, len - offset));
+      }
+      ASSERT_EQ(hasher.digest(), expected) << "length: " << len << ", chunk: " << chunk_len;
+    }
+  }
+}
+
+TEST(BytesHash, NoCollisionsOnSequentialKeys)
+{
+  static constexpr std::uint64_t kKeyCount = 1UL << 18UL;
+  std::unordered_set<std::uint64_t> seen;
+  seen.reserve(kKeyCount);
+  for (std::uint64_t key = 0; key < kKeyCount; ++key)
+  {
+    ASSERT_TRUE(seen.insert(ComputeBytesHashValue(&key, sizeof(key))).second) << "key: " << key;
+  }
+}
+
+TEST(BytesHash, UniformBucketDistribution)
+{
+  static constexpr std::size_t kBucketCount = 256;
+  static constexpr std::size_t kKeyCount = kBucketCount * 1024;
+
+  // Check both low and high bits, which are used by power-of-two and modulo bucketing, respectively
+  for (const int shift : {0, 28, 56})
+  {
+    std::array<std::size_t, kBucketCount> counts{};
+    for (std::uint64_t key = 0; key < kKeyCount; ++key)
+    {
+      ++counts[(ComputeBytesHashValue(&key, sizeof(key)) >> shift) % kBucketCount];
+    }
+
+    // Chi-squared statistic, with 255 degrees of freedom; p = 0.001 critical value is ~330.5
+    const double expected_count = static_cast<double>(kKeyCount) / kBucketCount;
+    double chi_squared = 0.0;
+    for (const auto c : counts)
+    {
+      const double d = static_cast<double>(c) - expected_count;
+      chi_squared += (d * d) / expected_count;
+    }
+    ASSERT_LT(chi_squared, 330.5) << "shift: " << shift;
+  }
+}
+
+TEST(BytesHash, Avalanche)
+{
+  // Flipping any single input bit should flip roughly half of the output bits
+  for (const std::size_t len : {4UL, 8UL, 16UL, 33UL, 100UL})
+  {
+    auto bytes = RandomBytes(len, 3);
+    const auto original = ComputeBytesHashValue(bytes.data(), len);
+
+    std::size_t flipped_total = 0;
+    for (std::size_t bit = 0; bit < len * 8; ++bit)
+    {
+      bytes[bit / 8] ^= static_cast<std::uint8_t>(1U << (bit % 8));
+      const auto flipped = std::bitset<64>{ComputeBytesHashValue(bytes.data(), len) ^ original}.count();
+      bytes[bit / 8] ^= static_cast<std::uint8_t>(1U << (bit % 8));
+      ASSERT_GT(flipped, 0UL);
+      flipped_total += flipped;
+    }
+
+    const double flipped_ratio = static_cast<double>(flipped_total) / static_cast<double>(len * 8 * 64);
+    ASSERT_NEAR(flipped_ratio, 0.5, 0.05) << "length: " << len;
+  }
+}
+
+TEST(Hasher, ContiguousTrivialRangeUsesBytesHash)
+{
+  const std::vector<int> values = {1, 2, 3, 4, 5};
+  const void* data = values.data();
+  ASSERT_EQ(Hasher<std::vector<int>>{}(values), ComputeBytesHashValue(data, values.size() * sizeof(int)));
+}
+
+TEST(Hasher, ContiguousTrivialRangeDiffersOnChange)
+{
+  std::vector<float> values = {1.F, 2.F, 3.F};
+  const auto before = Hasher<std::vector<float>>{}(values);
+  values[1] = 2.5F;
+  ASSERT_NE(before, Hasher<std::vector<float>>{}(values));
+}
+
+TEST(Hasher, PaddedElementsHashedElementWise)
+{
+  struct Padded
+  {
+    char c;
+    int i;
+  };
+  static_assert(!is_trivially_bytes_hashable_v<Padded>);
+  static_assert(is_trivially_bytes_hashable_v<int>);
+  static_assert(is_trivially_bytes_hashable_v<double>);
+
+  const std::vector<std::pair<char, int>> values = {{'a', 1}, {'b', 2}};
+  Hash expected;
+  for (const auto& v : values)
+  {
+    expected += Hasher<std::pair<char, int>>{}(v);
+  }
+  ASSERT_EQ((Hasher<std::vector<std::pair<char, int>>>{}(values)), expected);
+}
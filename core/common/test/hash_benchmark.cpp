@@ -0,0 +1,79 @@
+// C++ Standard Library
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/hash.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+std::vector<std::uint8_t> MakeBytes(std::size_t len)
+{
+  std::vector<std::uint8_t> bytes(len);
+  std::iota(bytes.begin(), bytes.end(), 0);
+  return bytes;
+}
+
+}  // namespace
+
+static void BM_BytesHash(benchmark::State& state)
+{
+  const auto bytes = MakeBytes(state.range(0));
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(ComputeBytesHashValue(bytes.data(), bytes.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BytesHash)->RangeMultiplier(4)->Range(8, 1 << 20);
+
+static void BM_BytesHashStreaming(benchmark::State& state)
+{
+  static constexpr std::size_t kChunkLen = 4096;
+  const auto bytes = MakeBytes(state.range(0));
+  for (auto _ : state)
+  {
+    BytesHasher hasher;
+    for (std::size_t offset = 0; offset < bytes.size(); offset += kChunkLen)
+    {
+      hasher.update(bytes.data() + offset, std::min(kChunkLen, bytes.size() - offset));
+    }
+    benchmark::DoNotOptimize(hasher.digest());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BytesHashStreaming)->RangeMultiplier(4)->Range(8, 1 << 20);
+
+static void BM_ElementWiseHash(benchmark::State& state)
+{
+  const auto bytes = MakeBytes(state.range(0));
+  for (auto _ : state)
+  {
+    Hash h;
+    for (const auto b : bytes)
+    {
+      h += Hasher<std::uint8_t>{}(b);
+    }
+    benchmark::DoNotOptimize(h);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ElementWiseHash)->RangeMultiplier(4)->Range(8, 1 << 20);
+
+static void BM_HasherVectorFloat(benchmark::State& state)
+{
+  const std::vector<float> values(state.range(0), 1.F);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(Hasher<std::vector<float>>{}(values));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+BENCHMARK(BM_HasherVectorFloat)->RangeMultiplier(8)->Range(8, 1 << 16);
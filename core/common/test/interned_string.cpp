@@ -0,0 +1,150 @@
+// C++ Standard Library
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/interned_string.hpp"
+#include "sde/interned_string_io.hpp"
+#include "sde/serialization_binary_file.hpp"
+#include "sde/string.hpp"
+#include "sde/unordered_map.hpp"
+
+using namespace sde;
+using namespace sde::serial;
+
+TEST(InternedString, DefaultIsEmpty)
+{
+  InternedString str;
+  ASSERT_TRUE(str.empty());
+  ASSERT_EQ(str.id(), 0U);
+  ASSERT_EQ(str.str(), "");
+  ASSERT_EQ(str, InternedString{""});
+}
+
+TEST(InternedString, SameTextSameId)
+{
+  const InternedString a{"InternedString.SameTextSameId"};
+  const std::string text{"InternedString.SameTextSameId"};
+  const InternedString b{text};
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(a.id(), b.id());
+  ASSERT_EQ(a.str().data(), b.str().data());
+  ASSERT_EQ(a.str(), text);
+  ASSERT_EQ(std::string_view{a.c_str()}, text);
+}
+
+TEST(InternedString, DifferentTextDifferentId)
+{
+  const InternedString a{"InternedString.DifferentTextDifferentId.a"};
+  const InternedString b{"InternedString.DifferentTextDifferentId.b"};
+  ASSERT_NE(a, b);
+  ASSERT_NE(a.id(), b.id());
+}
+
+TEST(InternedString, FindDoesNotIntern)
+{
+  const auto count = InternedString::count();
+  ASSERT_FALSE(InternedString::find("InternedString.FindDoesNotIntern").has_value());
+  ASSERT_EQ(InternedString::count(), count);
+
+  const InternedString str{"InternedString.FindDoesNotIntern"};
+  const auto found = InternedString::find("InternedString.FindDoesNotIntern");
+  ASSERT_TRUE(found.has_value());
+  ASSERT_EQ(*found, str);
+}
+
+TEST(InternedString, ViewsRemainValid)
+{
+  const InternedString first{"InternedString.ViewsRemainValid"};
+  const auto view = first.str();
+  for (int i = 0; i < 1000; ++i)
+  {
+    [[maybe_unused]] const InternedString other{"InternedString.ViewsRemainValid." + std::to_string(i)};
+  }
+  ASSERT_EQ(view.data(), first.str().data());
+  ASSERT_EQ(view, "InternedString.ViewsRemainValid");
+}
+
+TEST(InternedString, ConcurrentInterning)
+{
+  std::vector<std::thread> threads;
+  std::vector<InternedString::id_type> ids(8);
+  for (std::size_t t = 0; t < ids.size(); ++t)
+  {
+    threads.emplace_back([&ids, t] {
+      for (int i = 0; i < 100; ++i)
+      {
+        [[maybe_unused]] const InternedString other{"InternedString.ConcurrentInterning." + std::to_string(i)};
+      }
+      ids[t] = InternedString{"InternedString.ConcurrentInterning"}.id();
+    });
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  for (const auto id : ids)
+  {
+    ASSERT_EQ(id, ids.front());
+  }
+}
+
+TEST(InternedString, Hashable)
+{
+  sde::unordered_map<InternedString, int> lookup;
+  lookup.emplace(InternedString{"InternedString.Hashable"}, 1);
+  ASSERT_EQ(lookup.count(InternedString{"InternedString.Hashable"}), 1UL);
+  ASSERT_EQ(Hasher<InternedString>{}(InternedString{"InternedString.Hashable"}).value, lookup.begin()->first.id());
+}
+
+TEST(InternedString, Streamable)
+{
+  std::ostringstream oss;
+  oss << InternedString{"InternedString.Streamable"};
+  ASSERT_EQ(oss.str(), "InternedString.Streamable");
+}
+
+TEST(StringHash, TransparentLookup)
+{
+  sde::unordered_map<sde::string, int, string_hash, std::equal_to<>> lookup;
+  lookup.emplace("key", 1);
+
+  const std::string_view view{"key"};
+  ASSERT_NE(lookup.find(view), lookup.end());
+  ASSERT_NE(lookup.find("key"), lookup.end());
+  ASSERT_NE(lookup.find(InternedString{"key"}.str()), lookup.end());
+  ASSERT_EQ(lookup.find(std::string_view{"other"}), lookup.end());
+}
+
+TEST(InternedStringIO, SaveLoad)
+{
+  const InternedString target_value{"InternedStringIO.SaveLoad"};
+
+  if (auto ofs_or_error = file_ostream::create("InternedString.bin"); ofs_or_error.has_value())
+  {
+    binary_oarchive oar{*ofs_or_error};
+    ASSERT_NO_THROW((oar << named{"interned_string", target_value}));
+  }
+  else
+  {
+    FAIL() << ofs_or_error.error();
+  }
+
+  if (auto ifs_or_error = file_istream::create("InternedString.bin"); ifs_or_error.has_value())
+  {
+    binary_iarchive iar{*ifs_or_error};
+    InternedString read_value;
+    ASSERT_NO_THROW((iar >> named{"interned_string", read_value}));
+    ASSERT_EQ(target_value, read_value);
+  }
+  else
+  {
+    FAIL() << ifs_or_error.error();
+  }
+}
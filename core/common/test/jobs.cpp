@@ -0,0 +1,358 @@
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/jobs.hpp"
+
+using namespace sde::jobs;
+
+class JobSystemTest : public ::testing::TestWithParam<std::size_t>
+{};
+
+TEST_P(JobSystemTest, SubmitAndWait)
+{
+  JobSystem jobs{GetParam()};
+  ASSERT_EQ(jobs.workers(), GetParam());
+
+  std::atomic<int> count = 0;
+  Counter counter;
+  for (int i = 0; i < 100; ++i)
+  {
+    jobs.submit([&count] { ++count; }, {.signal = &counter});
+  }
+  jobs.wait(counter);
+
+  EXPECT_EQ(count.load(), 100);
+  EXPECT_TRUE(counter.done());
+}
+
+TEST_P(JobSystemTest, WaitOnDoneCounterReturns)
+{
+  JobSystem jobs{GetParam()};
+  Counter counter;
+  jobs.wait(counter);
+  EXPECT_TRUE(counter.done());
+}
+
+TEST_P(JobSystemTest, DependentJobStartsAfterDependencies)
+{
+  JobSystem jobs{GetParam()};
+
+  std::atomic<int> finished = 0;
+  int seen_by_dependent = -1;
+  Counter first;
+  Counter done;
+  for (int i = 0; i < 8; ++i)
+  {
+    jobs.submit([&finished] { ++finished; }, {.signal = &first});
+  }
+  jobs.submit([&] { seen_by_dependent = finished.load(); }, {.signal = &done, .after = &first});
+  jobs.wait(done);
+
+  EXPECT_EQ(seen_by_dependent, 8);
+}
+
+TEST_P(JobSystemTest, SignalReleasesWaitingJobs)
+{
+  JobSystem jobs{GetParam()};
+
+  Counter gate{2};
+  Counter done;
+  std::atomic<bool> ran = false;
+  jobs.submit([&ran] { ran = true; }, {.signal = &done, .after = &gate});
+
+  jobs.signal(gate);
+  EXPECT_FALSE(gate.done());
+  EXPECT_FALSE(done.done());
+
+  jobs.signal(gate);
+  jobs.wait(done);
+  EXPECT_TRUE(ran.load());
+}
+
+TEST_P(JobSystemTest, DependencyChain)
+{
+  JobSystem jobs{GetParam()};
+
+  static constexpr std::size_t kLength = 64;
+  std::vector<std::size_t> order;
+  std::vector<Counter> links(kLength);
+  Counter done;
+  for (std::size_t i = 0; i < kLength; ++i)
+  {
+    jobs.submit(
+      [&order, i] { order.push_back(i); },
+      {.signal = &links[i], .after = (i == 0) ? nullptr : &links[i - 1]});
+  }
+  jobs.wait(links.back());
+
+  std::vector<std::size_t> expected(kLength);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(order, expected);
+}
+
+TEST_P(JobSystemTest, MainAffinityJobsRunOnMainThread)
+{
+  JobSystem jobs{GetParam()};
+  ASSERT_TRUE(jobs.isMainThread());
+
+  const auto main_thread = std::this_thread::get_id();
+  std::atomic<int> on_main = 0;
+  Counter counter;
+  for (int i = 0; i < 16; ++i)
+  {
+    jobs.submit(
+      [&] { on_main += (std::this_thread::get_id() == main_thread); },
+      {.signal = &counter, .affinity = Affinity::kMain});
+  }
+  jobs.wait(counter);
+
+  EXPECT_EQ(on_main.load(), 16);
+}
+
+TEST_P(JobSystemTest, MainAffinityJobsSubmittedFromWorkers)
+{
+  JobSystem jobs{GetParam()};
+
+  const auto main_thread = std::this_thread::get_id();
+  std::atomic<int> on_main = 0;
+  Counter posted;
+  Counter done;
+  for (int i = 0; i < 16; ++i)
+  {
+    jobs.submit(
+      [&] {
+        jobs.submit(
+          [&] { on_main += (std::this_thread::get_id() == main_thread); },
+          {.signal = &done, .affinity = Affinity::kMain});
+      },
+      {.signal = &posted});
+  }
+  jobs.wait(posted);
+  jobs.wait(done);
+
+  EXPECT_EQ(on_main.load(), 16);
+}
+
+TEST_P(JobSystemTest, RunMainJobs)
+{
+  JobSystem jobs{GetParam()};
+
+  int count = 0;
+  jobs.submit([&count] { ++count; }, {.affinity = Affinity::kMain});
+  jobs.submit([&count] { ++count; }, {.affinity = Affinity::kMain});
+
+  EXPECT_EQ(jobs.runMainJobs(), 2UL);
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(jobs.runMainJobs(), 0UL);
+}
+
+TEST_P(JobSystemTest, ParallelForVisitsEachIndexOnce)
+{
+  JobSystem jobs{GetParam()};
+
+  std::vector<std::atomic<int>> visits(1000);
+  jobs.parallel_for(0, visits.size(), 7, [&visits](std::size_t i) { ++visits[i]; });
+
+  for (const auto& v : visits)
+  {
+    ASSERT_EQ(v.load(), 1);
+  }
+}
+
+TEST_P(JobSystemTest, ParallelForEmptyRange)
+{
+  JobSystem jobs{GetParam()};
+
+  int count = 0;
+  jobs.parallel_for(5, 5, 1, [&count](std::size_t) { ++count; });
+  jobs.parallel_for(0, 3, 0, [&count](std::size_t) { ++count; });
+
+  EXPECT_EQ(count, 3);
+}
+
+TEST_P(JobSystemTest, NestedParallelFor)
+{
+  JobSystem jobs{GetParam()};
+
+  std::atomic<std::size_t> sum = 0;
+  jobs.parallel_for(0, 16, 1, [&](std::size_t i) {
+    jobs.parallel_for(0, 16, 4, [&](std::size_t j) { sum += i * 16 + j; });
+  });
+
+  EXPECT_EQ(sum.load(), (256UL * 255UL) / 2UL);
+}
+
+TEST_P(JobSystemTest, DestructorFinishesQueuedJobs)
+{
+  std::atomic<int> count = 0;
+  {
+    JobSystem jobs{GetParam()};
+    for (int i = 0; i < 100; ++i)
+    {
+      jobs.submit([&count] { ++count; });
+    }
+  }
+  EXPECT_EQ(count.load(), (GetParam() == 0) ? 0 : 100);
+}
+
+INSTANTIATE_TEST_SUITE_P(Workers, JobSystemTest, ::testing::Values(0UL, 1UL, 4UL));
+
+TEST(JobSystem, JobsAreStolenFromWorkerQueues)
+{
+  JobSystem jobs{4};
+
+  // Jobs spawned by a single worker only finish once four threads run them at once, so they must be stolen
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<int> arrived = 0;
+  Counter counter;
+  jobs.submit(
+    [&] {
+      for (int i = 0; i < 4; ++i)
+      {
+        jobs.submit(
+          [&] {
+            {
+              std::lock_guard lock{mutex};
+              threads.insert(std::this_thread::get_id());
+            }
+            ++arrived;
+            while (arrived.load() < 4)
+            {
+              std::this_thread::yield();
+            }
+          },
+          {.signal = &counter});
+      }
+    },
+    {.signal = &counter});
+  jobs.wait(counter);
+
+  EXPECT_EQ(threads.size(), 4UL);
+}
+
+// Stress tests; meant to be run with --config=tsan
+
+TEST(JobSystemStress, ManySmallJobs)
+{
+  JobSystem jobs{8};
+
+  static constexpr int kRounds = 50;
+  static constexpr int kJobs = 2000;
+  for (int round = 0; round < kRounds; ++round)
+  {
+    std::atomic<int> count = 0;
+    Counter counter;
+    for (int i = 0; i < kJobs; ++i)
+    {
+      jobs.submit([&count] { count.fetch_add(1, std::memory_order_relaxed); }, {.signal = &counter});
+    }
+    jobs.wait(counter);
+    ASSERT_EQ(count.load(), kJobs);
+  }
+}
+
+TEST(JobSystemStress, RecursiveSpawning)
+{
+  JobSystem jobs{8};
+
+  // Binary tree of jobs, each of which spawns its children from a worker
+  std::atomic<int> leaves = 0;
+  Counter counter;
+  std::function<void(int)> spawn = [&](int depth) {
+    if (depth == 0)
+    {
+      ++leaves;
+      return;
+    }
+    jobs.submit([&spawn, depth] { spawn(depth - 1); }, {.signal = &counter});
+    jobs.submit([&spawn, depth] { spawn(depth - 1); }, {.signal = &counter});
+  };
+  spawn(12);
+  jobs.wait(counter);
+
+  EXPECT_EQ(leaves.load(), 1 << 12);
+}
+
+TEST(JobSystemStress, DependencyGraph)
+{
+  JobSystem jobs{8};
+
+  // Layers of jobs, each of which waits on every job of the layer before it
+  static constexpr int kLayers = 100;
+  static constexpr int kWidth = 16;
+  std::vector<Counter> layers(kLayers);
+  std::vector<int> finished(kLayers, 0);
+  std::mutex mutex;
+  std::atomic<int> violations = 0;
+  for (int l = 0; l < kLayers; ++l)
+  {
+    for (int w = 0; w < kWidth; ++w)
+    {
+      jobs.submit(
+        [&, l] {
+          std::lock_guard lock{mutex};
+          violations += (l > 0) and (finished[l - 1] != kWidth);
+          ++finished[l];
+        },
+        {.signal = &layers[l], .after = (l == 0) ? nullptr : &layers[l - 1]});
+    }
+  }
+  jobs.wait(layers.back());
+
+  EXPECT_EQ(violations.load(), 0);
+  EXPECT_EQ(finished.back(), kWidth);
+}
+
+TEST(JobSystemStress, ConcurrentSubmitters)
+{
+  JobSystem jobs{4};
+
+  // Threads which are neither workers nor the main thread submit and wait at the same time
+  std::atomic<int> count = 0;
+  std::vector<std::thread> submitters;
+  for (int t = 0; t < 4; ++t)
+  {
+    submitters.emplace_back([&] {
+      for (int round = 0; round < 20; ++round)
+      {
+        Counter counter;
+        for (int i = 0; i < 100; ++i)
+        {
+          jobs.submit([&count] { count.fetch_add(1, std::memory_order_relaxed); }, {.signal = &counter});
+        }
+        jobs.wait(counter);
+      }
+    });
+  }
+  for (auto& submitter : submitters)
+  {
+    submitter.join();
+  }
+
+  EXPECT_EQ(count.load(), 4 * 20 * 100);
+}
+
+TEST(JobSystemStress, ParallelForReduction)
+{
+  JobSystem jobs{8};
+
+  static constexpr std::size_t kCount = 100000;
+  for (int round = 0; round < 10; ++round)
+  {
+    std::atomic<std::size_t> sum = 0;
+    jobs.parallel_for(0, kCount, 256, [&sum](std::size_t i) { sum.fetch_add(i, std::memory_order_relaxed); });
+    ASSERT_EQ(sum.load(), (kCount * (kCount - 1)) / 2);
+  }
+}
@@ -0,0 +1,140 @@
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/jobs.hpp"
+
+namespace
+{
+
+/// Stand-in for a small unit of work
+void Work(std::atomic<std::size_t>& sink, std::size_t i) { sink.fetch_add(i, std::memory_order_relaxed); }
+
+}  // namespace
+
+static void BM_JobsSubmitWait(benchmark::State& state)
+{
+  sde::jobs::JobSystem jobs{4};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::atomic<std::size_t> sink = 0;
+  for (auto _ : state)
+  {
+    sde::jobs::Counter counter;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      jobs.submit([&sink, i] { Work(sink, i); }, {.signal = &counter});
+    }
+    jobs.wait(counter);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JobsSubmitWait)->Arg(1)->Arg(64)->Arg(1024);
+
+static void BM_AsyncSubmitWait(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::atomic<std::size_t> sink = 0;
+  std::vector<std::future<void>> futures;
+  futures.reserve(count);
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      futures.push_back(std::async(std::launch::async, [&sink, i] { Work(sink, i); }));
+    }
+    for (auto& f : futures)
+    {
+      f.wait();
+    }
+    futures.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsyncSubmitWait)->Arg(1)->Arg(64)->Arg(1024);
+
+static void BM_JobsDependencyChain(benchmark::State& state)
+{
+  sde::jobs::JobSystem jobs{4};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::atomic<std::size_t> sink = 0;
+  for (auto _ : state)
+  {
+    std::vector<sde::jobs::Counter> links(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      jobs.submit([&sink, i] { Work(sink, i); }, {.signal = &links[i], .after = (i == 0) ? nullptr : &links[i - 1]});
+    }
+    jobs.wait(links.back());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JobsDependencyChain)->Arg(64);
+
+static void BM_AsyncDependencyChain(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::atomic<std::size_t> sink = 0;
+  for (auto _ : state)
+  {
+    std::shared_future<void> previous;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      previous = std::async(std::launch::async, [&sink, i, previous] {
+                   if (previous.valid())
+                   {
+                     previous.wait();
+                   }
+                   Work(sink, i);
+                 }).share();
+    }
+    previous.wait();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsyncDependencyChain)->Arg(64);
+
+static void BM_JobsParallelFor(benchmark::State& state)
+{
+  sde::jobs::JobSystem jobs{4};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  std::atomic<std::size_t> sink = 0;
+  for (auto _ : state)
+  {
+    jobs.parallel_for(0, count, count / 16, [&sink](std::size_t i) { Work(sink, i); });
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JobsParallelFor)->Arg(1 << 16);
+
+static void BM_AsyncParallelFor(benchmark::State& state)
+{
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const std::size_t grain = count / 16;
+  std::atomic<std::size_t> sink = 0;
+  std::vector<std::future<void>> futures;
+  for (auto _ : state)
+  {
+    for (std::size_t first = 0; first < count; first += grain)
+    {
+      futures.push_back(std::async(std::launch::async, [&sink, first, grain] {
+        for (std::size_t i = first; i < first + grain; ++i)
+        {
+          Work(sink, i);
+        }
+      }));
+    }
+    for (auto& f : futures)
+    {
+      f.wait();
+    }
+    futures.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsyncParallelFor)->Arg(1 << 16);
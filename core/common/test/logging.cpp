@@ -0,0 +1,206 @@
+// C++ Standard Library
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/logging.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+constexpr std::chrono::milliseconds kRateLimitPeriod{100};
+
+std::vector<std::string> Lines(const std::string& text)
+{
+  std::vector<std::string> lines;
+  std::istringstream iss{text};
+  for (std::string line; std::getline(iss, line);)
+  {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+struct LogsWhenWritten
+{};
+
+std::ostream& operator<<(std::ostream& os, const LogsWhenWritten&)
+{
+  SDE_LOG_INFO() << "nested";
+  return os << "outer";
+}
+
+void LogThenCrash()
+{
+  InstallLogCrashHandlers();
+  SetLogSink(&std::cerr);
+  SDE_LOG_INFO() << "before crash";
+  std::raise(SIGSEGV);
+}
+
+void LogThenTerminate()
+{
+  InstallLogCrashHandlers();
+  SetLogSink(&std::cerr);
+  SDE_LOG_INFO() << "before terminate";
+  std::terminate();
+}
+
+}  // namespace
+
+class LogTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { SetLogSink(&sink_); }
+
+  void TearDown() override
+  {
+    SetLogSink(nullptr);
+    SetLogThreshold(LogSeverity::kDebug);
+  }
+
+  std::vector<std::string> written()
+  {
+    FlushLog();
+    return Lines(sink_.str());
+  }
+
+  std::ostringstream sink_;
+};
+
+TEST_F(LogTest, MessageWritten)
+{
+  SDE_LOG_INFO() << "value=" << 5;
+  const auto lines = written();
+  ASSERT_EQ(lines.size(), 1UL);
+  ASSERT_NE(lines.front().find("value=5"), std::string::npos);
+  ASSERT_NE(lines.front().find("Info"), std::string::npos);
+}
+
+TEST_F(LogTest, OrderPreservedPerThread)
+{
+  static constexpr int kThreadCount = 4;
+  static constexpr int kMessageCount = 2000;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    threads.emplace_back([t] {
+      for (int i = 0; i < kMessageCount; ++i)
+      {
+        sde::Log{LogSeverity::kInfo} << t << ' ' << i;
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::vector<int> next(kThreadCount, 0);
+  for (const auto& line : written())
+  {
+    std::istringstream iss{line};
+    int t = 0;
+    int i = 0;
+    iss >> t >> i;
+    ASSERT_EQ(i, next[t]) << "thread=" << t;
+    ++next[t];
+  }
+  for (int t = 0; t < kThreadCount; ++t)
+  {
+    ASSERT_EQ(next[t], kMessageCount) << "thread=" << t;
+  }
+}
+
+TEST_F(LogTest, BelowThresholdNotFormatted)
+{
+  SetLogThreshold(LogSeverity::kWarn);
+  ASSERT_FALSE(LogEnabled(LogSeverity::kInfo));
+  ASSERT_TRUE(LogEnabled(LogSeverity::kError));
+
+  bool formatted = false;
+  const auto format = [&formatted] {
+    formatted = true;
+    return "hidden";
+  };
+  SDE_LOG_INFO() << format();
+  SDE_LOG_WARN() << "shown";
+  ASSERT_FALSE(formatted);
+
+  const auto lines = written();
+  ASSERT_EQ(lines.size(), 1UL);
+  ASSERT_NE(lines.front().find("shown"), std::string::npos);
+}
+
+TEST_F(LogTest, RateLimited)
+{
+  // Rate limits are per log site, and persist across repeated runs of the test
+  std::this_thread::sleep_for(kRateLimitPeriod);
+  for (int i = 0; i < 100; ++i)
+  {
+    SDE_LOG_WARN_RATE_LIMITED(kRateLimitPeriod) << "limited";
+  }
+  ASSERT_EQ(written().size(), 1UL);
+}
+
+TEST_F(LogTest, RateLimitedReportsSuppressed)
+{
+  std::this_thread::sleep_for(kRateLimitPeriod);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 10; ++j)
+    {
+      SDE_LOG_WARN_RATE_LIMITED(kRateLimitPeriod) << "limited";
+    }
+    std::this_thread::sleep_for(kRateLimitPeriod);
+  }
+  const auto lines = written();
+  ASSERT_EQ(lines.size(), 2UL);
+  ASSERT_NE(lines[1].find("(9 similar suppressed)"), std::string::npos);
+}
+
+TEST_F(LogTest, LongMessageTruncated)
+{
+  SDE_LOG_INFO() << std::string(kLogMessageMaxLength * 2, 'x');
+  const auto lines = written();
+  ASSERT_EQ(lines.size(), 1UL);
+  ASSERT_EQ(lines.front().size(), kLogMessageMaxLength);
+}
+
+TEST_F(LogTest, NestedMessage)
+{
+  SDE_LOG_INFO() << LogsWhenWritten{};
+  const auto lines = written();
+  ASSERT_EQ(lines.size(), 2UL);
+  ASSERT_NE(lines[0].find("nested"), std::string::npos);
+  ASSERT_NE(lines[1].find("outer"), std::string::npos);
+}
+
+TEST_F(LogTest, FatalWrittenImmediately)
+{
+  SDE_LOG_FATAL() << "fatal";
+  ASSERT_NE(sink_.str().find("fatal"), std::string::npos);
+}
+
+TEST(LogDeathTest, PendingWrittenOnCrash)
+{
+  ASSERT_DEATH(LogThenCrash(), "before crash");
+}
+
+TEST(LogDeathTest, PendingWrittenOnTerminate)
+{
+  ASSERT_DEATH(LogThenTerminate(), "before terminate");
+}
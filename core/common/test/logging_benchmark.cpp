@@ -0,0 +1,74 @@
+// C++ Standard Library
+#include <chrono>
+#include <fstream>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/logging.hpp"
+
+namespace
+{
+
+/// Stands in for a console which is not read from
+std::ofstream& NullSink()
+{
+  static std::ofstream null_sink{"/dev/null"};
+  return null_sink;
+}
+
+}  // namespace
+
+static void BM_LogSynchronous(benchmark::State& state)
+{
+  // Previous behavior: message written and flushed on the calling thread
+  int i = 0;
+  for (auto _ : state)
+  {
+    sde::Log{&NullSink()} << "[SDE LOG] (" << SDE_LOG_GENERATE_FILE_INFO(sde::LogSeverity::kWarn) << ") frame " << ++i;
+  }
+}
+BENCHMARK(BM_LogSynchronous)->Threads(1)->Threads(4);
+
+static void BM_LogQueued(benchmark::State& state)
+{
+  if (state.thread_index() == 0)
+  {
+    sde::SetLogSink(&NullSink());
+  }
+  int i = 0;
+  for (auto _ : state)
+  {
+    SDE_LOG_WARN() << "frame " << ++i;
+  }
+  if (state.thread_index() == 0)
+  {
+    sde::SetLogSink(nullptr);
+  }
+}
+BENCHMARK(BM_LogQueued)->Threads(1)->Threads(4);
+
+static void BM_LogBelowThreshold(benchmark::State& state)
+{
+  sde::SetLogThreshold(sde::LogSeverity::kError);
+  int i = 0;
+  for (auto _ : state)
+  {
+    SDE_LOG_WARN() << "frame " << ++i;
+  }
+  sde::SetLogThreshold(sde::LogSeverity::kDebug);
+}
+BENCHMARK(BM_LogBelowThreshold);
+
+static void BM_LogRateLimited(benchmark::State& state)
+{
+  sde::SetLogSink(&NullSink());
+  int i = 0;
+  for (auto _ : state)
+  {
+    SDE_LOG_WARN_RATE_LIMITED(std::chrono::seconds{1}) << "frame " << ++i;
+  }
+  sde::SetLogSink(nullptr);
+}
+BENCHMARK(BM_LogRateLimited);
@@ -0,0 +1,267 @@
+// C++ Standard Library
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/memory.hpp"
+#include "sde/string.hpp"
+#include "sde/unordered_map.hpp"
+#include "sde/vector.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+/// Memory resource which counts calls to upstream
+class CountingMemoryResource final : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocate_count = 0;
+  std::size_t deallocate_count = 0;
+
+private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocate_count;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+  {
+    ++deallocate_count;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+template <typename T> using graphics_vector = std::vector<T, tagged_allocator<T, MemoryTag::kGraphics>>;
+
+}  // namespace
+
+TEST(Memory, TracksLiveAndPeakBytes)
+{
+  const auto before = memory_stats(MemoryTag::kGraphics);
+  {
+    graphics_vector<std::uint32_t> v;
+    v.reserve(100);
+    const auto during = memory_stats(MemoryTag::kGraphics);
+    ASSERT_EQ(during.live_bytes - before.live_bytes, 100 * sizeof(std::uint32_t));
+    ASSERT_EQ(during.live_allocations - before.live_allocations, 1UL);
+    ASSERT_EQ(during.allocation_count - before.allocation_count, 1UL);
+    ASSERT_GE(during.peak_bytes, during.live_bytes);
+  }
+  const auto after = memory_stats(MemoryTag::kGraphics);
+  ASSERT_EQ(after.live_bytes, before.live_bytes);
+  ASSERT_EQ(after.live_allocations, before.live_allocations);
+  ASSERT_EQ(after.allocation_count - before.allocation_count, 1UL);
+  ASSERT_GE(after.peak_bytes, before.live_bytes + 100 * sizeof(std::uint32_t));
+
+  reset_memory_peak(MemoryTag::kGraphics);
+  ASSERT_EQ(memory_stats(MemoryTag::kGraphics).peak_bytes, after.live_bytes);
+}
+
+TEST(Memory, TagsAreTrackedSeparately)
+{
+  const auto audio_before = memory_stats(MemoryTag::kAudio);
+  {
+    graphics_vector<std::uint8_t> v(64);
+  }
+  const auto audio_after = memory_stats(MemoryTag::kAudio);
+  ASSERT_EQ(audio_after.allocation_count, audio_before.allocation_count);
+}
+
+TEST(Memory, ReboundAllocatorKeepsTag)
+{
+  const auto before = memory_stats(MemoryTag::kGame);
+  {
+    using game_allocator = tagged_allocator<std::pair<const int, int>, MemoryTag::kGame>;
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, game_allocator> m;
+    m.emplace(1, 2);
+  }
+  const auto after = memory_stats(MemoryTag::kGame);
+  ASSERT_GT(after.allocation_count, before.allocation_count);
+  ASSERT_EQ(after.live_bytes, before.live_bytes);
+}
+
+TEST(Memory, MemoryResourceIsCapturedOnConstruction)
+{
+  CountingMemoryResource counting;
+
+  sde::vector<int> constructed_before;
+  {
+    MemoryResourceScope scope{MemoryTag::kDefault, &counting};
+    ASSERT_EQ(memory_resource(MemoryTag::kDefault), &counting);
+
+    sde::vector<int> constructed_during;
+    constructed_during.resize(10);
+    constructed_before.resize(10);
+    ASSERT_EQ(counting.allocate_count, 1UL);
+
+    // Moving keeps memory associated with its original resource
+    constructed_before = std::move(constructed_during);
+  }
+  ASSERT_EQ(memory_resource(MemoryTag::kDefault), std::pmr::new_delete_resource());
+
+  constructed_before.clear();
+  constructed_before.shrink_to_fit();
+  ASSERT_EQ(counting.deallocate_count, 1UL);
+}
+
+TEST(Memory, StringHash)
+{
+  const sde::string str{"value"};
+  ASSERT_EQ(std::hash<sde::string>{}(str), std::hash<std::string_view>{}("value"));
+
+  sde::unordered_map<sde::string, int> m;
+  m.emplace(str, 1);
+  ASSERT_EQ(m.count(str), 1UL);
+}
+
+TEST(ArenaMemoryResource, MonotonicAllocation)
+{
+  ArenaMemoryResource arena{256};
+
+  void* a = arena.allocate(16, 8);
+  void* b = arena.allocate(16, 8);
+  ASSERT_EQ(static_cast<std::uint8_t*>(b) - static_cast<std::uint8_t*>(a), 16);
+  ASSERT_EQ(arena.used(), 32UL);
+  ASSERT_EQ(arena.capacity(), 256UL);
+
+  void* aligned = arena.allocate(8, 64);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0UL);
+}
+
+TEST(ArenaMemoryResource, OversizedAllocation)
+{
+  ArenaMemoryResource arena{64};
+  void* large = arena.allocate(1024, 8);
+  ASSERT_NE(large, nullptr);
+  ASSERT_GE(arena.capacity(), 1024UL);
+}
+
+TEST(ArenaMemoryResource, ResetReusesBlocks)
+{
+  CountingMemoryResource counting;
+  ArenaMemoryResource arena{256, &counting};
+
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    arena.reset();
+    for (int i = 0; i < 20; ++i)
+    {
+      [[maybe_unused]] void* p = arena.allocate(32, 8);
+    }
+  }
+
+  // 20 x 32 bytes needs 3 blocks of 256 bytes; these are allocated once, on the first frame
+  ASSERT_EQ(counting.allocate_count, 3UL);
+  ASSERT_EQ(arena.capacity(), 3UL * 256UL);
+
+  arena.release();
+  ASSERT_EQ(counting.deallocate_count, 3UL);
+  ASSERT_EQ(arena.capacity(), 0UL);
+}
+
+TEST(PoolMemoryResource, RecyclesChunks)
+{
+  CountingMemoryResource counting;
+  PoolMemoryResource pool{8, &counting};
+
+  void* a = pool.allocate(24, 8);
+  pool.deallocate(a, 24, 8);
+  void* b = pool.allocate(32, 8);
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(counting.allocate_count, 1UL);
+
+  // Different size class gets a separate block
+  void* c = pool.allocate(100, 8);
+  ASSERT_NE(c, b);
+  ASSERT_EQ(counting.allocate_count, 2UL);
+
+  pool.deallocate(b, 32, 8);
+  pool.deallocate(c, 100, 8);
+}
+
+TEST(PoolMemoryResource, ChunksAreDistinct)
+{
+  PoolMemoryResource pool{4};
+  std::unordered_set<void*> chunks;
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_TRUE(chunks.insert(pool.allocate(64, 16)).second);
+  }
+  for (void* p : chunks)
+  {
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % 16, 0UL);
+  }
+}
+
+TEST(PoolMemoryResource, LargeAllocationsForwardedUpstream)
+{
+  CountingMemoryResource counting;
+  PoolMemoryResource pool{8, &counting};
+  void* p = pool.allocate(PoolMemoryResource::kMaxChunkSize + 1, 8);
+  ASSERT_EQ(counting.allocate_count, 1UL);
+  pool.deallocate(p, PoolMemoryResource::kMaxChunkSize + 1, 8);
+  ASSERT_EQ(counting.deallocate_count, 1UL);
+}
+
+TEST(Memory, SteadyStateFrameDoesNotAllocate)
+{
+  // Mirrors per-frame engine state which is cleared and refilled every frame, drawing from a pool
+  struct FrameState
+  {
+    sde::vector<int> draw_calls;
+    sde::vector<sde::string> messages;
+    sde::unordered_map<int, int> lookup;
+  };
+
+  CountingMemoryResource counting;
+  PoolMemoryResource pool{64, &counting};
+  MemoryResourceScope scope{MemoryTag::kDefault, &pool};
+
+  static constexpr std::string_view kMessage{"message which is too long for short string storage"};
+  static_assert(kMessage.size() > sizeof(sde::string));
+
+  FrameState state;
+  const std::size_t initial_bucket_count = state.lookup.bucket_count();
+  const auto run_frame = [&state] {
+    state.draw_calls.clear();
+    state.messages.clear();
+    state.lookup.clear();
+    for (int i = 0; i < 100; ++i)
+    {
+      state.draw_calls.push_back(i);
+      state.lookup.emplace(i, i);
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+      state.messages.emplace_back(kMessage);
+    }
+  };
+
+  // Warm-up frame sizes all buffers and fills the pool
+  run_frame();
+  ASSERT_GT(state.lookup.bucket_count(), initial_bucket_count);
+
+  const auto before = memory_stats(MemoryTag::kDefault);
+  const std::size_t upstream_allocate_count = counting.allocate_count;
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    run_frame();
+  }
+  const auto after = memory_stats(MemoryTag::kDefault);
+
+  // Map nodes and strings are freed and allocated again every frame, but are served from the pool
+  ASSERT_GT(after.allocation_count, before.allocation_count);
+  ASSERT_EQ(after.live_bytes, before.live_bytes);
+  ASSERT_EQ(counting.allocate_count, upstream_allocate_count);
+}
@@ -0,0 +1,294 @@
+// C++ Standard Library
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// JSON
+#include <nlohmann/json.hpp>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/profiler.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+sde::vector<ProfileSpan> CollectThread(std::int64_t since_ns, std::size_t thread)
+{
+  auto spans = ProfileCollect(since_ns);
+  spans.erase(
+    std::remove_if(spans.begin(), spans.end(), [thread](const auto& span) { return span.thread != thread; }),
+    spans.end());
+  return spans;
+}
+
+std::size_t ThisThread()
+{
+  const auto since_ns = ProfileNow();
+  {
+    SDE_PROFILE_SCOPE("this_thread");
+  }
+  const auto spans = ProfileCollect(since_ns);
+  const auto itr = std::find_if(
+    spans.begin(), spans.end(), [](const auto& span) { return std::string{span.name} == "this_thread"; });
+  return itr->thread;
+}
+
+}  // namespace
+
+TEST(Profiler, NestedScopes)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  {
+    SDE_PROFILE_SCOPE("outer");
+    {
+      SDE_PROFILE_SCOPE("inner-1");
+      {
+        SDE_PROFILE_SCOPE("innermost");
+      }
+    }
+    {
+      SDE_PROFILE_SCOPE("inner-2");
+    }
+  }
+
+  const auto spans = CollectThread(since_ns, thread);
+  ASSERT_EQ(spans.size(), 4UL);
+  ASSERT_STREQ(spans[0].name, "outer");
+  ASSERT_EQ(spans[0].depth, 0UL);
+  ASSERT_STREQ(spans[1].name, "inner-1");
+  ASSERT_EQ(spans[1].depth, 1UL);
+  ASSERT_STREQ(spans[2].name, "innermost");
+  ASSERT_EQ(spans[2].depth, 2UL);
+  ASSERT_STREQ(spans[3].name, "inner-2");
+  ASSERT_EQ(spans[3].depth, 1UL);
+
+  // Children lie within their parents, and siblings do not overlap
+  ASSERT_LE(spans[0].begin_ns, spans[1].begin_ns);
+  ASSERT_LE(spans[1].begin_ns, spans[2].begin_ns);
+  ASSERT_LE(spans[2].end_ns, spans[1].end_ns);
+  ASSERT_LE(spans[1].end_ns, spans[3].begin_ns);
+  ASSERT_LE(spans[3].end_ns, spans[0].end_ns);
+}
+
+TEST(Profiler, OpenScopeNotCollected)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  SDE_PROFILE_SCOPE("open");
+  {
+    SDE_PROFILE_SCOPE("closed");
+  }
+  const auto spans = CollectThread(since_ns, thread);
+  ASSERT_EQ(spans.size(), 1UL);
+  ASSERT_STREQ(spans[0].name, "closed");
+  ASSERT_EQ(spans[0].depth, 1UL);
+}
+
+TEST(Profiler, DisabledNotRecorded)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  SetProfilingEnabled(false);
+  {
+    SDE_PROFILE_SCOPE("disabled");
+  }
+  SetProfilingEnabled(true);
+  ASSERT_TRUE(CollectThread(since_ns, thread).empty());
+}
+
+TEST(Profiler, ScopeEnabledWhileOpen)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  SetProfilingEnabled(false);
+  {
+    SDE_PROFILE_SCOPE("outer");
+    SetProfilingEnabled(true);
+    {
+      SDE_PROFILE_SCOPE("inner");
+    }
+  }
+  const auto spans = CollectThread(since_ns, thread);
+  ASSERT_EQ(spans.size(), 1UL);
+  ASSERT_STREQ(spans[0].name, "inner");
+  ASSERT_EQ(spans[0].depth, 0UL);
+}
+
+TEST(Profiler, ScopesFromOtherThread)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  std::thread{[] {
+    SetProfileThreadName("worker");
+    SDE_PROFILE_SCOPE("work");
+  }}.join();
+
+  const auto spans = ProfileCollect(since_ns);
+  const auto itr =
+    std::find_if(spans.begin(), spans.end(), [](const auto& span) { return std::string{span.name} == "work"; });
+  ASSERT_NE(itr, spans.end());
+  ASSERT_NE(itr->thread, thread);
+  ASSERT_STREQ(GetProfileThreadName(itr->thread), "worker");
+}
+
+TEST(Profiler, ExitedThreadRingReused)
+{
+  const auto since_ns = ProfileNow();
+  for (int i = 0; i < 3; ++i)
+  {
+    std::thread{[] {
+      ASSERT_EQ(GetProfileThreadName(ThisThread()), nullptr);
+      SetProfileThreadName("worker");
+      SDE_PROFILE_SCOPE("reused");
+    }}.join();
+  }
+
+  const auto spans = ProfileCollect(since_ns);
+  sde::vector<std::size_t> threads;
+  for (const auto& span : spans)
+  {
+    if (std::string{span.name} == "reused")
+    {
+      threads.push_back(span.thread);
+    }
+  }
+  ASSERT_EQ(threads.size(), 3UL);
+  ASSERT_EQ(threads[0], threads[1]);
+  ASSERT_EQ(threads[1], threads[2]);
+}
+
+TEST(Profiler, OldEventsOverwritten)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  {
+    SDE_PROFILE_SCOPE("outer");
+    for (std::size_t i = 0; i < kProfileEventCapacity; ++i)
+    {
+      SDE_PROFILE_SCOPE("inner");
+    }
+  }
+
+  // Entry of "outer" was overwritten, so only the most recent inner scopes remain
+  const auto spans = CollectThread(since_ns, thread);
+  ASSERT_FALSE(spans.empty());
+  ASSERT_LT(spans.size(), kProfileEventCapacity / 2);
+  for (const auto& span : spans)
+  {
+    ASSERT_STREQ(span.name, "inner");
+    ASSERT_LE(span.begin_ns, span.end_ns);
+  }
+}
+
+TEST(Profiler, CollectSince)
+{
+  const std::size_t thread = ThisThread();
+  {
+    SDE_PROFILE_SCOPE("outer");
+    {
+      SDE_PROFILE_SCOPE("before");
+    }
+    const auto since_ns = ProfileNow();
+    {
+      SDE_PROFILE_SCOPE("after");
+    }
+
+    // Spans which end after since_ns include their parents
+    const auto spans = CollectThread(since_ns, thread);
+    ASSERT_EQ(spans.size(), 1UL);
+    ASSERT_STREQ(spans[0].name, "after");
+    ASSERT_EQ(spans[0].depth, 1UL);
+  }
+}
+
+TEST(Profiler, RuntimeNames)
+{
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  const char* name = nullptr;
+  {
+    std::string scope{"runtime"};
+    name = ProfileName(scope);
+    ASSERT_EQ(name, ProfileName("runtime"));
+    SDE_PROFILE_SCOPE(name);
+    scope.clear();
+  }
+
+  const auto spans = CollectThread(since_ns, thread);
+  ASSERT_EQ(spans.size(), 1UL);
+  ASSERT_STREQ(spans[0].name, "runtime");
+}
+
+TEST(ChromeTrace, Format)
+{
+  SetProfileThreadName("main");
+  const std::size_t thread = ThisThread();
+  const auto since_ns = ProfileNow();
+  {
+    SDE_PROFILE_SCOPE("outer \"quoted\"");
+    {
+      SDE_PROFILE_SCOPE("inner");
+    }
+  }
+  const auto spans = CollectThread(since_ns, thread);
+
+  std::ostringstream oss;
+  WriteChromeTrace(oss, spans);
+
+  const auto trace = nlohmann::json::parse(oss.str());
+  ASSERT_EQ(trace["displayTimeUnit"], "ms");
+  const auto& events = trace["traceEvents"];
+  ASSERT_EQ(events.size(), 3UL);
+
+  ASSERT_EQ(events[0]["name"], "outer \"quoted\"");
+  ASSERT_EQ(events[0]["ph"], "X");
+  ASSERT_EQ(events[0]["ts"], 0.0);
+  ASSERT_EQ(events[0]["tid"], thread);
+  ASSERT_EQ(events[1]["name"], "inner");
+  ASSERT_EQ(events[1]["ph"], "X");
+  ASSERT_GE(events[1]["ts"].get<double>(), events[0]["ts"].get<double>());
+  ASSERT_LE(
+    events[1]["ts"].get<double>() + events[1]["dur"].get<double>(),
+    events[0]["ts"].get<double>() + events[0]["dur"].get<double>());
+
+  ASSERT_EQ(events[2]["name"], "thread_name");
+  ASSERT_EQ(events[2]["ph"], "M");
+  ASSERT_EQ(events[2]["tid"], thread);
+  ASSERT_EQ(events[2]["args"]["name"], "main");
+}
+
+TEST(ChromeTrace, Empty)
+{
+  std::ostringstream oss;
+  WriteChromeTrace(oss, {});
+  const auto trace = nlohmann::json::parse(oss.str());
+  ASSERT_TRUE(trace["traceEvents"].empty());
+}
+
+TEST(ChromeTrace, WriteFile)
+{
+  static constexpr const char* kPath = "ChromeTrace.WriteFile.json";
+  {
+    SDE_PROFILE_SCOPE("scope");
+  }
+  ASSERT_TRUE(WriteChromeTrace(kPath, ProfileCollect()).has_value());
+  const auto trace = nlohmann::json::parse(std::ifstream{kPath});
+  ASSERT_FALSE(trace["traceEvents"].empty());
+  std::remove(kPath);
+}
+
+TEST(ChromeTrace, WriteFileFailed)
+{
+  const auto ok_or_error = WriteChromeTrace("missing/ChromeTrace.json", ProfileCollect());
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), ProfileTraceError::kFileOpenFailed);
+}
@@ -0,0 +1,47 @@
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/profiler.hpp"
+
+static void BM_ProfileScope(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    SDE_PROFILE_SCOPE("scope");
+  }
+}
+BENCHMARK(BM_ProfileScope);
+
+static void BM_ProfileScopeDisabled(benchmark::State& state)
+{
+  sde::SetProfilingEnabled(false);
+  for (auto _ : state)
+  {
+    SDE_PROFILE_SCOPE("scope");
+  }
+  sde::SetProfilingEnabled(true);
+}
+BENCHMARK(BM_ProfileScopeDisabled);
+
+static void BM_ProfileCollectFrame(benchmark::State& state)
+{
+  // Collect a single frame's worth of scopes from a full event ring
+  for (std::size_t i = 0; i < sde::kProfileEventCapacity; ++i)
+  {
+    SDE_PROFILE_SCOPE("fill");
+  }
+  const auto since_ns = sde::ProfileNow();
+  {
+    SDE_PROFILE_SCOPE("frame");
+    for (int i = 0; i < 100; ++i)
+    {
+      SDE_PROFILE_SCOPE("work");
+    }
+  }
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(sde::ProfileCollect(since_ns));
+  }
+}
+BENCHMARK(BM_ProfileCollectFrame);
@@ -0,0 +1,61 @@
+// C++ Standard Library
+#include <algorithm>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/dl/library.hpp"
+#include "sde/profiler.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+/// Linked with its own copy of the profiler, as native script libraries are
+constexpr const char* kPluginPath = "core/common/test/libprofiler_plugin.so";
+
+bool Collected(std::int64_t since_ns, const char* name)
+{
+  const auto spans = ProfileCollect(since_ns);
+  return std::any_of(
+    spans.begin(), spans.end(), [name](const auto& span) { return std::string{span.name} == std::string{name}; });
+}
+
+}  // namespace
+
+class ProfilerSharedTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    auto library_or_error = dl::Library::load(kPluginPath);
+    ASSERT_TRUE(library_or_error.has_value()) << library_or_error.error();
+    library_ = std::move(library_or_error).value();
+
+    auto symbol_or_error = library_.get("profiler_plugin_scope");
+    ASSERT_TRUE(symbol_or_error.has_value()) << symbol_or_error.error();
+    plugin_scope_ = *symbol_or_error;
+  }
+
+  dl::Library library_;
+  dl::Function<void(const char*)> plugin_scope_;
+};
+
+TEST_F(ProfilerSharedTest, ScopesFromLibraryCollected)
+{
+  const auto since_ns = ProfileNow();
+  plugin_scope_("plugin");
+  ASSERT_TRUE(Collected(since_ns, "plugin"));
+}
+
+TEST_F(ProfilerSharedTest, LibraryFollowsEnabledState)
+{
+  const auto since_ns = ProfileNow();
+  SetProfilingEnabled(false);
+  plugin_scope_("plugin_disabled");
+  SetProfilingEnabled(true);
+  ASSERT_FALSE(Collected(since_ns, "plugin_disabled"));
+}
@@ -0,0 +1,359 @@
+// C++ Standard Library
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/expected.hpp"
+#include "sde/resource.hpp"
+#include "sde/resource_bundle.hpp"
+#include "sde/resource_cache.hpp"
+#include "sde/resource_handle.hpp"
+#include "sde/serial/std/string.hpp"
+#include "sde/serial/std/vector.hpp"
+
+using namespace sde;
+
+struct SimpleResource : Resource<SimpleResource>
+{
+  std::string name;
+  sde::vector<float> values;
+
+  auto field_list() { return FieldList(Field{"name", name}, Field{"values", values}); }
+};
+
+enum class SimpleResourceError
+{
+  SDE_RESOURCE_CACHE_ERROR_ENUMS,
+};
+
+struct SimpleResourceCache;
+
+struct SimpleResourceHandle : ResourceHandle<SimpleResourceHandle>
+{
+  SimpleResourceHandle() = default;
+  explicit SimpleResourceHandle(id_type id) : ResourceHandle<SimpleResourceHandle>{id} {}
+};
+
+namespace sde
+{
+template <> struct ResourceCacheTraits<SimpleResourceCache>
+{
+  using error_type = SimpleResourceError;
+  using handle_type = SimpleResourceHandle;
+  using value_type = SimpleResource;
+  using dependencies = no_dependencies;
+};
+}  // namespace sde
+
+struct SimpleResourceCache : ResourceCache<SimpleResourceCache>
+{
+  std::size_t reload_count = 0;
+
+  expected<SimpleResource, SimpleResourceError> generate([[maybe_unused]] dependencies deps, const std::string& name, std::size_t count)
+  {
+    return SimpleResource{.name = name, .values = sde::vector<float>(count, static_cast<float>(count))};
+  }
+
+  expected<void, SimpleResourceError> reload([[maybe_unused]] dependencies deps, [[maybe_unused]] SimpleResource& value)
+  {
+    ++reload_count;
+    return {};
+  }
+};
+
+struct OtherResourceCache;
+
+struct OtherResourceHandle : ResourceHandle<OtherResourceHandle>
+{
+  OtherResourceHandle() = default;
+  explicit OtherResourceHandle(id_type id) : ResourceHandle<OtherResourceHandle>{id} {}
+};
+
+namespace sde
+{
+template <> struct ResourceCacheTraits<OtherResourceCache>
+{
+  using error_type = SimpleResourceError;
+  using handle_type = OtherResourceHandle;
+  using value_type = SimpleResource;
+  using dependencies = no_dependencies;
+};
+}  // namespace sde
+
+struct OtherResourceCache : ResourceCache<OtherResourceCache>
+{
+  expected<SimpleResource, SimpleResourceError> generate([[maybe_unused]] dependencies deps, const std::string& name)
+  {
+    return SimpleResource{.name = name, .values = {1.F}};
+  }
+};
+
+class ResourceBundleTest : public ::testing::Test
+{
+protected:
+  static constexpr const char* kBundlePath = "ResourceBundle.bin";
+  static constexpr std::size_t kElementCount = 10;
+
+  void SetUp() override
+  {
+    for (std::size_t i = 0; i < kElementCount; ++i)
+    {
+      ASSERT_TRUE(original.create(NoDependencies, "element-" + std::to_string(i), i).has_value());
+    }
+    ASSERT_TRUE(other.create(NoDependencies, std::string{"other"}).has_value());
+
+    auto writer_or_error = ResourceBundleWriter::create(kBundlePath);
+    ASSERT_TRUE(writer_or_error.has_value()) << writer_or_error.error();
+    writer_or_error->write(original);
+    writer_or_error->write(other);
+    ASSERT_TRUE(writer_or_error->finish().has_value());
+  }
+
+  void TearDown() override { std::remove(kBundlePath); }
+
+  SimpleResourceCache original;
+  OtherResourceCache other;
+};
+
+TEST_F(ResourceBundleTest, Index)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+  ASSERT_EQ(bundle_or_error->entries().size(), kElementCount + 1);
+  ASSERT_EQ(bundle_or_error->entries<SimpleResourceCache>().size(), kElementCount);
+  ASSERT_EQ(bundle_or_error->entries<OtherResourceCache>().size(), 1UL);
+
+  for (const auto& entry : bundle_or_error->entries<SimpleResourceCache>())
+  {
+    const auto itr = original.cache().find(SimpleResourceHandle{entry.handle});
+    ASSERT_NE(itr, original.cache().end());
+    ASSERT_EQ(entry.version, itr->second.version);
+    ASSERT_GT(entry.length, 0UL);
+  }
+}
+
+TEST_F(ResourceBundleTest, EagerLoad)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  SimpleResourceCache loaded;
+  const auto count_or_error = bundle_or_error->load(loaded, ResourceBundleLoadMode::kEager);
+  ASSERT_TRUE(count_or_error.has_value()) << count_or_error.error();
+  ASSERT_EQ(*count_or_error, kElementCount);
+  ASSERT_EQ(loaded.size(), kElementCount);
+  ASSERT_EQ(loaded.deferred_size(), 0UL);
+
+  for (const auto& [handle, element] : original)
+  {
+    const auto* value = loaded.get_if(handle);
+    ASSERT_NE(value, nullptr);
+    ASSERT_EQ(*value, element.value);
+  }
+}
+
+TEST_F(ResourceBundleTest, LazyLoadMaterializesOnAccess)
+{
+  SimpleResourceCache loaded;
+  {
+    auto bundle_or_error = ResourceBundle::open(kBundlePath);
+    ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+    ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+  }
+
+  // Elements remain readable after the bundle is released
+  ASSERT_EQ(loaded.size(), 0UL);
+  ASSERT_EQ(loaded.deferred_size(), kElementCount);
+  ASSERT_FALSE(loaded.empty());
+
+  const SimpleResourceHandle first{original.begin()->first};
+  ASSERT_TRUE(loaded.exists(first));
+  ASSERT_EQ(loaded.size(), 0UL);
+
+  const auto* value = loaded.get_if(first);
+  ASSERT_NE(value, nullptr);
+  ASSERT_EQ(*value, *original.get_if(first));
+  ASSERT_EQ(loaded.size(), 1UL);
+  ASSERT_EQ(loaded.deferred_size(), kElementCount - 1);
+
+  // Subsequent access does not re-read the element
+  ASSERT_EQ(loaded.get_if(first), value);
+  ASSERT_EQ(loaded.size(), 1UL);
+}
+
+TEST_F(ResourceBundleTest, LazyLoadConcurrentConstLookups)
+{
+  SimpleResourceCache loaded;
+  {
+    auto bundle_or_error = ResourceBundle::open(kBundlePath);
+    ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+    ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+  }
+
+  // Every thread looks up every element, so most lookups race to materialize the same elements
+  const SimpleResourceCache& readonly = loaded;
+  std::vector<std::size_t> found(8, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < found.size(); ++t)
+  {
+    threads.emplace_back([&readonly, &count = found[t], this] {
+      for (const auto& [handle, element] : original)
+      {
+        const auto* value = readonly.get_if(handle);
+        count += ((value != nullptr) and (*value == element.value)) ? 1 : 0;
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (const auto count : found)
+  {
+    ASSERT_EQ(count, kElementCount);
+  }
+  ASSERT_EQ(loaded.size(), kElementCount);
+  ASSERT_EQ(loaded.deferred_size(), 0UL);
+}
+
+TEST_F(ResourceBundleTest, PartialLazyLoadFromSingleCache)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  // Loading one cache does not read any elements of the other
+  OtherResourceCache loaded_other;
+  ASSERT_TRUE(bundle_or_error->load(loaded_other, ResourceBundleLoadMode::kLazy).has_value());
+  ASSERT_EQ(loaded_other.deferred_size(), 1UL);
+
+  const auto* value = loaded_other.get_if(other.begin()->first);
+  ASSERT_NE(value, nullptr);
+  ASSERT_EQ(value->name, "other");
+}
+
+TEST_F(ResourceBundleTest, LazyLoadReloadsAfterRefresh)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  SimpleResourceCache loaded;
+  ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+  ASSERT_TRUE(loaded.refresh(NoDependencies).has_value());
+  ASSERT_EQ(loaded.reload_count, 0UL);
+
+  ASSERT_NE(loaded.get_if(original.begin()->first), nullptr);
+  ASSERT_EQ(loaded.reload_count, 1UL);
+
+  loaded.materialize();
+  ASSERT_EQ(loaded.reload_count, kElementCount);
+  ASSERT_EQ(loaded.size(), kElementCount);
+  ASSERT_EQ(loaded.deferred_size(), 0UL);
+}
+
+TEST_F(ResourceBundleTest, CreateAfterLazyLoadUsesNewHandle)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  SimpleResourceCache loaded;
+  ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+
+  const auto element_or_error = loaded.create(NoDependencies, std::string{"new"}, 1UL);
+  ASSERT_TRUE(element_or_error.has_value());
+  ASSERT_FALSE(original.exists(element_or_error->handle));
+  ASSERT_EQ(loaded.deferred_size(), kElementCount);
+}
+
+TEST_F(ResourceBundleTest, LoadTwiceIsDuplicate)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  SimpleResourceCache loaded;
+  ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+
+  const auto eager_or_error = bundle_or_error->load(loaded, ResourceBundleLoadMode::kEager);
+  ASSERT_FALSE(eager_or_error.has_value());
+  ASSERT_EQ(eager_or_error.error(), ResourceBundleError::kDuplicateElement);
+}
+
+TEST_F(ResourceBundleTest, RemoveDeferredElement)
+{
+  auto bundle_or_error = ResourceBundle::open(kBundlePath);
+  ASSERT_TRUE(bundle_or_error.has_value()) << bundle_or_error.error();
+
+  SimpleResourceCache loaded;
+  ASSERT_TRUE(bundle_or_error->load(loaded, ResourceBundleLoadMode::kLazy).has_value());
+
+  const SimpleResourceHandle first{original.begin()->first};
+  ASSERT_TRUE(loaded.remove(first, NoDependencies).has_value());
+  ASSERT_FALSE(loaded.exists(first));
+  ASSERT_EQ(loaded.get_if(first), nullptr);
+
+  ASSERT_TRUE(loaded.clear(NoDependencies));
+  ASSERT_TRUE(loaded.empty());
+}
+
+TEST(ResourceBundle, MissingFile)
+{
+  const auto bundle_or_error = ResourceBundle::open("ResourceBundle.missing.bin");
+  ASSERT_FALSE(bundle_or_error.has_value());
+  ASSERT_EQ(bundle_or_error.error(), ResourceBundleError::kFileDoesNotExist);
+}
+
+TEST(ResourceBundle, InvalidHeader)
+{
+  static constexpr const char* kPath = "ResourceBundle.invalid.bin";
+  {
+    std::FILE* file = std::fopen(kPath, "wb");
+    ASSERT_NE(file, nullptr);
+    const std::string garbage(64, 'x');
+    std::fwrite(garbage.data(), 1, garbage.size(), file);
+    std::fclose(file);
+  }
+  const auto bundle_or_error = ResourceBundle::open(kPath);
+  ASSERT_FALSE(bundle_or_error.has_value());
+  ASSERT_EQ(bundle_or_error.error(), ResourceBundleError::kInvalidHeader);
+  std::remove(kPath);
+}
+
+TEST(ResourceBundle, TruncatedIndex)
+{
+  static constexpr const char* kPath = "ResourceBundle.truncated.bin";
+  {
+    SimpleResourceCache cache;
+    ASSERT_TRUE(cache.create(NoDependencies, std::string{"a"}, 4UL).has_value());
+    auto writer_or_error = ResourceBundleWriter::create(kPath);
+    ASSERT_TRUE(writer_or_error.has_value());
+    writer_or_error->write(cache);
+    ASSERT_TRUE(writer_or_error->finish().has_value());
+  }
+  std::filesystem::resize_file(kPath, std::filesystem::file_size(kPath) - 1);
+  const auto bundle_or_error = ResourceBundle::open(kPath);
+  ASSERT_FALSE(bundle_or_error.has_value());
+  ASSERT_EQ(bundle_or_error.error(), ResourceBundleError::kInvalidIndex);
+  std::remove(kPath);
+}
+
+TEST(ResourceBundle, FinishWriteFailed)
+{
+  if (!std::filesystem::exists("/dev/full"))
+  {
+    GTEST_SKIP() << "/dev/full not available";
+  }
+  SimpleResourceCache cache;
+  ASSERT_TRUE(cache.create(NoDependencies, std::string{"a"}, 4UL).has_value());
+  auto writer_or_error = ResourceBundleWriter::create("/dev/full");
+  ASSERT_TRUE(writer_or_error.has_value());
+  writer_or_error->write(cache);
+  const auto ok_or_error = writer_or_error->finish();
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), ResourceBundleError::kFileWriteFailed);
+}
@@ -0,0 +1,106 @@
+// C++ Standard Library
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/expected.hpp"
+#include "sde/resource.hpp"
+#include "sde/resource_bundle.hpp"
+#include "sde/resource_cache.hpp"
+#include "sde/resource_handle.hpp"
+#include "sde/serial/std/string.hpp"
+#include "sde/serial/std/vector.hpp"
+
+using namespace sde;
+
+struct TileMapResource : Resource<TileMapResource>
+{
+  std::string name;
+  sde::vector<float> tiles;
+
+  auto field_list() { return FieldList(Field{"name", name}, Field{"tiles", tiles}); }
+};
+
+enum class TileMapError
+{
+  SDE_RESOURCE_CACHE_ERROR_ENUMS,
+};
+
+struct TileMapCache;
+
+struct TileMapHandle : ResourceHandle<TileMapHandle>
+{
+  TileMapHandle() = default;
+  explicit TileMapHandle(id_type id) : ResourceHandle<TileMapHandle>{id} {}
+};
+
+namespace sde
+{
+template <> struct ResourceCacheTraits<TileMapCache>
+{
+  using error_type = TileMapError;
+  using handle_type = TileMapHandle;
+  using value_type = TileMapResource;
+  using dependencies = no_dependencies;
+};
+}  // namespace sde
+
+struct TileMapCache : ResourceCache<TileMapCache>
+{
+  expected<TileMapResource, TileMapError>
+  generate([[maybe_unused]] dependencies deps, const std::string& name, std::size_t tile_count)
+  {
+    return TileMapResource{.name = name, .tiles = sde::vector<float>(tile_count, 1.F)};
+  }
+};
+
+namespace
+{
+
+constexpr const char* kBundlePath = "ResourceBundleBenchmark.bin";
+
+/// Total number of assets in the bundle
+constexpr std::size_t kAssetCount = 2048;
+
+/// Number of assets used by the first scene
+constexpr std::size_t kFirstSceneAssetCount = 32;
+
+void WriteBundle(std::size_t tile_count)
+{
+  TileMapCache cache;
+  for (std::size_t i = 0; i < kAssetCount; ++i)
+  {
+    [[maybe_unused]] auto _ = cache.create(NoDependencies, "tile-map-" + std::to_string(i), tile_count);
+  }
+  auto writer_or_error = ResourceBundleWriter::create(kBundlePath);
+  writer_or_error->write(cache);
+  [[maybe_unused]] auto _ = writer_or_error->finish();
+}
+
+void Startup(benchmark::State& state, ResourceBundleLoadMode mode)
+{
+  WriteBundle(state.range(0));
+  for (auto _ : state)
+  {
+    auto bundle_or_error = ResourceBundle::open(kBundlePath);
+    TileMapCache cache;
+    benchmark::DoNotOptimize(bundle_or_error->load(cache, mode));
+    for (std::size_t id = 1; id <= kFirstSceneAssetCount; ++id)
+    {
+      benchmark::DoNotOptimize(cache.get_if(TileMapHandle{id}));
+    }
+  }
+  std::remove(kBundlePath);
+}
+
+}  // namespace
+
+static void BM_ResourceBundleStartupEager(benchmark::State& state) { Startup(state, ResourceBundleLoadMode::kEager); }
+BENCHMARK(BM_ResourceBundleStartupEager)->RangeMultiplier(8)->Range(16, 1 << 13);
+
+static void BM_ResourceBundleStartupLazy(benchmark::State& state) { Startup(state, ResourceBundleLoadMode::kLazy); }
+BENCHMARK(BM_ResourceBundleStartupLazy)->RangeMultiplier(8)->Range(16, 1 << 13);
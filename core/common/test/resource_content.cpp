@@ -0,0 +1,235 @@
+// C++ Standard Library
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/resource.hpp"
+#include "sde/resource_cache.hpp"
+#include "sde/resource_content.hpp"
+#include "sde/resource_handle.hpp"
+#include "sde/unique_resource.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+asset::path WriteTestFile(const char* name, std::string_view contents)
+{
+  const auto path = asset::temp_directory_path() / name;
+  std::ofstream ofs{path, std::ios::binary};
+  ofs.write(contents.data(), contents.size());
+  return path;
+}
+
+}  // namespace
+
+struct BlobBufferDeleter
+{
+  std::shared_ptr<void> shared = nullptr;
+
+  void operator()(void* data) const
+  {
+    if (shared == nullptr)
+    {
+      std::free(data);
+    }
+  }
+};
+
+using BlobBuffer = UniqueResource<void*, BlobBufferDeleter>;
+
+struct Blob : Resource<Blob>
+{
+  asset::path path;
+  BlobBuffer buffer = BlobBuffer{nullptr};
+  std::size_t length = 0;
+
+  auto field_list() { return FieldList(Field{"path", path}, _Stub{"buffer", buffer}, _Stub{"length", length}); }
+};
+
+enum class BlobError
+{
+  SDE_RESOURCE_CACHE_ERROR_ENUMS,
+  kAssetNotFound
+};
+
+struct BlobCache;
+
+struct BlobHandle : ResourceHandle<BlobHandle>
+{
+  BlobHandle() = default;
+  explicit BlobHandle(id_type id) : ResourceHandle<BlobHandle>{id} {}
+};
+
+template <> struct ResourceCacheTraits<BlobCache>
+{
+  using error_type = BlobError;
+  using handle_type = BlobHandle;
+  using value_type = Blob;
+  using dependencies = no_dependencies;
+};
+
+struct BlobCache : ResourceCache<BlobCache>
+{
+  struct BlobContentInfo
+  {
+    std::size_t length;
+  };
+
+  ResourceContentIndex<BlobContentInfo> content_index;
+
+  expected<Blob, BlobError> generate(dependencies deps, const asset::path& path)
+  {
+    std::optional<Hash> content_key;
+    if (content_index.enabled())
+    {
+      content_key = ComputeContentHash(path);
+    }
+
+    if (content_key.has_value())
+    {
+      if (auto content = content_index.find(*content_key); content.has_value())
+      {
+        return Blob{
+          .path = path,
+          .buffer = BlobBuffer{content->data.get(), BlobBufferDeleter{std::move(content->data)}},
+          .length = content->info.length};
+      }
+    }
+
+    const std::size_t length = asset::file_size(path);
+    void* data = std::malloc(length);
+    std::ifstream{path, std::ios::binary}.read(reinterpret_cast<char*>(data), length);
+
+    if (content_key.has_value())
+    {
+      std::shared_ptr<void> shared{data, BlobBufferDeleter{}};
+      content_index.insert(*content_key, {.data = shared, .info = {.length = length}}, length, TimeOffset::zero());
+      return Blob{.path = path, .buffer = BlobBuffer{data, BlobBufferDeleter{std::move(shared)}}, .length = length};
+    }
+    return Blob{.path = path, .buffer = BlobBuffer{data}, .length = length};
+  }
+};
+
+TEST(ResourceContent, ContentHashOfIdenticalFilesMatches)
+{
+  const auto a = WriteTestFile("sde_resource_content_a.bin", "identical content");
+  const auto b = WriteTestFile("sde_resource_content_b.bin", "identical content");
+  const auto c = WriteTestFile("sde_resource_content_c.bin", "different content");
+
+  const auto a_hash = ComputeContentHash(a);
+  const auto b_hash = ComputeContentHash(b);
+  const auto c_hash = ComputeContentHash(c);
+  ASSERT_TRUE(a_hash.has_value());
+  ASSERT_TRUE(b_hash.has_value());
+  ASSERT_TRUE(c_hash.has_value());
+  ASSERT_EQ(*a_hash, *b_hash);
+  ASSERT_NE(*a_hash, *c_hash);
+
+  static constexpr std::string_view kContent{"identical content"};
+  ASSERT_EQ(*a_hash, ComputeContentHash(kContent.data(), kContent.size()));
+}
+
+TEST(ResourceContent, ContentHashOfMissingFile)
+{
+  ASSERT_FALSE(ComputeContentHash(asset::temp_directory_path() / "sde_resource_content_missing.bin").has_value());
+}
+
+TEST(ResourceContent, AliasingDisabledByDefault)
+{
+  const auto a = WriteTestFile("sde_resource_content_a.bin", "identical content");
+  const auto b = WriteTestFile("sde_resource_content_b.bin", "identical content");
+
+  BlobCache cache;
+  auto a_or_error = cache.create(NoDependencies, a);
+  auto b_or_error = cache.create(NoDependencies, b);
+  ASSERT_TRUE(a_or_error.has_value());
+  ASSERT_TRUE(b_or_error.has_value());
+  ASSERT_NE((*a_or_error)->buffer.value(), (*b_or_error)->buffer.value());
+  ASSERT_EQ(cache.content_index.stats().alias_count, 0UL);
+}
+
+TEST(ResourceContent, IdenticalContentIsAliased)
+{
+  const auto a = WriteTestFile("sde_resource_content_a.bin", "identical content");
+  const auto b = WriteTestFile("sde_resource_content_b.bin", "identical content");
+  const auto c = WriteTestFile("sde_resource_content_c.bin", "different content");
+
+  BlobCache cache;
+  cache.content_index.enable(true);
+
+  auto a_or_error = cache.create(NoDependencies, a);
+  auto b_or_error = cache.create(NoDependencies, b);
+  auto c_or_error = cache.create(NoDependencies, c);
+  ASSERT_TRUE(a_or_error.has_value());
+  ASSERT_TRUE(b_or_error.has_value());
+  ASSERT_TRUE(c_or_error.has_value());
+
+  // Each path is still a distinct element...
+  ASSERT_EQ(cache.size(), 3UL);
+  ASSERT_NE(a_or_error->handle, b_or_error->handle);
+
+  // ...but identical content shares storage
+  ASSERT_EQ((*a_or_error)->buffer.value(), (*b_or_error)->buffer.value());
+  ASSERT_NE((*a_or_error)->buffer.value(), (*c_or_error)->buffer.value());
+  ASSERT_EQ((*b_or_error)->length, (*a_or_error)->length);
+
+  const auto& stats = cache.content_index.stats();
+  ASSERT_EQ(stats.decode_count, 2UL);
+  ASSERT_EQ(stats.alias_count, 1UL);
+  ASSERT_EQ(stats.bytes_saved, std::string_view{"identical content"}.size());
+}
+
+TEST(ResourceContent, AliasedContentOutlivesOriginal)
+{
+  static constexpr std::string_view kContent{"identical content"};
+  const auto a = WriteTestFile("sde_resource_content_a.bin", kContent);
+  const auto b = WriteTestFile("sde_resource_content_b.bin", kContent);
+
+  BlobCache cache;
+  cache.content_index.enable(true);
+
+  auto a_or_error = cache.create(NoDependencies, a);
+  ASSERT_TRUE(a_or_error.has_value());
+  const auto a_handle = a_or_error->handle;
+
+  auto b_or_error = cache.create(NoDependencies, b);
+  ASSERT_TRUE(b_or_error.has_value());
+  const auto b_handle = b_or_error->handle;
+
+  // Removing the original element must not release shared content
+  ASSERT_TRUE(cache.remove(a_handle, NoDependencies).has_value());
+  const auto* b_value = cache.get_if(b_handle);
+  ASSERT_NE(b_value, nullptr);
+  ASSERT_EQ(std::memcmp(b_value->buffer.value(), kContent.data(), kContent.size()), 0);
+
+  // Content remains available for aliasing while any element references it
+  ASSERT_TRUE(cache.create(NoDependencies, a).has_value());
+  ASSERT_EQ(cache.content_index.stats().alias_count, 2UL);
+}
+
+TEST(ResourceContent, ReleasedContentIsDecodedAgain)
+{
+  const auto a = WriteTestFile("sde_resource_content_a.bin", "identical content");
+  const auto b = WriteTestFile("sde_resource_content_b.bin", "identical content");
+
+  BlobCache cache;
+  cache.content_index.enable(true);
+
+  auto a_or_error = cache.create(NoDependencies, a);
+  ASSERT_TRUE(a_or_error.has_value());
+  ASSERT_TRUE(cache.remove(a_or_error->handle, NoDependencies).has_value());
+
+  ASSERT_TRUE(cache.create(NoDependencies, b).has_value());
+  ASSERT_EQ(cache.content_index.stats().decode_count, 2UL);
+  ASSERT_EQ(cache.content_index.stats().alias_count, 0UL);
+}
@@ -0,0 +1,5 @@
+// SDE
+#include "sde/dl/export.hpp"
+#include "sde/profiler.hpp"
+
+SDE_EXPORT void profiler_plugin_scope(const char* name) { SDE_PROFILE_SCOPE(name); }
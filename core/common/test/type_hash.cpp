@@ -0,0 +1,68 @@
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/hash.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+struct A
+{};
+
+struct B
+{};
+
+template <std::size_t TypeId> struct TypeTag
+{
+  static constexpr std::size_t value = TypeId;
+};
+
+constexpr int Dispatch(std::size_t type_id)
+{
+  switch (type_id)
+  {
+  case type_hash_value_v<A>:
+    return 1;
+  case type_hash_value_v<B>:
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+}  // namespace
+
+static_assert(type_hash_value_v<A> != type_hash_value_v<B>);
+static_assert(type_hash_value_v<int> != type_hash_value_v<float>);
+static_assert(type_hash_value_v<std::vector<int>> != type_hash_value_v<std::vector<float>>);
+static_assert(type_hash_value_v<A> == ComputeTypeHashValue<A>());
+
+static_assert(ComputeTypeHash<A>() == ComputeTypeHash<const A>());
+static_assert(ComputeTypeHash<A>() == ComputeTypeHash<A&>());
+static_assert(ComputeTypeHash<A>() == ComputeTypeHash<const A&>());
+static_assert(ComputeTypeHash<A>() != ComputeTypeHash<B>());
+
+static_assert(TypeTag<type_hash_value_v<A>>::value == type_hash_value_v<A>);
+static_assert(Dispatch(type_hash_value_v<A>) == 1);
+static_assert(Dispatch(type_hash_value_v<B>) == 2);
+static_assert(Dispatch(type_hash_value_v<int>) == 0);
+
+TEST(TypeHash, MatchesHashOfTypeName)
+{
+  const std::string name{type_name<std::vector<int>>()};
+  ASSERT_EQ(type_hash_value_v<std::vector<int>>, ComputeBytesHashValue(std::string_view{name}));
+}
+
+TEST(TypeHash, RuntimeDispatch)
+{
+  volatile std::size_t type_id = type_hash_value_v<B>;
+  ASSERT_EQ(Dispatch(type_id), 2);
+}
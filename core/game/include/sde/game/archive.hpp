@@ -6,13 +6,14 @@
 #pragma once
 
 #include "sde/serial/hash_oarchive.hpp"
+#include "sde/serial/mem_ostream.hpp"
 #include "sde/serialization_binary_file.hpp"
 
 namespace sde::game
 {
 
 using VArchive = serial::hash_oarchive;
-using OArchive = serial::binary_ofarchive;
+using OArchive = serial::binary_oarchive<serial::mem_ostream>;
 using IArchive = serial::binary_ifarchive;
 
 }  // namespace sde::game
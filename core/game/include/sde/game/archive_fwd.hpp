@@ -16,7 +16,8 @@ namespace sde::game
 {
 
 using VArchive = serial::hash_oarchive;
-using OArchive = serial::binary_ofarchive;
+/// Game data is saved to memory first, then written to file in the background (see AsyncFileWriter)
+using OArchive = serial::binary_oarchive<serial::mem_ostream>;
 using IArchive = serial::binary_ifarchive;
 
 }  // namespace sde::game
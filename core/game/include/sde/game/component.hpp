@@ -65,6 +65,16 @@ public:
   void load(IArchive& ar, EntityID id, Registry& registry) const;
   void save(OArchive& ar, EntityID id, const Registry& registry) const;
 
+  /**
+   * @brief Loads all components saved by save_storage, attaching them to entities mapped by \p remap
+   */
+  void load_storage(IArchive& ar, const EntityIDRemap& remap, Registry& registry) const;
+
+  /**
+   * @brief Saves this component for all entities in \p registry as a single column
+   */
+  void save_storage(OArchive& ar, const Registry& registry) const;
+
 private:
   ComponentIO(const ComponentIO&) = delete;
   ComponentIO& operator=(const ComponentIO&) = delete;
@@ -72,11 +82,18 @@ private:
   dl::Function<const char*(void)> name_;
   dl::Function<void(void*, void*, void*)> on_load_;
   dl::Function<void(void*, void*, const void*)> on_save_;
+  dl::Function<void(void*, const void*, void*)> on_load_storage_;
+  dl::Function<void(void*, const void*)> on_save_storage_;
 
   auto field_list()
   {
     // clang-format off
-    return FieldList(_Stub{"name", name_}, _Stub{"on_load", on_load_}, _Stub{"on_save", on_save_});
+    return FieldList(
+      _Stub{"name", name_},
+      _Stub{"on_load", on_load_},
+      _Stub{"on_save", on_save_},
+      _Stub{"on_load_storage", on_load_storage_},
+      _Stub{"on_save_storage", on_save_storage_});
     // clang-format on
   }
 };
@@ -96,10 +113,10 @@ class ComponentCache : public ResourceCache<ComponentCache>
 
 public:
   using fundemental_type::to_handle;
-  ComponentHandle to_handle(const sde::string& name) const;
+  ComponentHandle to_handle(std::string_view name) const;
 
 private:
-  sde::unordered_map<sde::string, ComponentHandle> type_name_to_component_handle_lookup_;
+  sde::unordered_map<sde::string, ComponentHandle, string_hash, std::equal_to<>> type_name_to_component_handle_lookup_;
   expected<void, ComponentError> reload(dependencies dep, ComponentData& library);
   expected<void, ComponentError> unload(dependencies dep, ComponentData& library);
   expected<ComponentData, ComponentError> generate(dependencies dep, const sde::string& name, const asset::path& path);
@@ -6,6 +6,8 @@
 #pragma once
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstddef>
 #include <type_traits>
 
 // Entt
@@ -63,6 +65,116 @@ void component_save_impl(const char* name, sde::game::OArchive& ar, EntityID e,
   }
 }
 
+/**
+ * @brief Saves all \p ComponentT values in \p registry as a single column
+ *
+ *        Writes the entity list of the component storage in one packet, followed by component values in storage order.
+ *        Trivially serializable components are written one storage page per packet; others are written per element.
+ */
+template <typename ComponentT>
+void component_save_storage_impl(const char* name, sde::game::OArchive& ar, const Registry& registry)
+{
+  using namespace sde::serial;
+
+  const auto* storage = registry.template storage<ComponentT>();
+  const std::size_t size = (storage == nullptr) ? 0UL : storage->size();
+  ar << named{"size", size};
+  if (size == 0)
+  {
+    return;
+  }
+
+  static_assert(!entt::component_traits<ComponentT>::in_place_delete, "storage must be tightly packed");
+  ar << named{"entities", make_packet(storage->data(), size)};
+
+  if constexpr (!std::is_void_v<decltype(registry.template get<ComponentT>(EntityID{}))>)
+  {
+    if constexpr (is_trivially_serializable_v<OArchive, ComponentT>)
+    {
+      static constexpr std::size_t kPageSize = entt::component_traits<ComponentT>::page_size;
+      const auto pages = storage->raw();
+      for (std::size_t offset = 0; offset < size; offset += kPageSize)
+      {
+        ar << named{name, make_packet(pages[offset / kPageSize], std::min(kPageSize, size - offset))};
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        ar << Field{name, storage->get(storage->data()[i])};
+      }
+    }
+  }
+}
+
+/**
+ * @brief Loads a column of \p ComponentT values saved with component_save_storage_impl into \p registry
+ *
+ *        Components of entities which are not mapped by \p remap are read and discarded.
+ */
+template <typename ComponentT>
+void component_load_storage_impl(
+  const char* name,
+  sde::game::IArchive& ar,
+  const EntityIDRemap& remap,
+  Registry& registry)
+{
+  using namespace sde::serial;
+
+  std::size_t size = 0;
+  ar >> named{"size", size};
+  if (size == 0)
+  {
+    return;
+  }
+
+  sde::vector<EntityID> entities;
+  entities.resize(size);
+  ar >> named{"entities", make_packet(entities.data(), size)};
+
+  if constexpr (std::is_void_v<decltype(registry.template get<ComponentT>(EntityID{}))>)
+  {
+    std::transform(entities.begin(), entities.end(), entities.begin(), [&remap](EntityID e) { return remap(e); });
+    registry.template insert<ComponentT>(
+      entities.begin(), std::remove(entities.begin(), entities.end(), static_cast<EntityID>(entt::null)));
+  }
+  else if constexpr (is_trivially_serializable_v<IArchive, ComponentT>)
+  {
+    sde::vector<ComponentT> components;
+    components.resize(size);
+    ar >> named{name, make_packet(components.data(), size)};
+
+    // Drop components of entities which were not loaded, keeping entities and components aligned
+    std::size_t loaded_count = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      if (const auto loaded = remap(entities[i]); loaded != entt::null)
+      {
+        entities[loaded_count] = loaded;
+        components[loaded_count] = components[i];
+        ++loaded_count;
+      }
+    }
+    registry.template insert<ComponentT>(entities.begin(), entities.begin() + loaded_count, components.begin());
+  }
+  else
+  {
+    for (const auto saved : entities)
+    {
+      if (const auto loaded = remap(saved); loaded != entt::null)
+      {
+        ar >> Field{name, registry.template emplace<ComponentT>(loaded)};
+      }
+      else
+      {
+        ComponentT discarded;
+        ar >> Field{name, discarded};
+      }
+    }
+  }
+}
+
 }  // namespace sde::game
 
 #define SDE_COMPONENT__REGISTER_NAME(Name, ComponentT)                                                                 \
@@ -90,7 +202,29 @@ void component_save_impl(const char* name, sde::game::OArchive& ar, EntityID e,
   }
 
 
+#define SDE_COMPONENT__REGISTER_LOAD_STORAGE(Name, ComponentT)                                                         \
+  SDE_EXPORT void Name##_on_load_storage(void* iarchive, const void* remap, void* registry)                            \
+  {                                                                                                                    \
+    ::sde::game::component_load_storage_impl<ComponentT>(                                                              \
+      #Name,                                                                                                           \
+      *reinterpret_cast<::sde::game::IArchive*>(iarchive),                                                             \
+      *reinterpret_cast<const ::sde::game::EntityIDRemap*>(remap),                                                     \
+      *reinterpret_cast<::sde::game::Registry*>(registry));                                                            \
+  }
+
+#define SDE_COMPONENT__REGISTER_SAVE_STORAGE(Name, ComponentT)                                                         \
+  SDE_EXPORT void Name##_on_save_storage(void* oarchive, const void* registry)                                         \
+  {                                                                                                                    \
+    ::sde::game::component_save_storage_impl<ComponentT>(                                                              \
+      #Name,                                                                                                           \
+      *reinterpret_cast<::sde::game::OArchive*>(oarchive),                                                             \
+      *reinterpret_cast<const ::sde::game::Registry*>(registry));                                                      \
+  }
+
+
 #define SDE_COMPONENT__REGISTER(Name, ComponentT)                                                                      \
   SDE_COMPONENT__REGISTER_NAME(Name, ComponentT)                                                                       \
   SDE_COMPONENT__REGISTER_LOAD(Name, ComponentT)                                                                       \
-  SDE_COMPONENT__REGISTER_SAVE(Name, ComponentT)
+  SDE_COMPONENT__REGISTER_SAVE(Name, ComponentT)                                                                       \
+  SDE_COMPONENT__REGISTER_LOAD_STORAGE(Name, ComponentT)                                                               \
+  SDE_COMPONENT__REGISTER_SAVE_STORAGE(Name, ComponentT)
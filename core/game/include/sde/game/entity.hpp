@@ -61,7 +61,7 @@ public:
     {
       return make_unexpected(EntityError::kComponentAlreadyAttached);
     }
-    else if (auto component = components_->to_handle(sde::string{ComponentName<ComponentT>::value}); !component)
+    else if (auto component = components_->to_handle(ComponentName<ComponentT>::value); !component)
     {
       return make_unexpected(EntityError::kComponentNotRegistered);
     }
@@ -7,12 +7,17 @@
 
 // C++ Standard Library
 #include <iosfwd>
+#include <memory>
 #include <string_view>
 
 // SDE
 #include "sde/app_fwd.hpp"
+#include "sde/async_file_writer.hpp"
 #include "sde/game/game_resources.hpp"
 #include "sde/game/scene.hpp"
+#include "sde/game/script_scheduler.hpp"
+#include "sde/interned_string.hpp"
+#include "sde/jobs.hpp"
 #include "sde/resource.hpp"
 #include "sde/vector.hpp"
 
@@ -32,6 +37,7 @@ enum class GameError
   kResourceSaveError,
   kEntityLoadError,
   kEntitySaveError,
+  kAssetPackLoadError,
 };
 
 std::ostream& operator<<(std::ostream& os, GameError error);
@@ -39,21 +45,40 @@ std::ostream& operator<<(std::ostream& os, GameError error);
 struct GameConfig : Resource<GameConfig>
 {
   Rate rate = {};
+  /// Fixed simulation step rate; if not given, scripts simulate a single step of the measured frame time per update
+  Rate simulation_rate = {};
+  /// Most fixed simulation steps per update
+  std::size_t max_simulation_steps = 5;
+  /// Number of display refreshes to wait between buffer swaps; 0 disables VSync
+  int swap_interval = 1;
   asset::path assets_data_path = {};
   asset::path entity_data_path = {};
   asset::path script_data_path = {};
   asset::path window_icon_path = {};
   asset::path cursor_icon_path = {};
+  asset::path asset_pack_path = {};
+  asset::path cooked_assets_path = {};
+  /// Number of job worker threads; scripts with declared resource access update on these
+  std::size_t job_workers = 0;
+  /// Check script resource access against declared access (see ScriptScheduler)
+  bool script_race_detection = false;
 
   auto field_list()
   {
     return FieldList(
       Field{"rate", rate},
+      Field{"simulation_rate", simulation_rate},
+      Field{"max_simulation_steps", max_simulation_steps},
+      Field{"swap_interval", swap_interval},
       Field{"assets_data_path", assets_data_path},
       Field{"entity_data_path", entity_data_path},
       Field{"script_data_path", script_data_path},
       Field{"window_icon_path", window_icon_path},
-      Field{"cursor_icon_path", cursor_icon_path});
+      Field{"cursor_icon_path", cursor_icon_path},
+      Field{"asset_pack_path", asset_pack_path},
+      Field{"cooked_assets_path", cooked_assets_path},
+      Field{"job_workers", job_workers},
+      Field{"script_race_detection", script_race_detection});
   }
 };
 
@@ -65,6 +90,17 @@ public:
 
   void spin(App& app);
 
+  /**
+   * @brief Returns game resources, e.g. to inspect entities after running a headless app
+   */
+  [[nodiscard]] GameResources& resources() { return resources_; }
+  [[nodiscard]] const GameResources& resources() const { return resources_; }
+
+  /**
+   * @brief Saves entity and resource data
+   *
+   * @note returns once data is written to file, so that write failures are reported
+   */
   [[nodiscard]] expected<void, GameError> dump();
   [[nodiscard]] static expected<Game, GameError> create(const asset::path& path);
 
@@ -82,6 +118,18 @@ private:
   SceneHandle active_scene_ = SceneHandle::null();
 
   sde::vector<SceneNodeFlattened> active_scene_sequence_ = {};
+
+  /// Profiled scope names of scripts in active_scene_sequence_
+  sde::vector<InternedString> active_scene_profile_names_ = {};
+
+  /// Update order of scripts in active_scene_sequence_
+  ScriptSchedule active_scene_schedule_ = {};
+
+  std::unique_ptr<jobs::JobSystem> jobs_;
+
+  std::unique_ptr<ScriptScheduler> scheduler_;
+
+  std::unique_ptr<AsyncFileWriter> writer_;
 };
 
 [[nodiscard]] inline expected<Game, GameError> create(const asset::path& path) { return Game::create(path); }
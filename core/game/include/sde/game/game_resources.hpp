@@ -5,10 +5,15 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <memory>
+
 // SDE
 #include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
 #include "sde/audio/sound.hpp"
 #include "sde/audio/sound_data.hpp"
+#include "sde/cooked_asset.hpp"
 #include "sde/expected.hpp"
 #include "sde/game/component.hpp"
 #include "sde/game/entity.hpp"
@@ -17,6 +22,7 @@
 #include "sde/game/native_script_instance.hpp"
 #include "sde/game/registry.hpp"
 #include "sde/game/scene.hpp"
+#include "sde/game/script_timing.hpp"
 #include "sde/graphics/font.hpp"
 #include "sde/graphics/image.hpp"
 #include "sde/graphics/render_target.hpp"
@@ -70,12 +76,28 @@ public:
 
   asset::path path(const asset::path& original_path) const;
 
+  /**
+   * @brief Reads images, fonts, shaders and sound data through \p file_system instead of directly from disk
+   */
+  void setFileSystem(std::shared_ptr<const AssetFileSystem> file_system);
+
+  /**
+   * @brief Loads images, type sets and sound data from \p cooked_assets when cooked versions are available
+   */
+  void setCookedAssets(std::shared_ptr<const CookedAssetStore> cooked_assets);
+
   SceneHandle getNextScene() const { return next_scene_; }
 
   bool setNextScene(SceneHandle scene);
 
   bool setNextScene(const sde::string& scene_name);
 
+  /**
+   * @brief Returns update timing and budgets of script instances
+   */
+  ScriptTimings& scriptTimings() { return script_timings_; }
+  const ScriptTimings& scriptTimings() const { return script_timings_; }
+
   template <typename CreateT> decltype(auto) instance(EntityHandle& h, CreateT&& create)
   {
     return this->template get<EntityCache>().instance(h, this->all(), std::forward<CreateT>(create));
@@ -84,6 +106,7 @@ public:
 private:
   asset::path root_path_;
   SceneHandle next_scene_ = SceneHandle::null();
+  ScriptTimings script_timings_;
 };
 
 }  // namespace sde::game
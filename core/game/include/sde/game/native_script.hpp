@@ -54,10 +54,10 @@ class NativeScriptCache : public ResourceCache<NativeScriptCache>
 public:
   using fundemental_type::to_handle;
   NativeScriptHandle to_handle(const LibraryHandle& library) const;
-  NativeScriptHandle to_handle(const sde::string& name) const;
+  NativeScriptHandle to_handle(std::string_view name) const;
 
 private:
-  sde::unordered_map<sde::string, NativeScriptHandle> name_to_native_script_lookup_;
+  sde::unordered_map<sde::string, NativeScriptHandle, string_hash, std::equal_to<>> name_to_native_script_lookup_;
   sde::unordered_map<LibraryHandle, NativeScriptHandle, ResourceHandleStdHash> library_to_native_script_lookup_;
   expected<void, NativeScriptError> reload(dependencies deps, NativeScriptData& script);
   expected<void, NativeScriptError> unload(dependencies deps, NativeScriptData& script);
@@ -19,6 +19,7 @@
 #include "sde/game/native_script_instance_handle.hpp"
 #include "sde/game/native_script_methods.hpp"
 #include "sde/game/native_script_typedefs.hpp"
+#include "sde/game/script_archive.hpp"
 #include "sde/resource.hpp"
 #include "sde/resource_cache.hpp"
 #include "sde/string.hpp"
@@ -59,6 +60,16 @@ public:
 
   script_version_t version() const { return methods_.on_get_version(); }
 
+  /**
+   * @brief Returns resources read during update, or \c nullptr if not declared (see ScriptAccess)
+   */
+  const char* reads() const { return methods_.on_get_reads(); }
+
+  /**
+   * @brief Returns resources written during update, or \c nullptr if not declared (see ScriptAccess)
+   */
+  const char* writes() const { return methods_.on_get_writes(); }
+
   bool initialize(
     NativeScriptInstanceHandle handle,
     std::string_view name,
@@ -125,22 +136,25 @@ class NativeScriptInstanceCache : public ResourceCache<NativeScriptInstanceCache
 
 public:
   using fundemental_type::to_handle;
-  NativeScriptInstanceHandle to_handle(const sde::string& name) const;
+  NativeScriptInstanceHandle to_handle(std::string_view name) const;
 
   /**
-   * @brief Loads data for a particular script instance
+   * @brief Loads data for a particular script instance from its record in \p archive
+   *
+   * @note returns NativeScriptInstanceError::kInstanceDataUnavailable if \p archive holds no record for the instance,
+   *       or if its record was saved by a different script type or version
    */
   expected<void, NativeScriptInstanceError>
-  load(NativeScriptInstanceHandle handle, const asset::path& script_data_path);
+  load(NativeScriptInstanceHandle handle, ScriptArchive& archive);
 
   /**
-   * @brief Saves data for a particular script instance
+   * @brief Saves data for a particular script instance as a record in \p archive
    */
   expected<void, NativeScriptInstanceError>
-  save(NativeScriptInstanceHandle handle, const asset::path& script_data_path) const;
+  save(NativeScriptInstanceHandle handle, ScriptArchiveWriter& archive) const;
 
 private:
-  sde::unordered_map<sde::string, NativeScriptInstanceHandle> name_to_instance_lookup_;
+  sde::unordered_map<sde::string, NativeScriptInstanceHandle, string_hash, std::equal_to<>> name_to_instance_lookup_;
   expected<void, NativeScriptInstanceError> reload(dependencies deps, NativeScriptInstanceData& library);
   expected<void, NativeScriptInstanceError> unload(dependencies deps, NativeScriptInstanceData& library);
   expected<NativeScriptInstanceData, NativeScriptInstanceError>
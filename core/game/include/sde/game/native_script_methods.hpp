@@ -19,6 +19,8 @@ struct NativeScriptMethods : public Resource<NativeScriptMethods>
   dl::Function<void(ScriptInstanceDeallocator, void*)> on_destroy;
   dl::Function<const char*()> on_get_type_name;
   dl::Function<const char*()> on_get_description;
+  dl::Function<const char*()> on_get_reads;
+  dl::Function<const char*()> on_get_writes;
   dl::Function<script_version_t()> on_get_version;
   dl::Function<bool(void*, void*)> on_load;
   dl::Function<bool(void*, void*)> on_save;
@@ -40,6 +42,8 @@ struct NativeScriptMethods : public Resource<NativeScriptMethods>
       _Stub{"on_destroy", on_destroy},
       _Stub{"on_get_type_name", on_get_type_name},
       _Stub{"on_get_description", on_get_description},
+      _Stub{"on_get_reads", on_get_reads},
+      _Stub{"on_get_writes", on_get_writes},
       _Stub{"on_get_version", on_get_version},
       _Stub{"on_load", on_load},
       _Stub{"on_save", on_save},
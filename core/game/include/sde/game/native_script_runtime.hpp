@@ -140,15 +140,37 @@ private:
 #endif  // SDE_SCRIPT_DESCRIPTION
 
 
+// Resources read and written during update, as comma-separated lists (see sde::game::ScriptAccess)
+#ifndef SDE_SCRIPT_READS
+#define SDE_NATIVE_SCRIPT__REGISTER_READS(ScriptDataT)                                                                 \
+  SDE_EXPORT const char* on_get_reads() { return nullptr; }
+#else
+#define SDE_NATIVE_SCRIPT__REGISTER_READS(ScriptDataT)                                                                 \
+  SDE_EXPORT const char* on_get_reads() { return SDE_SCRIPT_READS; }
+#endif  // SDE_SCRIPT_READS
+
+
+#ifndef SDE_SCRIPT_WRITES
+#define SDE_NATIVE_SCRIPT__REGISTER_WRITES(ScriptDataT)                                                                \
+  SDE_EXPORT const char* on_get_writes() { return nullptr; }
+#else
+#define SDE_NATIVE_SCRIPT__REGISTER_WRITES(ScriptDataT)                                                                \
+  SDE_EXPORT const char* on_get_writes() { return SDE_SCRIPT_WRITES; }
+#endif  // SDE_SCRIPT_WRITES
+
+
 #ifndef SDE_SCRIPT_VERSION
-#define SDE_NATIVE_SCRIPT__REGISTER_VERSION(ScriptDataT, fn)                                                           \
-  SDE_EXPORT script_version_t on_get_version()                                                                         \
-  {                                                                                                                    \
-    static_assert(std::is_base_of_v<native_script_data, ScriptDataT>);                                                 \
-    ::sde::game::VArchive varchive;                                                                                    \
-    ScriptDataT data;                                                                                                  \
-    fn(&data, varchive);                                                                                               \
-    return varchive.digest().value;                                                                                    \
+#define SDE_NATIVE_SCRIPT__REGISTER_VERSION(ScriptDataT, fn)                                                            \
+  SDE_EXPORT script_version_t on_get_version()                                                                          \
+  {                                                                                                                     \
+    static_assert(std::is_base_of_v<native_script_data, ScriptDataT>);                                                  \
+    static const script_version_t kVersion = [] {                                                                       \
+      ::sde::game::VArchive varchive;                                                                                   \
+      ScriptDataT data;                                                                                                 \
+      fn(&data, varchive);                                                                                              \
+      return varchive.digest().value;                                                                                   \
+    }();                                                                                                                \
+    return kVersion;                                                                                                    \
   }
 #else
 #define SDE_NATIVE_SCRIPT__REGISTER_VERSION(ScriptDataT, fn)                                                           \
@@ -220,6 +242,8 @@ private:
   SDE_NATIVE_SCRIPT__REGISTER_DESTROY(ScriptDataT);                                                                    \
   SDE_NATIVE_SCRIPT__REGISTER_NAME(ScriptDataT);                                                                       \
   SDE_NATIVE_SCRIPT__REGISTER_DESCRIPTION(ScriptDataT);                                                                \
+  SDE_NATIVE_SCRIPT__REGISTER_READS(ScriptDataT);                                                                      \
+  SDE_NATIVE_SCRIPT__REGISTER_WRITES(ScriptDataT);                                                                     \
   SDE_NATIVE_SCRIPT__REGISTER_VERSION(ScriptDataT, serialize);                                                         \
   SDE_NATIVE_SCRIPT__REGISTER_LOAD(ScriptDataT, serialize);                                                            \
   SDE_NATIVE_SCRIPT__REGISTER_SAVE(ScriptDataT, serialize);                                                            \
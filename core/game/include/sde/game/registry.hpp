@@ -5,9 +5,19 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
 // SDE
+#include "sde/game/component_decl.hpp"
 #include "sde/memory.hpp"
+#include "sde/resource_access_observer.hpp"
 #include "sde/resource_cache.hpp"
+#include "sde/vector.hpp"
 
 /// EnTT
 #include <entt/entity/registry.hpp>
@@ -16,8 +26,20 @@ namespace sde::game
 {
 
 using EntityID = entt::entity;
-class Registry : public entt::basic_registry<EntityID, allocator<EntityID>>
+
+/**
+ * @brief Entity component registry
+ *
+ *        Component access through view(), get(), try_get(), all_of(), any_of(), emplace(), emplace_or_replace(),
+ *        replace(), patch(), remove() and erase() is reported to the access observer, if set, labeled as
+ *        "registry/<component name>" (see ComponentName). Components of a non-const view, or fetched from a non-const
+ *        registry, are reported as written unless const-qualified, e.g. \c view<Position, const Dynamics>() writes
+ *        Position and reads Dynamics. Creating and destroying entities is not reported.
+ */
+class Registry : public entt::basic_registry<EntityID, tagged_allocator<EntityID, MemoryTag::kGame>>
 {
+  using base = entt::basic_registry<EntityID, tagged_allocator<EntityID, MemoryTag::kGame>>;
+
 public:
   Registry() = default;
 
@@ -29,9 +51,149 @@ public:
 
   void clear([[maybe_unused]] no_dependencies _) { base::clear(); }
 
+  /**
+   * @brief Sets an observer which is notified of every component access; \c nullptr to disable
+   */
+  void setAccessObserver(ResourceAccessObserver* observer) { access_observer_ = observer; }
+
+  template <typename... ComponentTs, typename... ArgTs> [[nodiscard]] decltype(auto) view(ArgTs&&... args)
+  {
+    (onAccess<ComponentTs>(!std::is_const_v<ComponentTs>), ...);
+    return base::template view<ComponentTs...>(std::forward<ArgTs>(args)...);
+  }
+
+  template <typename... ComponentTs, typename... ArgTs> [[nodiscard]] decltype(auto) view(ArgTs&&... args) const
+  {
+    (onAccess<ComponentTs>(false), ...);
+    return base::template view<ComponentTs...>(std::forward<ArgTs>(args)...);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] decltype(auto) get(EntityID id)
+  {
+    (onAccess<ComponentTs>(!std::is_const_v<ComponentTs>), ...);
+    return base::template get<ComponentTs...>(id);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] decltype(auto) get(EntityID id) const
+  {
+    (onAccess<ComponentTs>(false), ...);
+    return base::template get<ComponentTs...>(id);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] auto try_get(EntityID id)
+  {
+    (onAccess<ComponentTs>(!std::is_const_v<ComponentTs>), ...);
+    return base::template try_get<ComponentTs...>(id);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] auto try_get(EntityID id) const
+  {
+    (onAccess<ComponentTs>(false), ...);
+    return base::template try_get<ComponentTs...>(id);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] bool all_of(EntityID id) const
+  {
+    (onAccess<ComponentTs>(false), ...);
+    return base::template all_of<ComponentTs...>(id);
+  }
+
+  template <typename... ComponentTs> [[nodiscard]] bool any_of(EntityID id) const
+  {
+    (onAccess<ComponentTs>(false), ...);
+    return base::template any_of<ComponentTs...>(id);
+  }
+
+  template <typename ComponentT, typename... ArgTs> decltype(auto) emplace(EntityID id, ArgTs&&... args)
+  {
+    onAccess<ComponentT>(true);
+    return base::template emplace<ComponentT>(id, std::forward<ArgTs>(args)...);
+  }
+
+  template <typename ComponentT, typename... ArgTs> decltype(auto) emplace_or_replace(EntityID id, ArgTs&&... args)
+  {
+    onAccess<ComponentT>(true);
+    return base::template emplace_or_replace<ComponentT>(id, std::forward<ArgTs>(args)...);
+  }
+
+  template <typename ComponentT, typename... ArgTs> decltype(auto) replace(EntityID id, ArgTs&&... args)
+  {
+    onAccess<ComponentT>(true);
+    return base::template replace<ComponentT>(id, std::forward<ArgTs>(args)...);
+  }
+
+  template <typename ComponentT, typename... FnTs> decltype(auto) patch(EntityID id, FnTs&&... fns)
+  {
+    onAccess<ComponentT>(true);
+    return base::template patch<ComponentT>(id, std::forward<FnTs>(fns)...);
+  }
+
+  template <typename... ComponentTs, typename... ArgTs> decltype(auto) remove(ArgTs&&... args)
+  {
+    (onAccess<ComponentTs>(true), ...);
+    return base::template remove<ComponentTs...>(std::forward<ArgTs>(args)...);
+  }
+
+  template <typename... ComponentTs, typename... ArgTs> void erase(ArgTs&&... args)
+  {
+    (onAccess<ComponentTs>(true), ...);
+    base::template erase<ComponentTs...>(std::forward<ArgTs>(args)...);
+  }
+
 private:
-  using base = entt::basic_registry<EntityID, allocator<EntityID>>;
   using base::clear;
+
+  /**
+   * @brief Returns access label of \p ComponentT
+   */
+  template <typename ComponentT> static std::string_view label()
+  {
+    static const std::string kLabel = std::string{"registry/"} + std::string{ComponentName<ComponentT>::value};
+    return kLabel;
+  }
+
+  template <typename ComponentT> void onAccess(bool write) const
+  {
+    if (access_observer_ != nullptr)
+    {
+      access_observer_->onAccess(label<std::remove_const_t<ComponentT>>(), write);
+    }
+  }
+
+  /// Notified of component accesses
+  ResourceAccessObserver* access_observer_ = nullptr;
+};
+
+/**
+ * @brief Maps entity IDs saved from a registry to the IDs of the same entities in a loaded registry
+ */
+class EntityIDRemap
+{
+public:
+  void reserve(std::size_t count) { saved_to_loaded_.reserve(count); }
+
+  void insert(EntityID saved, EntityID loaded)
+  {
+    const auto index = static_cast<std::size_t>(entt::to_entity(saved));
+    if (index >= saved_to_loaded_.size())
+    {
+      saved_to_loaded_.resize(index + 1, entt::null);
+    }
+    saved_to_loaded_[index] = loaded;
+  }
+
+  /**
+   * @brief Returns loaded ID of entity \p saved , or entt::null if entity was not loaded
+   */
+  [[nodiscard]] EntityID operator()(EntityID saved) const
+  {
+    const auto index = static_cast<std::size_t>(entt::to_entity(saved));
+    return (index < saved_to_loaded_.size()) ? saved_to_loaded_[index] : static_cast<EntityID>(entt::null);
+  }
+
+private:
+  /// Loaded entity IDs, indexed by the entity part of saved IDs
+  sde::vector<EntityID> saved_to_loaded_;
 };
 
 }  // namespace sde::game
@@ -47,7 +47,10 @@ struct SceneNodeFlattened : Resource<SceneNodeFlattened>
   /// Instance
   NativeScriptInstance instance = {};
 
-  auto field_list() { return FieldList(Field{"handle", handle}, _Stub{"instance", instance}); }
+  /// Scene which lists this instance
+  SceneHandle scene = SceneHandle::null();
+
+  auto field_list() { return FieldList(Field{"handle", handle}, _Stub{"instance", instance}, Field{"scene", scene}); }
 };
 
 struct SceneNode : Resource<SceneNode>
@@ -82,12 +85,12 @@ class SceneCache : public ResourceCache<SceneCache>
 public:
   using fundemental_type::to_handle;
 
-  SceneHandle to_handle(const sde::string& name) const;
+  SceneHandle to_handle(std::string_view name) const;
 
   expected<sde::vector<SceneNodeFlattened>, SceneError> expand(SceneHandle root, dependencies deps) const;
 
 private:
-  sde::unordered_map<sde::string, SceneHandle> name_to_scene_lookup_;
+  sde::unordered_map<sde::string, SceneHandle, string_hash, std::equal_to<>> name_to_scene_lookup_;
   expected<SceneData, SceneError> generate(dependencies deps, sde::string name, sde::vector<SceneNode> nodes = {});
   void when_created(dependencies deps, SceneHandle handle, const SceneData* data);
   void when_removed(dependencies deps, SceneHandle handle, SceneData* data);
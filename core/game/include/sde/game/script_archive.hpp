@@ -0,0 +1,222 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file script_archive.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+// SDE
+#include "sde/asset.hpp"
+#include "sde/expected.hpp"
+#include "sde/game/archive.hpp"
+#include "sde/game/native_script_typedefs.hpp"
+#include "sde/serial/mem_buffer_pool.hpp"
+#include "sde/vector.hpp"
+
+namespace sde::game
+{
+
+enum class ScriptArchiveError
+{
+  kFileDoesNotExist,
+  kFileOpenFailed,
+  kInvalidFooter,
+  kInvalidIndex,
+  kDuplicateRecord,
+  kRecordMissing,
+  kRecordOutdated,
+  kRecordSaveFailed,
+  kRecordLoadFailed,
+};
+
+std::ostream& operator<<(std::ostream& os, ScriptArchiveError error);
+
+/**
+ * @brief Script archive file footer
+ */
+struct ScriptArchiveFooter
+{
+  static constexpr std::size_t kMagic = 0x3150524353454453UL;  // "SDESCRP1"
+
+  std::size_t magic = kMagic;
+  /// Number of entries in the index
+  std::size_t entry_count = 0;
+  /// Offset of the index from the start of the file, in bytes
+  std::size_t index_offset = 0;
+};
+
+/**
+ * @brief Describes where data for a single script instance lives in a script archive
+ */
+struct ScriptArchiveEntry
+{
+  /// Hash of the script instance name (see ScriptArchiveNameHash)
+  std::uint64_t name_hash;
+  /// Hash of the script type name (see ScriptArchiveNameHash)
+  std::uint64_t type_hash;
+  /// Script version the record was saved with
+  script_version_t version;
+  /// Offset of the record from the start of the file, in bytes
+  std::size_t offset;
+  /// Length of the record, in bytes
+  std::size_t length;
+
+  constexpr bool operator<(const ScriptArchiveEntry& other) const { return name_hash < other.name_hash; }
+};
+
+/**
+ * @brief Returns the hash used to look up script instance and type names in a script archive
+ */
+std::uint64_t ScriptArchiveNameHash(std::string_view name);
+
+/**
+ * @brief Serializes script instance records into a script archive held in memory
+ *
+ *        A script archive is laid out as each record serialized back-to-back, followed by an index of
+ *        ScriptArchiveEntry sorted by instance name hash, followed by a ScriptArchiveFooter. The archive is built in
+ *        memory so that it can be written to file in one go, away from the calling thread (see AsyncFileWriter).
+ */
+class ScriptArchiveWriter
+{
+public:
+  ScriptArchiveWriter() = default;
+
+  /**
+   * @brief Creates a writer which builds the archive in storage taken from \p pool
+   */
+  explicit ScriptArchiveWriter(serial::mem_buffer_pool& pool) : buffer_{pool} {}
+
+  ScriptArchiveWriter(ScriptArchiveWriter&&) = default;
+
+  /**
+   * @brief Adds a record for the script instance \p name
+   *
+   * @param name  script instance name
+   * @param type  script type name
+   * @param version  script version
+   * @param save_record  invoked as \c save_record(OArchive&) to write record data; returns \c false on failure
+   */
+  template <typename SaveT>
+  [[nodiscard]] expected<void, ScriptArchiveError>
+  add(std::string_view name, std::string_view type, script_version_t version, SaveT&& save_record)
+  {
+    const std::size_t offset = buffer_.size();
+    if (OArchive oar{buffer_}; !save_record(oar))
+    {
+      return make_unexpected(ScriptArchiveError::kRecordSaveFailed);
+    }
+    index_.push_back(
+      {.name_hash = ScriptArchiveNameHash(name),
+       .type_hash = ScriptArchiveNameHash(type),
+       .version = version,
+       .offset = offset,
+       .length = buffer_.size() - offset});
+    return {};
+  }
+
+  /**
+   * @brief Returns the number of records added so far
+   */
+  [[nodiscard]] std::size_t size() const { return index_.size(); }
+
+  /**
+   * @brief Writes index and footer after all records
+   *
+   * @return complete archive bytes
+   */
+  [[nodiscard]] expected<serial::mem_ostream, ScriptArchiveError> finish() &&;
+
+private:
+  /// Archive bytes
+  serial::mem_ostream buffer_;
+  /// Entries of all added records
+  sde::vector<ScriptArchiveEntry> index_;
+};
+
+/**
+ * @brief Read-only view of a script archive file
+ *
+ *        Only the index is read when an archive is opened. Records are read from a memory mapping of the file, so
+ *        loading a record seeks directly to it, and records which do not match the expected script type or version
+ *        are skipped without reading any of their data.
+ */
+class ScriptArchive
+{
+public:
+  static expected<ScriptArchive, ScriptArchiveError> open(const asset::path& path);
+
+  /**
+   * @brief Returns entries for all records in the archive, sorted by instance name hash
+   */
+  [[nodiscard]] std::span<const ScriptArchiveEntry> entries() const { return {index_.data(), index_.size()}; }
+
+  /**
+   * @brief Returns the entry for the script instance \p name , if the archive holds a record for it
+   */
+  [[nodiscard]] std::optional<ScriptArchiveEntry> find(std::string_view name) const;
+
+  /**
+   * @brief Loads the record for the script instance \p name
+   *
+   * @param name  script instance name
+   * @param type  script type name; record is skipped if it was saved for another type
+   * @param version  script version; record is skipped if it was saved with another version
+   * @param load_record  invoked as \c load_record(IArchive&) to read record data; returns \c false on failure
+   */
+  template <typename LoadT>
+  [[nodiscard]] expected<void, ScriptArchiveError>
+  load(std::string_view name, std::string_view type, script_version_t version, LoadT&& load_record)
+  {
+    const auto entry = find(name);
+    if (!entry.has_value())
+    {
+      return make_unexpected(ScriptArchiveError::kRecordMissing);
+    }
+    else if ((entry->type_hash != ScriptArchiveNameHash(type)) or (entry->version != version))
+    {
+      return make_unexpected(ScriptArchiveError::kRecordOutdated);
+    }
+    else if (!stream_.seek(entry->offset))
+    {
+      return make_unexpected(ScriptArchiveError::kRecordLoadFailed);
+    }
+    else if (IArchive iar{stream_}; !load_record(iar) or (stream_.tell() != (entry->offset + entry->length)))
+    {
+      return make_unexpected(ScriptArchiveError::kRecordLoadFailed);
+    }
+    return {};
+  }
+
+  ScriptArchive(ScriptArchive&&) = default;
+  ScriptArchive& operator=(ScriptArchive&&) = default;
+
+private:
+  ScriptArchive(serial::mmap_istream&& stream, sde::vector<ScriptArchiveEntry>&& index);
+
+  /// Mapped archive file
+  serial::mmap_istream stream_;
+  /// Entries of all records in the archive
+  sde::vector<ScriptArchiveEntry> index_;
+};
+
+}  // namespace sde::game
+
+namespace sde::serial
+{
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, game::ScriptArchiveFooter> : std::true_type
+{};
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, game::ScriptArchiveEntry> : std::true_type
+{};
+
+}  // namespace sde::serial
@@ -0,0 +1,168 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file script_scheduler.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
+
+// SDE
+#include "sde/jobs.hpp"
+#include "sde/resource_access_observer.hpp"
+#include "sde/string.hpp"
+#include "sde/vector.hpp"
+
+namespace sde::game
+{
+
+/**
+ * @brief Resources which a script reads and writes during update
+ *
+ *        Each entry is a GameResources cache label (e.g. "textures"), optionally followed by '/' and a component type
+ *        name to narrow access to a single component of that cache (e.g. "registry/Position"). A script which does not
+ *        declare any access is exclusive: it conflicts with every other script.
+ *
+ *        Component names are those reported by Registry (see ComponentName), which is the only cache that reports
+ *        component access; narrowing access to other caches only narrows conflicts, and is not checked.
+ *
+ *        Entries need not name a cache: scripts which use ImGui declare "imgui" written, so that they never update at
+ *        the same time as each other. Such entries are not checked.
+ */
+struct ScriptAccess
+{
+  /// Resources read during update
+  sde::vector<sde::string> reads = {};
+  /// Resources written during update
+  sde::vector<sde::string> writes = {};
+  /// Set if access was not declared
+  bool exclusive = true;
+
+  /**
+   * @brief Parses access declared as comma-separated lists of resources
+   *
+   * @param reads  resources read, or \c nullptr if not declared
+   * @param writes  resources written, or \c nullptr if not declared
+   */
+  static ScriptAccess parse(const char* reads, const char* writes);
+
+  /**
+   * @brief Returns true if this script may not update at the same time as \p other
+   */
+  [[nodiscard]] bool conflicts(const ScriptAccess& other) const;
+
+  /**
+   * @brief Returns true if accessing \p label , a cache or a component of one, is covered by declared access
+   *
+   *        Fetching a cache is covered by declared access to any of its components; each component access made through
+   *        the cache is then checked against the components declared.
+   */
+  [[nodiscard]] bool permits(std::string_view label, bool write) const;
+};
+
+/**
+ * @brief Script update order in which conflicting scripts update in the order they were added
+ */
+class ScriptSchedule
+{
+public:
+  struct Node
+  {
+    /// Script instance name
+    sde::string name;
+    /// Declared resource access
+    ScriptAccess access;
+    /// Nodes which may only update after this one
+    sde::vector<std::size_t> successors;
+    /// Number of nodes which must update before this one
+    std::size_t dependencies;
+  };
+
+  /**
+   * @brief Adds a script after all previously added scripts, which it must follow if their access conflicts
+   *
+   * @return index of added script
+   */
+  std::size_t add(std::string_view name, ScriptAccess access);
+
+  /**
+   * @brief Removes all scripts
+   */
+  void clear() { nodes_.clear(); }
+
+  [[nodiscard]] std::size_t size() const { return nodes_.size(); }
+
+  [[nodiscard]] const Node& operator[](std::size_t i) const { return nodes_[i]; }
+
+  [[nodiscard]] std::span<const Node> nodes() const { return {nodes_.data(), nodes_.size()}; }
+
+private:
+  sde::vector<Node> nodes_;
+};
+
+/**
+ * @brief Updates scripts as jobs, following a ScriptSchedule
+ *
+ *        Scripts which declare their resource access may update on any job worker, or on the calling thread, at the
+ *        same time as any scripts they do not conflict with. Exclusive scripts always update on the main thread of the
+ *        jobs::JobSystem, alone, so scripts which touch thread-affine state (GL, windowing) should not declare access.
+ *
+ *        With race detection enabled, every cache access made by a script through an observed ResourceCollection (see
+ *        ResourceCollection::setAccessObserver), and every component access made through an observed Registry (see
+ *        Registry::setAccessObserver), is checked against the access that script declared.
+ */
+class ScriptScheduler : public ResourceAccessObserver
+{
+public:
+  /**
+   * @param jobs  job system which scripts update on; with no workers, scripts update on the calling thread in order
+   */
+  explicit ScriptScheduler(jobs::JobSystem& jobs) : jobs_{std::addressof(jobs)} {}
+
+  ScriptScheduler(const ScriptScheduler&) = delete;
+  ScriptScheduler& operator=(const ScriptScheduler&) = delete;
+
+  /**
+   * @brief Updates all scripts in \p schedule ; must be called from the main thread of the job system
+   *
+   * @param update  invoked as \c update(i) to update the i-th script of \p schedule ; returns \c false on failure
+   *
+   * @return \c false if any update failed; scripts which depend on a failed script are not updated
+   */
+  bool run(const ScriptSchedule& schedule, const std::function<bool(std::size_t)>& update);
+
+  /**
+   * @brief Enables checking of script cache accesses against declared access
+   *
+   * @note must not be called while run() is in progress
+   */
+  void setRaceDetection(bool enabled) { race_detection_ = enabled; }
+
+  /**
+   * @brief Returns the number of undeclared cache accesses detected
+   */
+  [[nodiscard]] std::size_t races() const { return races_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Returns the number of job workers
+   */
+  [[nodiscard]] std::size_t workers() const { return jobs_->workers(); }
+
+  void onAccess(std::string_view label, bool write) override;
+
+private:
+  /// Job system which scripts update on
+  jobs::JobSystem* jobs_;
+  /// Set if cache accesses are checked against declared access
+  bool race_detection_ = false;
+  /// Number of undeclared cache accesses detected
+  std::atomic<std::size_t> races_ = 0;
+};
+
+}  // namespace sde::game
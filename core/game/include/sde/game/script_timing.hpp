@@ -0,0 +1,186 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file script_timing.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+// SDE
+#include "sde/game/native_script_instance_handle.hpp"
+#include "sde/string.hpp"
+#include "sde/time.hpp"
+#include "sde/unordered_map.hpp"
+
+namespace sde::game
+{
+
+/// Number of most recent updates which script timing statistics are computed over
+static constexpr std::size_t kScriptTimingWindow = 120;
+
+/**
+ * @brief Update time budget for a single script instance
+ */
+struct ScriptBudget
+{
+  /// Longest expected update duration; zero if the script has no budget
+  TimeOffset limit = TimeOffset::zero();
+  /// If set, the update following one which exceeded the budget is skipped
+  bool deferrable = false;
+};
+
+/**
+ * @brief Update time statistics for a single script instance, over its most recent updates
+ */
+struct ScriptTimingStats
+{
+  /// Duration of the most recent update
+  TimeOffset last = TimeOffset::zero();
+  /// Mean update duration
+  TimeOffset mean = TimeOffset::zero();
+  /// 99th percentile update duration
+  TimeOffset p99 = TimeOffset::zero();
+  /// Longest update duration
+  TimeOffset max = TimeOffset::zero();
+  /// Number of updates statistics were computed over
+  std::size_t samples = 0;
+  /// Total number of updates which exceeded the budget
+  std::size_t overruns = 0;
+  /// Total number of updates skipped after exceeding the budget
+  std::size_t deferrals = 0;
+};
+
+/**
+ * @brief Timing record for a single script instance
+ */
+class ScriptTiming
+{
+public:
+  ScriptTiming() = default;
+
+  explicit ScriptTiming(sde::string name) : name_{std::move(name)} {}
+
+  /**
+   * @brief Adds an update duration, replacing the oldest once kScriptTimingWindow durations have been added
+   */
+  void record(TimeOffset duration);
+
+  /**
+   * @brief Computes statistics over the most recently recorded durations
+   */
+  [[nodiscard]] ScriptTimingStats stats() const;
+
+  /**
+   * @brief Returns script instance name
+   */
+  [[nodiscard]] const sde::string& name() const { return name_; }
+
+  /**
+   * @brief Returns update time budget
+   */
+  [[nodiscard]] const ScriptBudget& budget() const { return budget_; }
+
+private:
+  friend class ScriptTimings;
+
+  /// Script instance name
+  sde::string name_ = {};
+  /// Update time budget
+  ScriptBudget budget_ = {};
+  /// Ring of most recent update durations
+  std::array<TimeOffset, kScriptTimingWindow> durations_ = {};
+  /// Total number of recorded durations
+  std::size_t count_ = 0;
+  /// Total number of updates which exceeded the budget
+  std::size_t overruns_ = 0;
+  /// Total number of skipped updates
+  std::size_t deferrals_ = 0;
+  /// Set if the next update should be skipped
+  bool deferred_ = false;
+};
+
+/**
+ * @brief Measures script instance updates and enforces per-instance update time budgets
+ *
+ *        An update which takes longer than its budget is logged. If the budget is marked deferrable, the following
+ *        update of that script is skipped, which spreads the cost of non-critical scripts over several frames. A
+ *        deferred script always runs on the update after it was skipped.
+ */
+class ScriptTimings
+{
+public:
+  /// Source of time used to measure updates
+  using clock_type = std::function<Clock::time_point()>;
+
+  ScriptTimings() = default;
+
+  explicit ScriptTimings(clock_type clock) : clock_{std::move(clock)} {}
+
+  /**
+   * @brief Sets the update time budget for script instance \p handle
+   */
+  void setBudget(NativeScriptInstanceHandle handle, const ScriptBudget& budget);
+
+  /**
+   * @brief Adds a timing record for script instance \p handle , if it has none
+   *
+   * @note run may be called for distinct script instances concurrently, provided each has been added beforehand
+   */
+  void add(NativeScriptInstanceHandle handle, std::string_view name) { this->get(handle, name); }
+
+  /**
+   * @brief Runs \p update for script instance \p handle , measuring its duration, unless it has been deferred
+   *
+   * @param handle  script instance handle
+   * @param name  script instance name, kept for reporting
+   * @param update  invoked as \c update() ; returns \c false on failure
+   *
+   * @return result of \p update , or \c true if the update was deferred
+   */
+  template <typename UpdateT> bool run(NativeScriptInstanceHandle handle, std::string_view name, UpdateT&& update)
+  {
+    auto& timing = this->get(handle, name);
+    if (timing.deferred_)
+    {
+      timing.deferred_ = false;
+      ++timing.deferrals_;
+      return true;
+    }
+    const auto t_start = clock_();
+    const bool ok = update();
+    this->finish(timing, clock_() - t_start);
+    return ok;
+  }
+
+  /**
+   * @brief Returns timing statistics for script instance \p handle , if it has been run or given a budget
+   */
+  [[nodiscard]] std::optional<ScriptTimingStats> stats(NativeScriptInstanceHandle handle) const;
+
+  /**
+   * @brief Clears recorded durations and pending deferrals of all scripts, keeping their budgets
+   */
+  void reset();
+
+  [[nodiscard]] auto begin() const { return timings_.begin(); }
+  [[nodiscard]] auto end() const { return timings_.end(); }
+
+private:
+  ScriptTiming& get(NativeScriptInstanceHandle handle, std::string_view name);
+
+  void finish(ScriptTiming& timing, TimeOffset duration);
+
+  /// Source of time used to measure updates
+  clock_type clock_ = Clock::now;
+  /// Timing records of all scripts which have been run or given a budget
+  sde::unordered_map<NativeScriptInstanceHandle, ScriptTiming, ResourceHandleStdHash> timings_;
+};
+
+}  // namespace sde::game
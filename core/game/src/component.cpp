@@ -41,6 +41,8 @@ void ComponentIO::swap(ComponentIO& other)
   std::swap(this->name_, other.name_);
   std::swap(this->on_load_, other.on_load_);
   std::swap(this->on_save_, other.on_save_);
+  std::swap(this->on_load_storage_, other.on_load_storage_);
+  std::swap(this->on_save_storage_, other.on_save_storage_);
 }
 
 void ComponentIO::reset()
@@ -81,6 +83,19 @@ void ComponentIO::save(OArchive& ar, EntityID id, const Registry& registry) cons
   on_save_(reinterpret_cast<void*>(&ar), reinterpret_cast<void*>(&id), reinterpret_cast<const void*>(&registry));
 }
 
+void ComponentIO::load_storage(IArchive& ar, const EntityIDRemap& remap, Registry& registry) const
+{
+  SDE_ASSERT_TRUE(on_load_storage_);
+  on_load_storage_(
+    reinterpret_cast<void*>(&ar), reinterpret_cast<const void*>(&remap), reinterpret_cast<void*>(&registry));
+}
+
+void ComponentIO::save_storage(OArchive& ar, const Registry& registry) const
+{
+  SDE_ASSERT_TRUE(on_save_storage_);
+  on_save_storage_(reinterpret_cast<void*>(&ar), reinterpret_cast<const void*>(&registry));
+}
+
 expected<void, ComponentError> ComponentCache::reload(dependencies deps, ComponentData& component)
 {
   auto library_ptr = deps.get<LibraryCache>().get_if(component.library);
@@ -149,7 +164,7 @@ void ComponentCache::when_removed([[maybe_unused]] dependencies deps, ComponentH
   type_name_to_component_handle_lookup_.erase(data->name);
 }
 
-ComponentHandle ComponentCache::to_handle(const sde::string& name) const
+ComponentHandle ComponentCache::to_handle(std::string_view name) const
 {
   const auto itr = type_name_to_component_handle_lookup_.find(name);
   if (itr == std::end(type_name_to_component_handle_lookup_))
@@ -7,6 +7,7 @@
 #include "sde/logging.hpp"
 #include "sde/resource_handle_io.hpp"
 #include "sde/resource_io.hpp"
+#include "sde/serial/std/string.hpp"
 #include "sde/serialization.hpp"
 #include "sde/serialization_binary_file.hpp"
 
@@ -69,34 +70,42 @@ expected<void, EntityError> EntityCache::load(dependencies deps, IArchive& archi
   auto& registry = deps.get<Registry>();
   const auto& components = deps.get<ComponentCache>();
 
+  // Map saved entity IDs to the IDs of the same entities in this registry
   std::size_t element_to_load_count = 0;
   archive >> named{"size", element_to_load_count};
-  SDE_LOG_INFO() << "Loading components for " << element_to_load_count << " entities";
+  EntityIDRemap remap;
+  remap.reserve(element_to_load_count);
   for (std::size_t n = 0; n < element_to_load_count; ++n)
   {
     // Elements might not be in the same order as they were saved, so we must
-    // load and insert at the absolute handle to this element
+    // load the absolute handle to this element
     EntityHandle handle = {};
+    EntityID saved_id = entt::null;
     archive >> named{"handle", handle};
+    archive >> named{"id", saved_id};
 
-    // Access entity
     const auto entity_itr = handle_to_value_cache_.find(handle);
     SDE_ASSERT_TRUE(entity_itr != std::end(handle_to_value_cache_)) << "Invalid entity handle: " << handle;
-    auto& entity = entity_itr->second.value;
+    remap.insert(saved_id, entity_itr->second.value.id);
+  }
 
-    // Load its components in order they were saved
-    for (const auto& component_handle : entity.components)
+  // Load components one type at a time
+  std::size_t component_count = 0;
+  archive >> named{"component_count", component_count};
+  SDE_LOG_INFO() << "Loading " << component_count << " components for " << element_to_load_count << " entities";
+  for (std::size_t n = 0; n < component_count; ++n)
+  {
+    sde::string name;
+    archive >> named{"component", name};
+    if (const auto c = components(components.to_handle(name)); c)
     {
-      if (const auto c = components(component_handle); c)
-      {
-        c->io.load(archive, entity.id, registry);
-        SDE_LOG_INFO() << handle << ": loaded component: " << c->name;
-      }
-      else
-      {
-        SDE_LOG_ERROR() << handle << ": failed to find component: " << component_handle;
-        return make_unexpected(EntityError::kComponentLoadFailure);
-      }
+      c->io.load_storage(archive, remap, registry);
+      SDE_LOG_DEBUG() << "loaded component: " << c->name;
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "failed to find component: " << name;
+      return make_unexpected(EntityError::kComponentLoadFailure);
     }
   }
   return {};
@@ -110,26 +119,23 @@ expected<void, EntityError> EntityCache::save(dependencies deps, OArchive& archi
   const auto& components = deps.get<ComponentCache>();
 
   archive << named{"size", handle_to_value_cache_.size()};
-  SDE_LOG_INFO() << "Saving components for " << handle_to_value_cache_.size() << " entities";
   for (auto& [handle, entity] : handle_to_value_cache_)
   {
     // Elements might not be in the same order as they were saved, so we must
     // save the absolute handle to this element
     archive << named{"handle", handle};
-    for (const auto& component_handle : entity->components)
-    {
-      // Save components in the order they were attached
-      if (const auto c = components(component_handle); c)
-      {
-        c->io.save(archive, entity->id, registry);
-        SDE_LOG_INFO() << handle << ": saved component: " << c->name;
-      }
-      else
-      {
-        SDE_LOG_ERROR() << handle << ": failed to find component: " << component_handle;
-        return make_unexpected(EntityError::kComponentDumpFailure);
-      }
-    }
+    archive << named{"id", entity->id};
+  }
+
+  // Save components one type at a time
+  archive << named{"component_count", components.size()};
+  SDE_LOG_INFO() << "Saving " << components.size() << " components for " << handle_to_value_cache_.size()
+                 << " entities";
+  for (const auto& [component_handle, component] : components)
+  {
+    archive << named{"component", component->name};
+    component->io.save_storage(archive, registry);
+    SDE_LOG_DEBUG() << "saved component: " << component->name;
   }
   return {};
 }
@@ -1,19 +1,30 @@
 // C++ Standard Library
+#include <algorithm>
 #include <fstream>
+#include <iterator>
+#include <optional>
 #include <ostream>
+#include <utility>
 
 // JSON
 #include <nlohmann/json.hpp>
 
 // SDE
 #include "sde/app.hpp"
+#include "sde/asset_file_system.hpp"
+#include "sde/asset_pack.hpp"
+#include "sde/cooked_asset.hpp"
+#include "sde/format.hpp"
 #include "sde/game/game.hpp"
 #include "sde/game/game_resources.hpp"
+#include "sde/game/script_archive.hpp"
 #include "sde/geometry_io.hpp"
 #include "sde/logging.hpp"
+#include "sde/profiler.hpp"
 #include "sde/resource_cache_io.hpp"
 #include "sde/resource_handle_io.hpp"
 #include "sde/resource_io.hpp"
+#include "sde/serial/mem_ostream.hpp"
 #include "sde/serial/std/filesystem.hpp"
 #include "sde/serial/std/optional.hpp"
 #include "sde/serial/std/vector.hpp"
@@ -25,20 +36,22 @@ namespace sde::game
 namespace
 {
 
-[[nodiscard]] bool save_entities(GameResources& resources, const asset::path& entity_data_path)
+[[nodiscard]] bool save_entities(GameResources& resources, AsyncFileWriter& writer, const asset::path& entity_data_path)
 {
   SDE_LOG_INFO() << "Saving:" << SDE_OSNV(entity_data_path);
-  auto ofs_or_error = serial::file_ostream::create(entity_data_path);
-  if (!ofs_or_error.has_value())
+  serial::mem_ostream buffer{writer.buffers()};
   {
-    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(entity_data_path);
-    return false;
+    OArchive oar{buffer};
+    if (auto ok_or_error = resources.get<EntityCache>().save(resources.all(), oar); !ok_or_error.has_value())
+    {
+      SDE_LOG_ERROR() << "Failed to save entity data: " << ok_or_error.error();
+      return false;
+    }
   }
-
-  OArchive oar{*ofs_or_error};
-  if (auto ok_or_error = resources.get<EntityCache>().save(resources.all(), oar); !ok_or_error.has_value())
+  writer.submit(entity_data_path, std::move(buffer));
+  if (auto ok_or_error = writer.flush(); !ok_or_error.has_value())
   {
-    SDE_LOG_ERROR() << "Failed to save entity data: " << ok_or_error.error();
+    SDE_LOG_ERROR() << "Failed to write entity data: " << ok_or_error.error();
     return false;
   }
   return true;
@@ -53,7 +66,7 @@ namespace
     return true;
   }
 
-  auto ifs_or_error = serial::file_istream::create(entity_data_path);
+  auto ifs_or_error = serial::mmap_istream::create(entity_data_path);
   if (!ifs_or_error.has_value())
   {
     SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(entity_data_path);
@@ -70,17 +83,19 @@ namespace
 }
 
 
-[[nodiscard]] bool save_resources(const GameResources& resources, const asset::path& resources_path)
+[[nodiscard]] bool
+save_resources(const GameResources& resources, AsyncFileWriter& writer, const asset::path& resources_path)
 {
   SDE_LOG_INFO() << "Saving:" << SDE_OSNV(resources_path);
-  if (auto ofs_or_error = serial::file_ostream::create(resources_path); ofs_or_error.has_value())
+  serial::mem_ostream buffer{writer.buffers()};
   {
-    OArchive oar{*ofs_or_error};
+    OArchive oar{buffer};
     oar << Field{"resources", resources};
   }
-  else
+  writer.submit(resources_path, std::move(buffer));
+  if (auto ok_or_error = writer.flush(); !ok_or_error.has_value())
   {
-    SDE_LOG_ERROR() << ofs_or_error.error() << " " << SDE_OSNV(resources_path);
+    SDE_LOG_ERROR() << "Failed to write resource data: " << ok_or_error.error();
     return false;
   }
   return true;
@@ -90,7 +105,7 @@ namespace
 [[nodiscard]] bool load_resources(GameResources& resources, const asset::path& resources_path)
 {
   SDE_LOG_INFO() << "Loading:" << SDE_OSNV(resources_path);
-  if (auto ifs_or_error = serial::file_istream::create(resources_path); ifs_or_error.has_value())
+  if (auto ifs_or_error = serial::mmap_istream::create(resources_path); ifs_or_error.has_value())
   {
     IArchive iar{*ifs_or_error};
     iar >> Field{"resources", resources};
@@ -114,6 +129,12 @@ namespace
   return true;
 }
 
+[[nodiscard]] asset::path
+script_archive_path(const GameResources& resources, const asset::path& script_data_path, SceneHandle scene)
+{
+  return script_data_path / sde::format("%s.scripts.bin", resources.get<SceneCache>()(scene)->name.c_str());
+}
+
 [[nodiscard]] bool load_components(GameResources& resources, const nlohmann::json& components_json)
 {
   for (const auto& [component_key_json, component_lib_path_json] : components_json.items())
@@ -228,6 +249,13 @@ namespace
               resources.find_or_create<NativeScriptInstanceCache>(script_name, script_name, script.handle);
             instance_or_error.has_value())
         {
+          if (node_json.contains("budget_ms"))
+          {
+            resources.scriptTimings().setBudget(
+              instance_or_error->handle,
+              {.limit = Seconds(static_cast<float>(node_json["budget_ms"]) * 1e-3F),
+               .deferrable = node_json.value("deferrable", false)});
+          }
           resources.get<SceneCache>().update_if_exists(
             scene_name, [script_handle = instance_or_error->handle](auto& scene) {
               scene.nodes.push_back({.script = script_handle});
@@ -266,6 +294,7 @@ std::ostream& operator<<(std::ostream& os, GameError error)
     SDE_OS_ENUM_CASE(GameError::kMissingManifest)
     SDE_OS_ENUM_CASE(GameError::kEntityLoadError)
     SDE_OS_ENUM_CASE(GameError::kEntitySaveError)
+    SDE_OS_ENUM_CASE(GameError::kAssetPackLoadError)
   }
   return os;
 }
@@ -280,18 +309,26 @@ bool Game::setActiveScene(SceneHandle next_scene, const AppProperties& app_prope
   // Get handle to script instances
   auto& scripts = resources_.get<NativeScriptInstanceCache>();
 
-  // Save previous scene data
+  // Save previous scene data, gathering records for all instances listed by a scene into a single archive
+  sde::vector<std::pair<SceneHandle, ScriptArchiveWriter>> archive_writers;
   for (const auto& node : active_scene_sequence_)
   {
-    if (auto ok_or_error = scripts.save(node.handle, config_.script_data_path); ok_or_error.has_value())
+    auto archive_itr = std::find_if(
+      std::begin(archive_writers), std::end(archive_writers), [&node](const auto& a) { return a.first == node.scene; });
+    if (archive_itr == std::end(archive_writers))
     {
-      SDE_LOG_DEBUG() << "Saved data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name) << " to "
-                      << SDE_OSNV(config_.script_data_path);
+      archive_writers.emplace_back(node.scene, ScriptArchiveWriter{writer_->buffers()});
+      archive_itr = std::prev(std::end(archive_writers));
+    }
+
+    if (auto ok_or_error = scripts.save(node.handle, archive_itr->second); ok_or_error.has_value())
+    {
+      SDE_LOG_DEBUG() << "Saved data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name);
     }
     else
     {
-      SDE_LOG_ERROR() << "Saving data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name) << " to "
-                      << SDE_OSNV(config_.script_data_path) << " failed with error: " << ok_or_error.error();
+      SDE_LOG_ERROR() << "Saving data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name)
+                      << " failed with error: " << ok_or_error.error();
     }
 
     if (node.instance.shutdown(resources_, app_properties))
@@ -304,6 +341,21 @@ bool Game::setActiveScene(SceneHandle next_scene, const AppProperties& app_prope
     }
   }
 
+  for (auto& [scene, archive_writer] : archive_writers)
+  {
+    const auto archive_path = script_archive_path(resources_, config_.script_data_path, scene);
+    if (auto buffer_or_error = std::move(archive_writer).finish(); buffer_or_error.has_value())
+    {
+      SDE_LOG_DEBUG() << "Saving script data for " << SDE_OSNV(scene) << " to " << SDE_OSNV(archive_path);
+      writer_->submit(archive_path, std::move(buffer_or_error).value());
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "Saving script data for " << SDE_OSNV(scene) << " to " << SDE_OSNV(archive_path)
+                      << " failed with error: " << buffer_or_error.error();
+    }
+  }
+
   // Change scene sequence
   if (auto sequence_or_error = resources_.get<SceneCache>().expand(next_scene, resources_.all());
       sequence_or_error.has_value())
@@ -311,6 +363,14 @@ bool Game::setActiveScene(SceneHandle next_scene, const AppProperties& app_prope
     SDE_LOG_DEBUG() << "Scene change from: " << SDE_OSNV(active_scene_) << " --> " << SDE_OSNV(next_scene);
     active_scene_ = next_scene;
     active_scene_sequence_ = std::move(sequence_or_error).value();
+    active_scene_profile_names_.clear();
+    active_scene_schedule_.clear();
+    for (const auto& node : active_scene_sequence_)
+    {
+      active_scene_profile_names_.emplace_back(node.name);
+      active_scene_schedule_.add(node.name, ScriptAccess::parse(node.instance.reads(), node.instance.writes()));
+      resources_.scriptTimings().add(node.handle, node.name);
+    }
   }
   else
   {
@@ -319,23 +379,52 @@ bool Game::setActiveScene(SceneHandle next_scene, const AppProperties& app_prope
     return false;
   }
 
-  // Load current scene data
+  // Load current scene data, opening the archive for each scene once
+  sde::vector<std::pair<SceneHandle, std::optional<ScriptArchive>>> archives;
   for (const auto& node : active_scene_sequence_)
   {
-    if (auto ok_or_error = scripts.load(node.handle, config_.script_data_path); ok_or_error.has_value())
+    auto archive_itr = std::find_if(
+      std::begin(archives), std::end(archives), [&node](const auto& a) { return a.first == node.scene; });
+    if (archive_itr == std::end(archives))
     {
-      SDE_LOG_DEBUG() << "Loaded data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name) << " from "
-                      << SDE_OSNV(config_.script_data_path);
+      const auto archive_path = script_archive_path(resources_, config_.script_data_path, node.scene);
+
+      // Make sure previously saved data has been written
+      writer_->wait(archive_path);
+
+      if (auto archive_or_error = ScriptArchive::open(archive_path); archive_or_error.has_value())
+      {
+        archives.emplace_back(node.scene, std::move(archive_or_error).value());
+      }
+      else if (archive_or_error.error() == ScriptArchiveError::kFileDoesNotExist)
+      {
+        archives.emplace_back(node.scene, std::nullopt);
+      }
+      else
+      {
+        SDE_LOG_ERROR() << "Loading script data for " << SDE_OSNV(node.scene) << " from " << SDE_OSNV(archive_path)
+                        << " failed with error: " << archive_or_error.error();
+        archives.emplace_back(node.scene, std::nullopt);
+      }
+      archive_itr = std::prev(std::end(archives));
+    }
+
+    if (!archive_itr->second.has_value())
+    {
+      SDE_LOG_WARN() << "No previous save for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name);
+    }
+    else if (auto ok_or_error = scripts.load(node.handle, *archive_itr->second); ok_or_error.has_value())
+    {
+      SDE_LOG_DEBUG() << "Loaded data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name);
     }
     else if (ok_or_error.error() == NativeScriptInstanceError::kInstanceDataUnavailable)
     {
-      SDE_LOG_WARN() << "No previous save for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name) << " in "
-                     << SDE_OSNV(config_.script_data_path);
+      SDE_LOG_WARN() << "No previous save for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name);
     }
     else
     {
-      SDE_LOG_ERROR() << "Loading data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name) << " from "
-                      << SDE_OSNV(config_.script_data_path) << " failed with error: " << ok_or_error.error();
+      SDE_LOG_ERROR() << "Loading data for " << SDE_OSNV(node.handle) << " : " << SDE_OSNV(node.name)
+                      << " failed with error: " << ok_or_error.error();
     }
   }
 
@@ -344,32 +433,41 @@ bool Game::setActiveScene(SceneHandle next_scene, const AppProperties& app_prope
 
 void Game::spin(App& app)
 {
-  // Set initial window icon
-  if (auto image_or_error = resources_.get<graphics::ImageCache>().find_or_create(
-        config_.window_icon_path, resources_.all(), config_.window_icon_path);
-      image_or_error.has_value())
+  if (app.headless())
   {
-    app.window().setWindowIcon(image_or_error->value->ref());
-    SDE_LOG_INFO() << "Set window icon: " << SDE_OSNV(config_.window_icon_path);
+    SDE_LOG_INFO() << "Running headless";
   }
   else
   {
-    SDE_LOG_ERROR() << "Set window icon: " << SDE_OSNV(config_.window_icon_path)
-                    << " failed with : " << image_or_error.error();
-  }
+    // Set initial window icon
+    if (auto image_or_error = resources_.get<graphics::ImageCache>().find_or_create(
+          config_.window_icon_path, resources_.all(), config_.window_icon_path);
+        image_or_error.has_value())
+    {
+      app.window().setWindowIcon(image_or_error->value->ref());
+      SDE_LOG_INFO() << "Set window icon: " << SDE_OSNV(config_.window_icon_path);
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "Set window icon: " << SDE_OSNV(config_.window_icon_path)
+                      << " failed with : " << image_or_error.error();
+    }
 
-  // Set initial cursor icon
-  if (auto image_or_error = resources_.get<graphics::ImageCache>().find_or_create(
-        config_.cursor_icon_path, resources_.all(), config_.cursor_icon_path);
-      image_or_error.has_value())
-  {
-    app.window().setCursorIcon(image_or_error->value->ref());
-    SDE_LOG_INFO() << "Set cursor icon: " << SDE_OSNV(config_.cursor_icon_path);
-  }
-  else
-  {
-    SDE_LOG_ERROR() << "Set cursor icon: " << SDE_OSNV(config_.cursor_icon_path)
-                    << " failed with : " << image_or_error.error();
+    // Set initial cursor icon
+    if (auto image_or_error = resources_.get<graphics::ImageCache>().find_or_create(
+          config_.cursor_icon_path, resources_.all(), config_.cursor_icon_path);
+        image_or_error.has_value())
+    {
+      app.window().setCursorIcon(image_or_error->value->ref());
+      SDE_LOG_INFO() << "Set cursor icon: " << SDE_OSNV(config_.cursor_icon_path);
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "Set cursor icon: " << SDE_OSNV(config_.cursor_icon_path)
+                      << " failed with : " << image_or_error.error();
+    }
+
+    app.window().setSwapInterval(config_.swap_interval);
   }
 
   // Run the game, starting from root scene
@@ -380,7 +478,7 @@ void Game::spin(App& app)
         return AppDirective::kClose;
       }
 
-      for (const auto& [script_name, script_handle, script_instance] : active_scene_sequence_)
+      for (const auto& [script_name, script_handle, script_instance, script_scene] : active_scene_sequence_)
       {
         if (!script_instance.initialize(script_handle, script_name, resources_, app_properties))
         {
@@ -392,13 +490,24 @@ void Game::spin(App& app)
       return AppDirective::kContinue;
     },
     [this](const auto& app_properties) {
-      for (const auto& [script_name, script_handle, script_instance] : active_scene_sequence_)
-      {
-        if (!script_instance.update(resources_, app_properties))
+      SDE_PROFILE_SCOPE("Game::update");
+      jobs_->runMainJobs();
+      const bool ok = scheduler_->run(active_scene_schedule_, [this, &app_properties](std::size_t i) {
+        const auto& [script_name, script_handle, script_instance, script_scene] = active_scene_sequence_[i];
+        SDE_PROFILE_SCOPE(active_scene_profile_names_[i].c_str());
+        const auto update = [&instance = script_instance, this, &app_properties] {
+          return instance.update(resources_, app_properties);
+        };
+        if (resources_.scriptTimings().run(script_handle, script_name, update))
         {
-          SDE_LOG_ERROR() << SDE_OSNV(script_name) << SDE_OSNV(script_handle) << " failed to update";
-          return AppDirective::kClose;
+          return true;
         }
+        SDE_LOG_ERROR() << SDE_OSNV(script_name) << SDE_OSNV(script_handle) << " failed to update";
+        return false;
+      });
+      if (!ok)
+      {
+        return AppDirective::kClose;
       }
       return (active_scene_ == resources_.getNextScene()) ? AppDirective::kContinue : AppDirective::kReset;
     },
@@ -408,7 +517,8 @@ void Game::spin(App& app)
         SDE_LOG_WARN() << "Some scene data may have been lost!";
       }
     },
-    config_.rate);
+    config_.rate,
+    {.step = config_.simulation_rate.period(), .max_steps = config_.max_simulation_steps});
 }
 
 
@@ -448,18 +558,72 @@ expected<Game, GameError> Game::create(const asset::path& path)
 
   // Load basic game configutation
   GameConfig config;
+  float rate_hz = 0.F;
+  std::optional<float> simulation_rate_hz;
   SDE_ASSERT_NO_EXCEPT(
     {
       auto config_json = manifest_json["config"];
-      config.rate = Rate::fromHertz(static_cast<float>(config_json["rate"]));
+      rate_hz = static_cast<float>(config_json["rate"]);
+      if (config_json.contains("simulation_rate"))
+      {
+        simulation_rate_hz = static_cast<float>(config_json["simulation_rate"]);
+      }
+      config.max_simulation_steps = config_json.value("max_simulation_steps", config.max_simulation_steps);
+      config.swap_interval = config_json.value("swap_interval", config.swap_interval);
       config.assets_data_path = resources.path(asset::path{config_json["assets_data_path"]});
       config.entity_data_path = resources.path(asset::path{config_json["entity_data_path"]});
       config.script_data_path = resources.path(asset::path{config_json["script_data_path"]});
       config.window_icon_path = resources.path(asset::path{config_json["window_icon_path"]});
       config.cursor_icon_path = resources.path(asset::path{config_json["cursor_icon_path"]});
+      if (config_json.contains("asset_pack_path"))
+      {
+        config.asset_pack_path = resources.path(asset::path{config_json["asset_pack_path"]});
+      }
+      if (config_json.contains("cooked_assets_path"))
+      {
+        config.cooked_assets_path = resources.path(asset::path{config_json["cooked_assets_path"]});
+      }
+      config.job_workers = config_json.value("job_workers", std::size_t{0});
+      config.script_race_detection = config_json.value("script_race_detection", false);
     },
     std::exception);
 
+  // Rates are given in hertz; a rate of zero would have an infinite period
+  if ((rate_hz <= 0.F) or (simulation_rate_hz.value_or(1.F) <= 0.F) or (config.max_simulation_steps == 0))
+  {
+    SDE_LOG_ERROR() << "Invalid game configuration: " << SDE_OSNV(rate_hz) << " "
+                    << SDE_OSNV(simulation_rate_hz.value_or(0.F)) << " " << SDE_OSNV(config.max_simulation_steps)
+                    << " (rates and steps must be positive)";
+    return make_unexpected(GameError::kInvalidManifest);
+  }
+  config.rate = Rate::fromHertz(rate_hz);
+  if (simulation_rate_hz.has_value())
+  {
+    config.simulation_rate = Rate::fromHertz(*simulation_rate_hz);
+  }
+
+  // Read packed game assets in place of loose asset files
+  std::shared_ptr<AssetFileSystem> file_system;
+  if (!config.asset_pack_path.empty())
+  {
+    auto pack_or_error = AssetPack::open(config.asset_pack_path);
+    if (!pack_or_error.has_value())
+    {
+      SDE_LOG_ERROR() << "failed to open asset pack: " << SDE_OSNV(config.asset_pack_path) << " ("
+                      << pack_or_error.error() << ')';
+      return make_unexpected(GameError::kAssetPackLoadError);
+    }
+    file_system = std::make_shared<AssetFileSystem>();
+    file_system->mount(std::make_shared<const AssetPack>(std::move(pack_or_error).value()), resources.root_path());
+    resources.setFileSystem(file_system);
+  }
+
+  // Use assets which were decoded ahead of time, when available
+  if (!config.cooked_assets_path.empty())
+  {
+    resources.setCookedAssets(std::make_shared<const CookedAssetStore>(config.cooked_assets_path, file_system));
+  }
+
   // Load game assets
   SDE_ASSERT_NO_EXCEPT(
     {
@@ -537,6 +701,17 @@ expected<Game, GameError> Game::create(const asset::path& path)
     game.resources_ = std::move(resources);
     game.active_scene_ = SceneHandle::null();
     game.active_scene_sequence_.clear();
+    game.active_scene_profile_names_.clear();
+    game.active_scene_schedule_.clear();
+    game.writer_ = std::make_unique<AsyncFileWriter>();
+    game.jobs_ = std::make_unique<jobs::JobSystem>(game.config_.job_workers);
+    game.scheduler_ = std::make_unique<ScriptScheduler>(*game.jobs_);
+    if (game.config_.script_race_detection)
+    {
+      game.scheduler_->setRaceDetection(true);
+      game.resources_.get<Registry>().setAccessObserver(game.scheduler_.get());
+      game.resources_.setAccessObserver(game.scheduler_.get());
+    }
   }
   return {std::move(game)};
 }
@@ -546,14 +721,20 @@ expected<void, GameError> Game::dump()
   // Resolve directory for script data
   const auto scripts_directory = resources_.directory(config_.script_data_path);
 
+  // Finish earlier writes (e.g. script data saved on scene change), so that their errors are not reported below
+  if (auto ok_or_error = writer_->flush(); !ok_or_error.has_value())
+  {
+    SDE_LOG_WARN() << "Earlier write failed with error: " << ok_or_error.error();
+  }
+
   // Save game entities
   SDE_LOG_INFO() << "Saving entity data...";
   SDE_ASSERT_NO_EXCEPT(
     {
-      if (!save_entities(resources_, config_.entity_data_path))
+      if (!save_entities(resources_, *writer_, config_.entity_data_path))
       {
-        SDE_LOG_ERROR() << "failed to load components";
-        return make_unexpected(GameError::kEntityLoadError);
+        SDE_LOG_ERROR() << "failed to save entities";
+        return make_unexpected(GameError::kEntitySaveError);
       }
     },
     std::exception);
@@ -562,7 +743,7 @@ expected<void, GameError> Game::dump()
   SDE_LOG_INFO() << "Saving resource data...";
   SDE_ASSERT_NO_EXCEPT(
     {
-      if (!save_resources(resources_, config_.assets_data_path))
+      if (!save_resources(resources_, *writer_, config_.assets_data_path))
       {
         SDE_LOG_ERROR() << "failed to save resources";
         return make_unexpected(GameError::kResourceSaveError);
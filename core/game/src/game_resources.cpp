@@ -30,6 +30,21 @@ asset::path GameResources::path(const asset::path& original_path) const
   return directory(original_path.parent_path()) / original_path.filename();
 }
 
+void GameResources::setFileSystem(std::shared_ptr<const AssetFileSystem> file_system)
+{
+  this->get<audio::SoundDataCache>().set_file_system(file_system);
+  this->get<graphics::ImageCache>().set_file_system(file_system);
+  this->get<graphics::FontCache>().set_file_system(file_system);
+  this->get<graphics::ShaderCache>().set_file_system(std::move(file_system));
+}
+
+void GameResources::setCookedAssets(std::shared_ptr<const CookedAssetStore> cooked_assets)
+{
+  this->get<audio::SoundDataCache>().set_cooked_assets(cooked_assets);
+  this->get<graphics::ImageCache>().set_cooked_assets(cooked_assets);
+  this->get<graphics::TypeSetCache>().set_cooked_assets(std::move(cooked_assets));
+}
+
 bool GameResources::setNextScene(const SceneHandle scene)
 {
   if (this->get<SceneCache>().exists(scene))
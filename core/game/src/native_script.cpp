@@ -31,7 +31,7 @@ NativeScriptHandle NativeScriptCache::to_handle(const LibraryHandle& library) co
 }
 
 
-NativeScriptHandle NativeScriptCache::to_handle(const sde::string& name) const
+NativeScriptHandle NativeScriptCache::to_handle(std::string_view name) const
 {
   const auto itr = name_to_native_script_lookup_.find(name);
   if (itr == std::end(name_to_native_script_lookup_))
@@ -2,7 +2,6 @@
 #include <ostream>
 
 // SDE
-#include "sde/format.hpp"
 #include "sde/game/native_script.hpp"
 #include "sde/game/native_script_header.hpp"
 #include "sde/game/native_script_instance.hpp"
@@ -11,16 +10,6 @@
 
 namespace sde::game
 {
-namespace
-{
-
-asset::path
-getPath(const NativeScriptInstanceHandle handle, const sde::string& name, const NativeScriptInstance& instance)
-{
-  return {sde::format("%s_%lu_%s_%lu.bin", name.c_str(), handle.id(), instance.type().data(), instance.version())};
-}
-
-}  // namespace
 
 std::ostream& operator<<(std::ostream& os, NativeScriptInstanceError error)
 {
@@ -167,7 +156,7 @@ bool NativeScriptInstance::save(OArchive& oar) const
   return methods_.on_save(data_, reinterpret_cast<void*>(&oar));
 }
 
-NativeScriptInstanceHandle NativeScriptInstanceCache::to_handle(const sde::string& name) const
+NativeScriptInstanceHandle NativeScriptInstanceCache::to_handle(std::string_view name) const
 {
   const auto itr = name_to_instance_lookup_.find(name);
   if (itr == std::end(name_to_instance_lookup_))
@@ -195,7 +184,7 @@ void NativeScriptInstanceCache::when_removed(
 }
 
 expected<void, NativeScriptInstanceError>
-NativeScriptInstanceCache::load(NativeScriptInstanceHandle handle, const asset::path& script_data_path)
+NativeScriptInstanceCache::load(NativeScriptInstanceHandle handle, ScriptArchive& archive)
 {
   // Get script data by handle
   auto itr = handle_to_value_cache_.find(handle);
@@ -204,35 +193,33 @@ NativeScriptInstanceCache::load(NativeScriptInstanceHandle handle, const asset::
     return make_unexpected(NativeScriptInstanceError::kInvalidHandle);
   }
 
-  auto& script = itr->second.value;
+  const auto& script = itr->second.value;
 
-  const asset::path path = script_data_path / getPath(handle, script.name, script.instance);
-
-  // Stop here if path does not exist
-  if (!asset::exists(path))
+  // Load data for this instance, skipping records saved by another script type or version
+  if (auto ok_or_error = archive.load(
+        script.name,
+        script.instance.type(),
+        script.instance.version(),
+        [&script](IArchive& iar) { return script.instance.load(iar); });
+      ok_or_error.has_value())
   {
-    return make_unexpected(NativeScriptInstanceError::kInstanceDataUnavailable);
+    return {};
   }
-
-  // Open script instance data file
-  auto ifs_or_error = serial::file_istream::create(path);
-  if (!ifs_or_error.has_value())
+  else if (
+    (ok_or_error.error() == ScriptArchiveError::kRecordMissing) or
+    (ok_or_error.error() == ScriptArchiveError::kRecordOutdated))
   {
-    SDE_LOG_ERROR() << SDE_OSNV(path) << " " << ifs_or_error.error();
-    return make_unexpected(NativeScriptInstanceError::kInstanceLoadFailed);
+    return make_unexpected(NativeScriptInstanceError::kInstanceDataUnavailable);
   }
-
-  // Load data for this instance
-  if (IArchive iar{*ifs_or_error}; !script.instance.load(iar))
+  else
   {
+    SDE_LOG_ERROR() << SDE_OSNV(script.name) << " " << ok_or_error.error();
     return make_unexpected(NativeScriptInstanceError::kInstanceLoadFailed);
   }
-
-  return {};
 }
 
 expected<void, NativeScriptInstanceError>
-NativeScriptInstanceCache::save(NativeScriptInstanceHandle handle, const asset::path& script_data_path) const
+NativeScriptInstanceCache::save(NativeScriptInstanceHandle handle, ScriptArchiveWriter& archive) const
 {
   // Get script data by handle
   auto itr = handle_to_value_cache_.find(handle);
@@ -241,21 +228,17 @@ NativeScriptInstanceCache::save(NativeScriptInstanceHandle handle, const asset::
     return make_unexpected(NativeScriptInstanceError::kInvalidHandle);
   }
 
-  auto& script = itr->second.value;
-
-  const asset::path path = script_data_path / getPath(handle, script.name, script.instance);
-
-  // Open script instance data file
-  auto ofs_or_error = serial::file_ostream::create(path);
-  if (!ofs_or_error.has_value())
-  {
-    SDE_LOG_ERROR() << SDE_OSNV(path) << " " << ofs_or_error.error();
-    return make_unexpected(NativeScriptInstanceError::kInstanceSaveFailed);
-  }
+  const auto& script = itr->second.value;
 
-  // Load data for this instance
-  if (OArchive oar{*ofs_or_error}; !script.instance.save(oar))
+  // Save data for this instance
+  if (auto ok_or_error = archive.add(
+        script.name,
+        script.instance.type(),
+        script.instance.version(),
+        [&script](OArchive& oar) { return script.instance.save(oar); });
+      !ok_or_error.has_value())
   {
+    SDE_LOG_ERROR() << SDE_OSNV(script.name) << " " << ok_or_error.error();
     return make_unexpected(NativeScriptInstanceError::kInstanceSaveFailed);
   }
 
@@ -34,7 +34,8 @@ expected<void, SceneError> expand_recursive(
       SDE_LOG_INFO() << SDE_OSNV(root) << " --> " << SDE_OSNV(script_handle);
       if (auto script = deps(script_handle))
       {
-        sequence.push_back({.name = script->name, .handle = script_handle, .instance = script->instance});
+        sequence.push_back(
+          {.name = script->name, .handle = script_handle, .instance = script->instance, .scene = root});
       }
       else
       {
@@ -67,7 +68,7 @@ std::ostream& operator<<(std::ostream& os, SceneError error)
   return os;
 }
 
-SceneHandle SceneCache::to_handle(const sde::string& name) const
+SceneHandle SceneCache::to_handle(std::string_view name) const
 {
   const auto itr = name_to_scene_lookup_.find(name);
   if (itr == std::end(name_to_scene_lookup_))
@@ -0,0 +1,129 @@
+// C++ Standard Library
+#include <algorithm>
+#include <ostream>
+#include <utility>
+
+// SDE
+#include "sde/game/script_archive.hpp"
+#include "sde/hash.hpp"
+#include "sde/logging.hpp"
+
+namespace sde::game
+{
+
+std::ostream& operator<<(std::ostream& os, ScriptArchiveError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kFileDoesNotExist)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kInvalidFooter)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kInvalidIndex)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kDuplicateRecord)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kRecordMissing)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kRecordOutdated)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kRecordSaveFailed)
+    SDE_OS_ENUM_CASE(ScriptArchiveError::kRecordLoadFailed)
+  }
+  return os;
+}
+
+std::uint64_t ScriptArchiveNameHash(std::string_view name) { return ComputeBytesHashValue(name); }
+
+expected<serial::mem_ostream, ScriptArchiveError> ScriptArchiveWriter::finish() &&
+{
+  std::sort(std::begin(index_), std::end(index_));
+  if (const auto itr = std::adjacent_find(
+        std::begin(index_),
+        std::end(index_),
+        [](const auto& lhs, const auto& rhs) { return lhs.name_hash == rhs.name_hash; });
+      itr != std::end(index_))
+  {
+    return make_unexpected(ScriptArchiveError::kDuplicateRecord);
+  }
+
+  const ScriptArchiveFooter footer{.entry_count = index_.size(), .index_offset = buffer_.size()};
+
+  OArchive oar{buffer_};
+  for (const auto& entry : index_)
+  {
+    oar << serial::named{"entry", entry};
+  }
+  oar << serial::named{"footer", footer};
+  return std::move(buffer_);
+}
+
+ScriptArchive::ScriptArchive(serial::mmap_istream&& stream, sde::vector<ScriptArchiveEntry>&& index) :
+    stream_{std::move(stream)}, index_{std::move(index)}
+{}
+
+std::optional<ScriptArchiveEntry> ScriptArchive::find(std::string_view name) const
+{
+  const ScriptArchiveEntry target{.name_hash = ScriptArchiveNameHash(name)};
+  const auto itr = std::lower_bound(std::begin(index_), std::end(index_), target);
+  if ((itr == std::end(index_)) or (itr->name_hash != target.name_hash))
+  {
+    return std::nullopt;
+  }
+  return *itr;
+}
+
+expected<ScriptArchive, ScriptArchiveError> ScriptArchive::open(const asset::path& path)
+{
+  auto ifs_or_error = serial::mmap_istream::create(path);
+  if (!ifs_or_error.has_value())
+  {
+    if (ifs_or_error.error() == serial::FileStreamError::kFileDoesNotExist)
+    {
+      return make_unexpected(ScriptArchiveError::kFileDoesNotExist);
+    }
+    SDE_LOG_ERROR() << ifs_or_error.error() << " " << SDE_OSNV(path);
+    return make_unexpected(ScriptArchiveError::kFileOpenFailed);
+  }
+
+  auto& stream = *ifs_or_error;
+  const std::size_t file_size = stream.available();
+  if (file_size < sizeof(ScriptArchiveFooter))
+  {
+    return make_unexpected(ScriptArchiveError::kInvalidFooter);
+  }
+
+  const std::size_t footer_offset = file_size - sizeof(ScriptArchiveFooter);
+  ScriptArchiveFooter footer{.magic = 0};
+  IArchive iar{stream};
+  if (!stream.seek(footer_offset))
+  {
+    return make_unexpected(ScriptArchiveError::kInvalidFooter);
+  }
+  iar >> serial::named{"footer", footer};
+  if (footer.magic != ScriptArchiveFooter::kMagic)
+  {
+    return make_unexpected(ScriptArchiveError::kInvalidFooter);
+  }
+  else if (
+    (footer.index_offset > footer_offset) or
+    ((footer_offset - footer.index_offset) != (footer.entry_count * sizeof(ScriptArchiveEntry))) or
+    !stream.seek(footer.index_offset))
+  {
+    return make_unexpected(ScriptArchiveError::kInvalidIndex);
+  }
+
+  sde::vector<ScriptArchiveEntry> index;
+  index.resize(footer.entry_count);
+  for (auto& entry : index)
+  {
+    iar >> serial::named{"entry", entry};
+    if ((entry.offset > footer.index_offset) or (entry.length > (footer.index_offset - entry.offset)))
+    {
+      return make_unexpected(ScriptArchiveError::kInvalidIndex);
+    }
+  }
+
+  if (!std::is_sorted(std::begin(index), std::end(index)))
+  {
+    return make_unexpected(ScriptArchiveError::kInvalidIndex);
+  }
+  return ScriptArchive{std::move(stream), std::move(index)};
+}
+
+}  // namespace sde::game
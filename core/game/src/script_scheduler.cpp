@@ -0,0 +1,182 @@
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+// SDE
+#include "sde/game/script_scheduler.hpp"
+#include "sde/logging.hpp"
+
+namespace sde::game
+{
+namespace
+{
+
+/// Script updating on this thread, if any
+thread_local const ScriptSchedule::Node* running_script = nullptr;
+
+/// Returns true if \p lhs and \p rhs name the same resource, or one names a component of the other
+bool overlaps(std::string_view lhs, std::string_view rhs)
+{
+  if (lhs.size() > rhs.size())
+  {
+    std::swap(lhs, rhs);
+  }
+  return rhs.starts_with(lhs) and ((lhs.size() == rhs.size()) or (rhs[lhs.size()] == '/'));
+}
+
+bool overlaps(const sde::vector<sde::string>& lhs, const sde::vector<sde::string>& rhs)
+{
+  return std::any_of(lhs.begin(), lhs.end(), [&rhs](const auto& l) {
+    return std::any_of(rhs.begin(), rhs.end(), [&l](const auto& r) { return overlaps(l, r); });
+  });
+}
+
+/**
+ * @brief Returns true if \p declared covers access to \p label
+ *
+ *        Declaring a cache covers its components. Declaring a component covers the cache which holds it, since the
+ *        cache must be fetched to reach the component; the component access itself is then checked on its own.
+ */
+bool covers(const sde::vector<sde::string>& declared, std::string_view label)
+{
+  return std::any_of(declared.begin(), declared.end(), [label](std::string_view d) { return overlaps(d, label); });
+}
+
+sde::vector<sde::string> split(const char* list)
+{
+  sde::vector<sde::string> entries;
+  if (list == nullptr)
+  {
+    return entries;
+  }
+  std::string_view remaining{list};
+  while (!remaining.empty())
+  {
+    const auto end = std::min(remaining.find(','), remaining.size());
+    auto entry = remaining.substr(0, end);
+    remaining.remove_prefix(std::min(end + 1, remaining.size()));
+    while (!entry.empty() and (entry.front() == ' '))
+    {
+      entry.remove_prefix(1);
+    }
+    while (!entry.empty() and (entry.back() == ' '))
+    {
+      entry.remove_suffix(1);
+    }
+    if (!entry.empty())
+    {
+      entries.emplace_back(entry);
+    }
+  }
+  return entries;
+}
+
+}  // namespace
+
+ScriptAccess ScriptAccess::parse(const char* reads, const char* writes)
+{
+  return {.reads = split(reads), .writes = split(writes), .exclusive = (reads == nullptr) and (writes == nullptr)};
+}
+
+bool ScriptAccess::conflicts(const ScriptAccess& other) const
+{
+  if (exclusive or other.exclusive)
+  {
+    return true;
+  }
+  return overlaps(writes, other.writes) or overlaps(writes, other.reads) or overlaps(reads, other.writes);
+}
+
+bool ScriptAccess::permits(std::string_view label, bool write) const
+{
+  return exclusive or covers(writes, label) or (!write and covers(reads, label));
+}
+
+std::size_t ScriptSchedule::add(std::string_view name, ScriptAccess access)
+{
+  const std::size_t index = nodes_.size();
+  std::size_t dependencies = 0;
+  for (auto& node : nodes_)
+  {
+    if (node.access.conflicts(access))
+    {
+      node.successors.push_back(index);
+      ++dependencies;
+    }
+  }
+  nodes_.push_back(
+    {.name = sde::string{name}, .access = std::move(access), .successors = {}, .dependencies = dependencies});
+  return index;
+}
+
+bool ScriptScheduler::run(const ScriptSchedule& schedule, const std::function<bool(std::size_t)>& update)
+{
+  if (jobs_->workers() == 0)
+  {
+    for (std::size_t i = 0; i < schedule.size(); ++i)
+    {
+      running_script = &schedule[i];
+      const bool ok = update(i);
+      running_script = nullptr;
+      if (!ok)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Each script waits on a counter of its unfinished dependencies, which it releases for its successors once updated
+  auto remaining = std::make_unique<jobs::Counter[]>(schedule.size());
+  for (std::size_t i = 0; i < schedule.size(); ++i)
+  {
+    remaining[i].add(schedule[i].dependencies);
+  }
+
+  jobs::Counter finished;
+  std::atomic<bool> failed = false;
+  for (std::size_t i = 0; i < schedule.size(); ++i)
+  {
+    const auto execute = [this, &schedule, &update, &remaining, &failed, i] {
+      if (!failed.load(std::memory_order_acquire))
+      {
+        running_script = &schedule[i];
+        const bool ok = update(i);
+        running_script = nullptr;
+        if (!ok)
+        {
+          failed.store(true, std::memory_order_release);
+        }
+      }
+      for (const std::size_t successor : schedule[i].successors)
+      {
+        jobs_->signal(remaining[successor]);
+      }
+    };
+    jobs_->submit(
+      execute,
+      {.signal = &finished,
+       .after = &remaining[i],
+       .affinity = schedule[i].access.exclusive ? jobs::Affinity::kMain : jobs::Affinity::kAny});
+  }
+  jobs_->wait(finished);
+
+  return !failed.load();
+}
+
+void ScriptScheduler::onAccess(std::string_view label, bool write)
+{
+  const auto* script = running_script;
+  if (!race_detection_ or (script == nullptr) or script->access.permits(label, write))
+  {
+    return;
+  }
+  races_.fetch_add(1, std::memory_order_relaxed);
+  SDE_LOG_ERROR_RATE_LIMITED(std::chrono::seconds{1})
+    << SDE_OSNV(script->name) << (write ? " wrote " : " read ") << SDE_OSNV(label) << " without declaring it";
+}
+
+}  // namespace sde::game
@@ -0,0 +1,97 @@
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+// SDE
+#include "sde/game/script_timing.hpp"
+#include "sde/logging.hpp"
+#include "sde/time_ostream.hpp"
+
+namespace sde::game
+{
+
+void ScriptTiming::record(TimeOffset duration)
+{
+  durations_[count_ % durations_.size()] = duration;
+  ++count_;
+}
+
+ScriptTimingStats ScriptTiming::stats() const
+{
+  ScriptTimingStats stats{.overruns = overruns_, .deferrals = deferrals_};
+  if (count_ == 0)
+  {
+    return stats;
+  }
+
+  std::array<TimeOffset, kScriptTimingWindow> window;
+  const std::size_t n = std::min(count_, durations_.size());
+  std::copy_n(std::begin(durations_), n, std::begin(window));
+
+  stats.last = durations_[(count_ - 1) % durations_.size()];
+  stats.mean = std::accumulate(std::begin(window), std::begin(window) + n, TimeOffset::zero()) / n;
+  stats.max = *std::max_element(std::begin(window), std::begin(window) + n);
+  stats.samples = n;
+
+  // Nearest-rank percentile
+  const std::size_t p99_rank = (99 * n + 99) / 100;
+  std::nth_element(std::begin(window), std::begin(window) + (p99_rank - 1), std::begin(window) + n);
+  stats.p99 = window[p99_rank - 1];
+  return stats;
+}
+
+void ScriptTimings::setBudget(NativeScriptInstanceHandle handle, const ScriptBudget& budget)
+{
+  timings_[handle].budget_ = budget;
+}
+
+std::optional<ScriptTimingStats> ScriptTimings::stats(NativeScriptInstanceHandle handle) const
+{
+  if (const auto itr = timings_.find(handle); itr != timings_.end())
+  {
+    return itr->second.stats();
+  }
+  return std::nullopt;
+}
+
+void ScriptTimings::reset()
+{
+  for (auto& [handle, timing] : timings_)
+  {
+    const ScriptBudget budget = timing.budget_;
+    timing = ScriptTiming{std::move(timing.name_)};
+    timing.budget_ = budget;
+  }
+}
+
+ScriptTiming& ScriptTimings::get(NativeScriptInstanceHandle handle, std::string_view name)
+{
+  auto itr = timings_.find(handle);
+  if (itr == timings_.end())
+  {
+    itr = timings_.emplace(handle, ScriptTiming{sde::string{name}}).first;
+  }
+  else if (itr->second.name_.empty())
+  {
+    itr->second.name_ = name;
+  }
+  return itr->second;
+}
+
+void ScriptTimings::finish(ScriptTiming& timing, TimeOffset duration)
+{
+  timing.record(duration);
+  if ((timing.budget_.limit == TimeOffset::zero()) or (duration <= timing.budget_.limit))
+  {
+    return;
+  }
+
+  ++timing.overruns_;
+  timing.deferred_ = timing.budget_.deferrable;
+  SDE_LOG_WARN_RATE_LIMITED(std::chrono::seconds{1})
+    << SDE_OSNV(timing.name_) << " update took " << duration << " (budget: " << timing.budget_.limit << ')'
+    << (timing.deferred_ ? ", deferring next update" : "");
+}
+
+}  // namespace sde::game
@@ -0,0 +1,306 @@
+// C++ Standard Library
+#include <cstdio>
+#include <string_view>
+#include <utility>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "component_benchmark.hpp"
+#include "sde/async_file_writer.hpp"
+#include "sde/game/archive.hpp"
+#include "sde/game/game_resources.hpp"
+#include "sde/serialization.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+namespace
+{
+
+constexpr std::string_view kComponentLibraryPath{"_solib_k8/libcore_Sgame_Stest_Slibcomponent_Ubenchmark.so"};
+
+constexpr std::string_view kComponentNames[] = {
+  "BenchmarkComponent0",
+  "BenchmarkComponent1",
+  "BenchmarkComponent2",
+  "BenchmarkComponent3",
+  "BenchmarkComponent4",
+  "BenchmarkComponent5",
+  "BenchmarkComponent6",
+  "BenchmarkComponent7",
+};
+
+bool LoadComponents(GameResources& resources)
+{
+  for (const auto name : kComponentNames)
+  {
+    const sde::string component_name{name};
+    if (!resources.create<ComponentCache>(component_name, asset::path{kComponentLibraryPath}).has_value())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr const char* kSnapshotPath = "EntityBenchmark.snapshot.bin";
+
+/// Number of entities saved and loaded per snapshot
+constexpr std::size_t kSnapshotEntityCount = 100'000;
+
+bool CreateSnapshotEntities(GameResources& resources)
+{
+  for (std::size_t i = 0; i < kSnapshotEntityCount; ++i)
+  {
+    EntityHandle entity;
+    auto entity_or_error = resources.instance(entity, [i](EntityCreator& creator) {
+      creator.attach<BenchmarkComponent0>(static_cast<float>(i));
+      creator.attach<BenchmarkComponent1>(static_cast<float>(i) * 2.F);
+      creator.attach<BenchmarkComponent2>(static_cast<float>(i) * 3.F);
+    });
+    if (!entity_or_error.has_value())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ClearSnapshotComponents(GameResources& resources)
+{
+  auto& registry = resources.get<Registry>();
+  registry.storage<BenchmarkComponent0>().clear();
+  registry.storage<BenchmarkComponent1>().clear();
+  registry.storage<BenchmarkComponent2>().clear();
+}
+
+/**
+ * @brief Saves entities one entity and component at a time (previous snapshot layout)
+ */
+void SavePerEntity(const GameResources& resources, OArchive& oar)
+{
+  const auto& registry = resources.get<Registry>();
+  const auto& components = resources.get<ComponentCache>();
+  const auto& entities = resources.get<EntityCache>();
+  oar << serial::named{"size", entities.size()};
+  for (const auto& [handle, entity] : entities)
+  {
+    oar << serial::named{"handle", handle};
+    for (const auto& component_handle : entity->components)
+    {
+      components(component_handle)->io.save(oar, entity->id, registry);
+    }
+  }
+}
+
+/**
+ * @brief Loads entities saved with SavePerEntity
+ */
+void LoadPerEntity(GameResources& resources, IArchive& iar)
+{
+  auto& registry = resources.get<Registry>();
+  const auto& components = resources.get<ComponentCache>();
+  const auto& entities = resources.get<EntityCache>();
+  std::size_t size = 0;
+  iar >> serial::named{"size", size};
+  for (std::size_t n = 0; n < size; ++n)
+  {
+    EntityHandle handle;
+    iar >> serial::named{"handle", handle};
+    const auto entity = entities(handle);
+    for (const auto& component_handle : entity->components)
+    {
+      components(component_handle)->io.load(iar, entity->id, registry);
+    }
+  }
+}
+
+template <typename SaveT> void SnapshotSave(benchmark::State& state, SaveT save)
+{
+  GameResources resources;
+  if (!LoadComponents(resources) or !CreateSnapshotEntities(resources))
+  {
+    state.SkipWithError("failed to create entities");
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    serial::mem_ostream buffer;
+    OArchive oar{buffer};
+    save(resources, oar);
+    benchmark::DoNotOptimize(AsyncFileWriter::write(kSnapshotPath, buffer.data(), buffer.size()));
+  }
+  state.SetItemsProcessed(state.iterations() * kSnapshotEntityCount);
+  std::remove(kSnapshotPath);
+}
+
+/**
+ * @brief Measures cost on the calling thread when snapshots are written in the background
+ */
+template <typename SaveT> void SnapshotSubmit(benchmark::State& state, SaveT save)
+{
+  GameResources resources;
+  if (!LoadComponents(resources) or !CreateSnapshotEntities(resources))
+  {
+    state.SkipWithError("failed to create entities");
+    return;
+  }
+
+  AsyncFileWriter writer;
+  for (auto _ : state)
+  {
+    serial::mem_ostream buffer;
+    OArchive oar{buffer};
+    save(resources, oar);
+    writer.submit(kSnapshotPath, std::move(buffer));
+
+    state.PauseTiming();
+    writer.wait(kSnapshotPath);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * kSnapshotEntityCount);
+  std::remove(kSnapshotPath);
+}
+
+template <typename SaveT, typename LoadT> void SnapshotLoad(benchmark::State& state, SaveT save, LoadT load)
+{
+  GameResources resources;
+  if (!LoadComponents(resources) or !CreateSnapshotEntities(resources))
+  {
+    state.SkipWithError("failed to create entities");
+    return;
+  }
+
+  {
+    serial::mem_ostream buffer;
+    OArchive oar{buffer};
+    save(resources, oar);
+    if (!AsyncFileWriter::write(kSnapshotPath, buffer.data(), buffer.size()).has_value())
+    {
+      state.SkipWithError("failed to write snapshot");
+      return;
+    }
+  }
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    ClearSnapshotComponents(resources);
+    state.ResumeTiming();
+
+    auto ifs_or_error = serial::mmap_istream::create(kSnapshotPath);
+    IArchive iar{*ifs_or_error};
+    load(resources, iar);
+  }
+  state.SetItemsProcessed(state.iterations() * kSnapshotEntityCount);
+  std::remove(kSnapshotPath);
+}
+
+void SaveColumnar(GameResources& resources, OArchive& oar)
+{
+  benchmark::DoNotOptimize(resources.get<EntityCache>().save(resources.all(), oar));
+}
+
+void LoadColumnar(GameResources& resources, IArchive& iar)
+{
+  benchmark::DoNotOptimize(resources.get<EntityCache>().load(resources.all(), iar));
+}
+
+}  // namespace
+
+static void BM_ComponentLookupString(benchmark::State& state)
+{
+  GameResources resources;
+  if (!LoadComponents(resources))
+  {
+    state.SkipWithError("failed to load components");
+    return;
+  }
+
+  const auto& components = resources.get<ComponentCache>();
+  for (auto _ : state)
+  {
+    for (const auto name : kComponentNames)
+    {
+      // Previous behavior: build a temporary sde::string key for every lookup
+      benchmark::DoNotOptimize(components.to_handle(sde::string{name}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * std::size(kComponentNames));
+}
+BENCHMARK(BM_ComponentLookupString);
+
+static void BM_ComponentLookupStringView(benchmark::State& state)
+{
+  GameResources resources;
+  if (!LoadComponents(resources))
+  {
+    state.SkipWithError("failed to load components");
+    return;
+  }
+
+  const auto& components = resources.get<ComponentCache>();
+  for (auto _ : state)
+  {
+    for (const auto name : kComponentNames)
+    {
+      benchmark::DoNotOptimize(components.to_handle(name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * std::size(kComponentNames));
+}
+BENCHMARK(BM_ComponentLookupStringView);
+
+static void BM_EntityInstanceWithComponents(benchmark::State& state)
+{
+  GameResources resources;
+  if (!LoadComponents(resources))
+  {
+    state.SkipWithError("failed to load components");
+    return;
+  }
+
+  for (auto _ : state)
+  {
+    EntityHandle entity;
+    auto entity_or_error = resources.instance(entity, [](EntityCreator& creator) {
+      creator.attach<BenchmarkComponent0>();
+      creator.attach<BenchmarkComponent1>();
+      creator.attach<BenchmarkComponent2>();
+      creator.attach<BenchmarkComponent3>();
+      creator.attach<BenchmarkComponent4>();
+      creator.attach<BenchmarkComponent5>();
+      creator.attach<BenchmarkComponent6>();
+      creator.attach<BenchmarkComponent7>();
+    });
+    if (!entity_or_error.has_value())
+    {
+      state.SkipWithError("failed to create entity");
+      return;
+    }
+    resources.remove(entity_or_error->handle);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EntityInstanceWithComponents);
+
+static void BM_EntitySnapshotSavePerEntity(benchmark::State& state) { SnapshotSave(state, SavePerEntity); }
+BENCHMARK(BM_EntitySnapshotSavePerEntity)->Unit(benchmark::kMillisecond);
+
+static void BM_EntitySnapshotSaveColumnar(benchmark::State& state) { SnapshotSave(state, SaveColumnar); }
+BENCHMARK(BM_EntitySnapshotSaveColumnar)->Unit(benchmark::kMillisecond);
+
+static void BM_EntitySnapshotSubmitColumnar(benchmark::State& state) { SnapshotSubmit(state, SaveColumnar); }
+BENCHMARK(BM_EntitySnapshotSubmitColumnar)->Unit(benchmark::kMillisecond);
+
+static void BM_EntitySnapshotLoadPerEntity(benchmark::State& state)
+{
+  SnapshotLoad(state, SavePerEntity, LoadPerEntity);
+}
+BENCHMARK(BM_EntitySnapshotLoadPerEntity)->Unit(benchmark::kMillisecond);
+
+static void BM_EntitySnapshotLoadColumnar(benchmark::State& state) { SnapshotLoad(state, SaveColumnar, LoadColumnar); }
+BENCHMARK(BM_EntitySnapshotLoadColumnar)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,39 @@
+#pragma once
+
+// C++ Standard Library
+#include <type_traits>
+
+// SDE
+#include "sde/game/component_decl.hpp"
+#include "sde/serial/object.hpp"
+
+template <int I> struct BenchmarkComponent
+{
+  float value = 0.F;
+};
+
+namespace sde::serial
+{
+
+template <typename ArchiveT, int I> struct is_trivially_serializable<ArchiveT, BenchmarkComponent<I>> : std::true_type
+{};
+
+}  // namespace sde::serial
+
+using BenchmarkComponent0 = BenchmarkComponent<0>;
+using BenchmarkComponent1 = BenchmarkComponent<1>;
+using BenchmarkComponent2 = BenchmarkComponent<2>;
+using BenchmarkComponent3 = BenchmarkComponent<3>;
+using BenchmarkComponent4 = BenchmarkComponent<4>;
+using BenchmarkComponent5 = BenchmarkComponent<5>;
+using BenchmarkComponent6 = BenchmarkComponent<6>;
+using BenchmarkComponent7 = BenchmarkComponent<7>;
+
+SDE_COMPONENT_RENAME(BenchmarkComponent0, "BenchmarkComponent0");
+SDE_COMPONENT_RENAME(BenchmarkComponent1, "BenchmarkComponent1");
+SDE_COMPONENT_RENAME(BenchmarkComponent2, "BenchmarkComponent2");
+SDE_COMPONENT_RENAME(BenchmarkComponent3, "BenchmarkComponent3");
+SDE_COMPONENT_RENAME(BenchmarkComponent4, "BenchmarkComponent4");
+SDE_COMPONENT_RENAME(BenchmarkComponent5, "BenchmarkComponent5");
+SDE_COMPONENT_RENAME(BenchmarkComponent6, "BenchmarkComponent6");
+SDE_COMPONENT_RENAME(BenchmarkComponent7, "BenchmarkComponent7");
@@ -0,0 +1,122 @@
+// C++ Standard Library
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/async_file_writer.hpp"
+#include "sde/game/script_archive.hpp"
+#include "sde/serialization_binary_file.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+namespace
+{
+
+constexpr const char* kScriptDataPath = "ScriptArchiveBenchmark.data";
+
+/// Number of script instances saved and loaded per scene switch
+constexpr std::size_t kScriptInstanceCount = 1'000;
+
+/// Stand-in for per-instance script data
+struct ScriptState
+{
+  script_id_t uid = 0;
+  script_version_t version = 1;
+  std::array<float, 64> values = {};
+};
+
+std::string InstanceName(std::size_t i) { return "instance_" + std::to_string(i); }
+
+bool SaveState(OArchive& oar, const ScriptState& state)
+{
+  oar << serial::named{"uid", state.uid};
+  oar << serial::named{"version", state.version};
+  oar << serial::make_packet(state.values.data(), state.values.size());
+  return true;
+}
+
+bool LoadState(IArchive& iar, ScriptState& state)
+{
+  iar >> serial::named{"uid", state.uid};
+  iar >> serial::named{"version", state.version};
+  iar >> serial::make_packet(state.values.data(), state.values.size());
+  return true;
+}
+
+/**
+ * @brief Saves then loads all instances one file per instance (previous script data layout)
+ */
+void SwitchPerInstanceFiles(std::array<ScriptState, kScriptInstanceCount>& states)
+{
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    serial::mem_ostream buffer;
+    OArchive oar{buffer};
+    SaveState(oar, states[i]);
+    const auto path = asset::path{kScriptDataPath} / (InstanceName(i) + ".bin");
+    benchmark::DoNotOptimize(AsyncFileWriter::write(path, buffer.data(), buffer.size()));
+  }
+
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    const auto path = asset::path{kScriptDataPath} / (InstanceName(i) + ".bin");
+    auto ifs_or_error = serial::file_istream::create(
+      path, serial::file_istream::default_flags, serial::file_istream::default_block_size);
+    IArchive iar{*ifs_or_error};
+    LoadState(iar, states[i]);
+  }
+}
+
+/**
+ * @brief Saves then loads all instances through a single script archive
+ */
+void SwitchScriptArchive(std::array<ScriptState, kScriptInstanceCount>& states)
+{
+  const auto path = asset::path{kScriptDataPath} / "scene.scripts.bin";
+
+  ScriptArchiveWriter writer;
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    benchmark::DoNotOptimize(writer.add(
+      InstanceName(i), "ScriptState", states[i].version, [&state = states[i]](OArchive& oar) {
+        return SaveState(oar, state);
+      }));
+  }
+  auto buffer_or_error = std::move(writer).finish();
+  benchmark::DoNotOptimize(AsyncFileWriter::write(path, buffer_or_error->data(), buffer_or_error->size()));
+
+  auto archive_or_error = ScriptArchive::open(path);
+  for (std::size_t i = 0; i < states.size(); ++i)
+  {
+    benchmark::DoNotOptimize(archive_or_error->load(
+      InstanceName(i), "ScriptState", states[i].version, [&state = states[i]](IArchive& iar) {
+        return LoadState(iar, state);
+      }));
+  }
+}
+
+template <typename SwitchT> void SceneSwitch(benchmark::State& state, SwitchT scene_switch)
+{
+  std::filesystem::create_directories(kScriptDataPath);
+  std::array<ScriptState, kScriptInstanceCount> states;
+  for (auto _ : state)
+  {
+    scene_switch(states);
+  }
+  state.SetItemsProcessed(state.iterations() * kScriptInstanceCount);
+  std::filesystem::remove_all(kScriptDataPath);
+}
+
+}  // namespace
+
+static void BM_SceneSwitchPerInstanceFiles(benchmark::State& state) { SceneSwitch(state, SwitchPerInstanceFiles); }
+BENCHMARK(BM_SceneSwitchPerInstanceFiles)->Unit(benchmark::kMillisecond);
+
+static void BM_SceneSwitchScriptArchive(benchmark::State& state) { SceneSwitch(state, SwitchScriptArchive); }
+BENCHMARK(BM_SceneSwitchScriptArchive)->Unit(benchmark::kMillisecond);
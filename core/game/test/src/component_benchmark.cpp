@@ -0,0 +1,11 @@
+#include "component_benchmark.hpp"
+#include "sde/game/component_runtime.hpp"
+
+SDE_COMPONENT__REGISTER(BenchmarkComponent0, BenchmarkComponent0);
+SDE_COMPONENT__REGISTER(BenchmarkComponent1, BenchmarkComponent1);
+SDE_COMPONENT__REGISTER(BenchmarkComponent2, BenchmarkComponent2);
+SDE_COMPONENT__REGISTER(BenchmarkComponent3, BenchmarkComponent3);
+SDE_COMPONENT__REGISTER(BenchmarkComponent4, BenchmarkComponent4);
+SDE_COMPONENT__REGISTER(BenchmarkComponent5, BenchmarkComponent5);
+SDE_COMPONENT__REGISTER(BenchmarkComponent6, BenchmarkComponent6);
+SDE_COMPONENT__REGISTER(BenchmarkComponent7, BenchmarkComponent7);
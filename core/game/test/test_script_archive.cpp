@@ -0,0 +1,169 @@
+// C++ Standard Library
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/async_file_writer.hpp"
+#include "sde/game/script_archive.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+namespace
+{
+
+constexpr const char* kArchivePath = "ScriptArchiveTest.scripts.bin";
+
+auto SaveValue(std::int32_t value)
+{
+  return [value](OArchive& oar) {
+    oar << serial::named{"value", value};
+    return true;
+  };
+}
+
+auto LoadValue(std::int32_t& value)
+{
+  return [&value](IArchive& iar) {
+    iar >> serial::named{"value", value};
+    return true;
+  };
+}
+
+void WriteArchive(ScriptArchiveWriter&& writer)
+{
+  auto buffer_or_error = std::move(writer).finish();
+  ASSERT_TRUE(buffer_or_error.has_value());
+  ASSERT_TRUE(AsyncFileWriter::write(kArchivePath, buffer_or_error->data(), buffer_or_error->size()).has_value());
+}
+
+}  // namespace
+
+class ScriptArchiveTest : public ::testing::Test
+{
+protected:
+  void TearDown() override { std::remove(kArchivePath); }
+};
+
+TEST_F(ScriptArchiveTest, WriteThenLoad)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  ASSERT_TRUE(writer.add("player-2", "PlayerCharacter", 1, SaveValue(20)).has_value());
+  ASSERT_TRUE(writer.add("Physics", "Physics", 3, SaveValue(30)).has_value());
+  ASSERT_EQ(writer.size(), 3UL);
+  WriteArchive(std::move(writer));
+
+  auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_TRUE(archive_or_error.has_value());
+  ASSERT_EQ(archive_or_error->entries().size(), 3UL);
+
+  // Records are loaded in any order
+  std::int32_t value = 0;
+  ASSERT_TRUE(archive_or_error->load("Physics", "Physics", 3, LoadValue(value)).has_value());
+  ASSERT_EQ(value, 30);
+  ASSERT_TRUE(archive_or_error->load("player-1", "PlayerCharacter", 1, LoadValue(value)).has_value());
+  ASSERT_EQ(value, 10);
+  ASSERT_TRUE(archive_or_error->load("player-2", "PlayerCharacter", 1, LoadValue(value)).has_value());
+  ASSERT_EQ(value, 20);
+}
+
+TEST_F(ScriptArchiveTest, MissingRecord)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  WriteArchive(std::move(writer));
+
+  auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_TRUE(archive_or_error.has_value());
+  ASSERT_FALSE(archive_or_error->find("player-2").has_value());
+
+  std::int32_t value = 0;
+  const auto ok_or_error = archive_or_error->load("player-2", "PlayerCharacter", 1, LoadValue(value));
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), ScriptArchiveError::kRecordMissing);
+}
+
+TEST_F(ScriptArchiveTest, OutdatedRecordNotRead)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  WriteArchive(std::move(writer));
+
+  auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_TRUE(archive_or_error.has_value());
+
+  bool record_read = false;
+  const auto load_record = [&record_read](IArchive& iar) {
+    record_read = true;
+    return true;
+  };
+
+  const auto version_or_error = archive_or_error->load("player-1", "PlayerCharacter", 2, load_record);
+  ASSERT_FALSE(version_or_error.has_value());
+  ASSERT_EQ(version_or_error.error(), ScriptArchiveError::kRecordOutdated);
+
+  const auto type_or_error = archive_or_error->load("player-1", "EnemyCharacter", 1, load_record);
+  ASSERT_FALSE(type_or_error.has_value());
+  ASSERT_EQ(type_or_error.error(), ScriptArchiveError::kRecordOutdated);
+
+  ASSERT_FALSE(record_read);
+}
+
+TEST_F(ScriptArchiveTest, RecordLengthMismatch)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  WriteArchive(std::move(writer));
+
+  auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_TRUE(archive_or_error.has_value());
+
+  const auto ok_or_error =
+    archive_or_error->load("player-1", "PlayerCharacter", 1, [](IArchive& iar) { return true; });
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), ScriptArchiveError::kRecordLoadFailed);
+}
+
+TEST_F(ScriptArchiveTest, DuplicateRecord)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(20)).has_value());
+  const auto buffer_or_error = std::move(writer).finish();
+  ASSERT_FALSE(buffer_or_error.has_value());
+  ASSERT_EQ(buffer_or_error.error(), ScriptArchiveError::kDuplicateRecord);
+}
+
+TEST_F(ScriptArchiveTest, SaveFailed)
+{
+  ScriptArchiveWriter writer;
+  const auto ok_or_error = writer.add("player-1", "PlayerCharacter", 1, [](OArchive& oar) { return false; });
+  ASSERT_FALSE(ok_or_error.has_value());
+  ASSERT_EQ(ok_or_error.error(), ScriptArchiveError::kRecordSaveFailed);
+  ASSERT_EQ(writer.size(), 0UL);
+}
+
+TEST_F(ScriptArchiveTest, FileDoesNotExist)
+{
+  const auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_FALSE(archive_or_error.has_value());
+  ASSERT_EQ(archive_or_error.error(), ScriptArchiveError::kFileDoesNotExist);
+}
+
+TEST_F(ScriptArchiveTest, Truncated)
+{
+  ScriptArchiveWriter writer;
+  ASSERT_TRUE(writer.add("player-1", "PlayerCharacter", 1, SaveValue(10)).has_value());
+  WriteArchive(std::move(writer));
+  std::filesystem::resize_file(kArchivePath, std::filesystem::file_size(kArchivePath) - 1);
+
+  const auto archive_or_error = ScriptArchive::open(kArchivePath);
+  ASSERT_FALSE(archive_or_error.has_value());
+  ASSERT_EQ(archive_or_error.error(), ScriptArchiveError::kInvalidFooter);
+}
@@ -0,0 +1,281 @@
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/game/registry.hpp"
+#include "sde/game/script_scheduler.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+struct Position
+{
+  float x = 0.F;
+};
+
+struct Dynamics
+{
+  float dx = 0.F;
+};
+
+namespace
+{
+
+/// Start and finish order of a single script update
+struct UpdateRecord
+{
+  std::size_t started = 0;
+  std::size_t finished = 0;
+  std::thread::id thread = {};
+};
+
+}  // namespace
+
+TEST(ScriptAccess, Parse)
+{
+  const auto access = ScriptAccess::parse("textures, registry/Position", "sounds");
+  ASSERT_FALSE(access.exclusive);
+  ASSERT_EQ(access.reads.size(), 2UL);
+  ASSERT_EQ(access.reads[0], "textures");
+  ASSERT_EQ(access.reads[1], "registry/Position");
+  ASSERT_EQ(access.writes.size(), 1UL);
+  ASSERT_EQ(access.writes[0], "sounds");
+}
+
+TEST(ScriptAccess, Undeclared)
+{
+  const auto access = ScriptAccess::parse(nullptr, nullptr);
+  ASSERT_TRUE(access.exclusive);
+  ASSERT_TRUE(access.conflicts(ScriptAccess::parse("", "")));
+  ASSERT_TRUE(ScriptAccess::parse("", "").conflicts(access));
+}
+
+TEST(ScriptAccess, Conflicts)
+{
+  const auto read_textures = ScriptAccess::parse("textures", nullptr);
+  const auto write_textures = ScriptAccess::parse(nullptr, "textures");
+  const auto write_sounds = ScriptAccess::parse(nullptr, "sounds");
+  ASSERT_FALSE(read_textures.conflicts(read_textures));
+  ASSERT_TRUE(read_textures.conflicts(write_textures));
+  ASSERT_TRUE(write_textures.conflicts(read_textures));
+  ASSERT_TRUE(write_textures.conflicts(write_textures));
+  ASSERT_FALSE(write_textures.conflicts(write_sounds));
+}
+
+TEST(ScriptAccess, ComponentConflicts)
+{
+  const auto write_position = ScriptAccess::parse("registry/Dynamics", "registry/Position");
+  const auto write_sprite = ScriptAccess::parse(nullptr, "registry/AnimatedSprite");
+  const auto read_position = ScriptAccess::parse("registry/Position", nullptr);
+  const auto write_registry = ScriptAccess::parse(nullptr, "registry");
+  ASSERT_FALSE(write_position.conflicts(write_sprite));
+  ASSERT_TRUE(write_position.conflicts(read_position));
+  ASSERT_TRUE(write_position.conflicts(write_registry));
+  ASSERT_TRUE(write_sprite.conflicts(write_registry));
+  ASSERT_FALSE(ScriptAccess::parse(nullptr, "registry/Pos").conflicts(write_position));
+}
+
+TEST(ScriptAccess, Permits)
+{
+  const auto access = ScriptAccess::parse("textures", "registry/Position");
+  ASSERT_TRUE(access.permits("textures", false));
+  ASSERT_FALSE(access.permits("textures", true));
+  ASSERT_TRUE(access.permits("registry", true));
+  ASSERT_TRUE(access.permits("registry", false));
+  ASSERT_TRUE(access.permits("registry/Position", true));
+  ASSERT_FALSE(access.permits("registry/Dynamics", false));
+  ASSERT_FALSE(access.permits("sounds", false));
+  ASSERT_TRUE(ScriptAccess::parse(nullptr, "registry").permits("registry/Dynamics", true));
+  ASSERT_TRUE(ScriptAccess::parse(nullptr, nullptr).permits("sounds", true));
+}
+
+TEST(ScriptSchedule, DependenciesFollowConflicts)
+{
+  ScriptSchedule schedule;
+  schedule.add("a", ScriptAccess::parse(nullptr, "registry/Position"));
+  schedule.add("b", ScriptAccess::parse(nullptr, "sounds"));
+  schedule.add("c", ScriptAccess::parse("registry/Position", nullptr));
+  schedule.add("d", ScriptAccess::parse(nullptr, nullptr));
+  schedule.add("e", ScriptAccess::parse("sounds", nullptr));
+
+  ASSERT_EQ(schedule[0].dependencies, 0UL);
+  ASSERT_EQ(schedule[1].dependencies, 0UL);
+  ASSERT_EQ(schedule[2].dependencies, 1UL);
+  ASSERT_EQ(schedule[3].dependencies, 3UL);
+  ASSERT_EQ(schedule[4].dependencies, 2UL);
+  ASSERT_EQ(schedule[0].successors, (sde::vector<std::size_t>{2, 3}));
+  ASSERT_EQ(schedule[1].successors, (sde::vector<std::size_t>{3, 4}));
+  ASSERT_EQ(schedule[2].successors, (sde::vector<std::size_t>{3}));
+  ASSERT_EQ(schedule[3].successors, (sde::vector<std::size_t>{4}));
+  ASSERT_TRUE(schedule[4].successors.empty());
+}
+
+class ScriptSchedulerTest : public ::testing::TestWithParam<std::size_t>
+{
+protected:
+  /// Runs all scripts in schedule_, recording the order in which they started and finished
+  bool Run(ScriptScheduler& scheduler, std::size_t fail_index = std::numeric_limits<std::size_t>::max())
+  {
+    records_.assign(schedule_.size(), {});
+    return scheduler.run(schedule_, [this, fail_index](std::size_t i) {
+      records_[i].started = ++order_;
+      records_[i].thread = std::this_thread::get_id();
+      std::this_thread::sleep_for(std::chrono::milliseconds{2});
+      records_[i].finished = ++order_;
+      return i != fail_index;
+    });
+  }
+
+  ScriptSchedule schedule_;
+  sde::vector<UpdateRecord> records_;
+  std::atomic<std::size_t> order_ = 0;
+};
+
+TEST_P(ScriptSchedulerTest, OrderFollowsConflicts)
+{
+  schedule_.add("physics", ScriptAccess::parse("registry/Dynamics", "registry/Position"));
+  schedule_.add("audio", ScriptAccess::parse(nullptr, "sounds"));
+  schedule_.add("animation", ScriptAccess::parse(nullptr, "registry/AnimatedSprite"));
+  schedule_.add("camera", ScriptAccess::parse("registry/Position", nullptr));
+  schedule_.add("ui", ScriptAccess::parse(nullptr, nullptr));
+  schedule_.add("weather", ScriptAccess::parse("textures", "registry/AnimatedSprite"));
+  schedule_.add("mixer", ScriptAccess::parse("sounds", nullptr));
+  schedule_.add("listener", ScriptAccess::parse("sounds", nullptr));
+
+  jobs::JobSystem jobs{GetParam()};
+  ScriptScheduler scheduler{jobs};
+  for (int repeat = 0; repeat < 10; ++repeat)
+  {
+    ASSERT_TRUE(Run(scheduler));
+    for (std::size_t i = 0; i < schedule_.size(); ++i)
+    {
+      ASSERT_GT(records_[i].started, 0UL) << schedule_[i].name;
+      for (std::size_t j = i + 1; j < schedule_.size(); ++j)
+      {
+        if (schedule_[i].access.conflicts(schedule_[j].access))
+        {
+          ASSERT_LT(records_[i].finished, records_[j].started) << schedule_[i].name << " -> " << schedule_[j].name;
+        }
+      }
+      if (schedule_[i].access.exclusive)
+      {
+        ASSERT_EQ(records_[i].thread, std::this_thread::get_id()) << schedule_[i].name;
+      }
+    }
+  }
+}
+
+TEST_P(ScriptSchedulerTest, FailureSkipsDependents)
+{
+  schedule_.add("a", ScriptAccess::parse(nullptr, "sounds"));
+  schedule_.add("b", ScriptAccess::parse("sounds", nullptr));
+  schedule_.add("c", ScriptAccess::parse(nullptr, nullptr));
+
+  jobs::JobSystem jobs{GetParam()};
+  ScriptScheduler scheduler{jobs};
+  ASSERT_FALSE(Run(scheduler, 0));
+  ASSERT_GT(records_[0].started, 0UL);
+  ASSERT_EQ(records_[1].started, 0UL);
+  ASSERT_EQ(records_[2].started, 0UL);
+}
+
+TEST_P(ScriptSchedulerTest, EmptySchedule)
+{
+  jobs::JobSystem jobs{GetParam()};
+  ScriptScheduler scheduler{jobs};
+  ASSERT_TRUE(Run(scheduler));
+}
+
+TEST_P(ScriptSchedulerTest, RaceDetection)
+{
+  schedule_.add("declared", ScriptAccess::parse("textures", "registry/Position"));
+  schedule_.add("exclusive", ScriptAccess::parse(nullptr, nullptr));
+
+  jobs::JobSystem jobs{GetParam()};
+  ScriptScheduler scheduler{jobs};
+  scheduler.setRaceDetection(true);
+
+  const auto access = [&scheduler](std::string_view label, bool write) {
+    return [&scheduler, label, write](std::size_t i) {
+      scheduler.onAccess(label, write);
+      return true;
+    };
+  };
+
+  ASSERT_TRUE(scheduler.run(schedule_, access("textures", false)));
+  ASSERT_TRUE(scheduler.run(schedule_, access("registry", true)));
+  ASSERT_EQ(scheduler.races(), 0UL);
+
+  // Undeclared by "declared"; exclusive scripts may access anything
+  ASSERT_TRUE(scheduler.run(schedule_, access("textures", true)));
+  ASSERT_EQ(scheduler.races(), 1UL);
+  ASSERT_TRUE(scheduler.run(schedule_, access("sounds", false)));
+  ASSERT_EQ(scheduler.races(), 2UL);
+
+  // Accesses outside of any update are not checked
+  scheduler.onAccess("sounds", true);
+  ASSERT_EQ(scheduler.races(), 2UL);
+
+  scheduler.setRaceDetection(false);
+  ASSERT_TRUE(scheduler.run(schedule_, access("sounds", false)));
+  ASSERT_EQ(scheduler.races(), 2UL);
+}
+
+INSTANTIATE_TEST_SUITE_P(Workers, ScriptSchedulerTest, ::testing::Values(0UL, 1UL, 4UL));
+
+TEST(ScriptScheduler, NonConflictingScriptsRunConcurrently)
+{
+  ScriptSchedule schedule;
+  schedule.add("a", ScriptAccess::parse(nullptr, "sounds"));
+  schedule.add("b", ScriptAccess::parse(nullptr, "textures"));
+
+  // Each script waits for the other to start, which is only possible if they update at the same time
+  std::atomic<std::size_t> started = 0;
+  jobs::JobSystem jobs{1};
+  ScriptScheduler scheduler{jobs};
+  ASSERT_TRUE(scheduler.run(schedule, [&started](std::size_t i) {
+    ++started;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while ((started.load() < 2) and (std::chrono::steady_clock::now() < deadline))
+    {
+      std::this_thread::yield();
+    }
+    return started.load() == 2;
+  }));
+}
+
+TEST(ScriptScheduler, RegistryComponentRaceDetection)
+{
+  ScriptSchedule schedule;
+  schedule.add("physics", ScriptAccess::parse("registry/Dynamics", "registry/Position"));
+
+  Registry registry;
+  const auto id = registry.create();
+  registry.emplace<Position>(id);
+  registry.emplace<Dynamics>(id);
+
+  jobs::JobSystem jobs{0};
+  ScriptScheduler scheduler{jobs};
+  scheduler.setRaceDetection(true);
+  registry.setAccessObserver(&scheduler);
+
+  // Declared: Position is written, and Dynamics is only read
+  ASSERT_TRUE(scheduler.run(schedule, [&registry](std::size_t i) {
+    registry.view<Position, const Dynamics>().each([](Position& p, const Dynamics& d) { p.x += d.dx; });
+    return true;
+  }));
+  ASSERT_EQ(scheduler.races(), 0UL);
+
+  // Undeclared: Dynamics is written
+  ASSERT_TRUE(scheduler.run(schedule, [&registry, id](std::size_t i) {
+    registry.get<Dynamics>(id).dx = 1.F;
+    return true;
+  }));
+  ASSERT_EQ(scheduler.races(), 1UL);
+}
@@ -0,0 +1,151 @@
+// C++ Standard Library
+#include <chrono>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/game/script_timing.hpp"
+
+using namespace sde;
+using namespace sde::game;
+using namespace std::chrono_literals;
+
+class ScriptTimingsTest : public ::testing::Test
+{
+protected:
+  /// Returns an update which advances the injected clock by \p duration
+  auto Update(TimeOffset duration, bool ok = true)
+  {
+    return [this, duration, ok] {
+      now_ += duration;
+      ++updates_;
+      return ok;
+    };
+  }
+
+  Clock::time_point now_ = {};
+  std::size_t updates_ = 0;
+  ScriptTimings timings_{[this] { return now_; }};
+  const NativeScriptInstanceHandle handle_{1};
+};
+
+TEST_F(ScriptTimingsTest, NoStatsBeforeRun) { ASSERT_FALSE(timings_.stats(handle_).has_value()); }
+
+TEST_F(ScriptTimingsTest, Stats)
+{
+  for (int i = 1; i <= 100; ++i)
+  {
+    ASSERT_TRUE(timings_.run(handle_, "script", Update(i * 1ms)));
+  }
+
+  const auto stats = timings_.stats(handle_);
+  ASSERT_TRUE(stats.has_value());
+  ASSERT_EQ(stats->samples, 100UL);
+  ASSERT_EQ(stats->last, 100ms);
+  ASSERT_EQ(stats->mean, 50500us);
+  ASSERT_EQ(stats->p99, 99ms);
+  ASSERT_EQ(stats->max, 100ms);
+  ASSERT_EQ(stats->overruns, 0UL);
+  ASSERT_EQ(stats->deferrals, 0UL);
+}
+
+TEST_F(ScriptTimingsTest, StatsOverMostRecentUpdates)
+{
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1s)));
+  for (std::size_t i = 0; i < kScriptTimingWindow; ++i)
+  {
+    ASSERT_TRUE(timings_.run(handle_, "script", Update(2ms)));
+  }
+
+  const auto stats = timings_.stats(handle_);
+  ASSERT_TRUE(stats.has_value());
+  ASSERT_EQ(stats->samples, kScriptTimingWindow);
+  ASSERT_EQ(stats->mean, 2ms);
+  ASSERT_EQ(stats->p99, 2ms);
+  ASSERT_EQ(stats->max, 2ms);
+}
+
+TEST_F(ScriptTimingsTest, UpdateFailureReturned)
+{
+  ASSERT_FALSE(timings_.run(handle_, "script", Update(1ms, false)));
+  ASSERT_EQ(updates_, 1UL);
+}
+
+TEST_F(ScriptTimingsTest, NoBudget)
+{
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1s)));
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1s)));
+  ASSERT_EQ(updates_, 2UL);
+  ASSERT_EQ(timings_.stats(handle_)->overruns, 0UL);
+}
+
+TEST_F(ScriptTimingsTest, OverBudgetNotDeferred)
+{
+  timings_.setBudget(handle_, {.limit = 2ms, .deferrable = false});
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(2ms)));
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1ms)));
+  ASSERT_EQ(updates_, 3UL);
+
+  const auto stats = timings_.stats(handle_);
+  ASSERT_EQ(stats->overruns, 1UL);
+  ASSERT_EQ(stats->deferrals, 0UL);
+}
+
+TEST_F(ScriptTimingsTest, OverBudgetDeferred)
+{
+  timings_.setBudget(handle_, {.limit = 2ms, .deferrable = true});
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  ASSERT_EQ(updates_, 1UL);
+
+  // Update following an overrun is skipped
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1ms)));
+  ASSERT_EQ(updates_, 1UL);
+
+  // Deferred script always runs after being skipped
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  ASSERT_EQ(updates_, 2UL);
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1ms)));
+  ASSERT_EQ(updates_, 2UL);
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(1ms)));
+  ASSERT_EQ(updates_, 3UL);
+
+  const auto stats = timings_.stats(handle_);
+  ASSERT_EQ(stats->samples, 3UL);
+  ASSERT_EQ(stats->overruns, 2UL);
+  ASSERT_EQ(stats->deferrals, 2UL);
+}
+
+TEST_F(ScriptTimingsTest, BudgetsAreIndependent)
+{
+  const NativeScriptInstanceHandle other_handle{2};
+  timings_.setBudget(handle_, {.limit = 2ms, .deferrable = true});
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  ASSERT_TRUE(timings_.run(other_handle, "other", Update(3ms)));
+  ASSERT_TRUE(timings_.run(other_handle, "other", Update(3ms)));
+  ASSERT_EQ(updates_, 3UL);
+  ASSERT_EQ(timings_.stats(other_handle)->overruns, 0UL);
+}
+
+TEST_F(ScriptTimingsTest, ResetKeepsBudget)
+{
+  timings_.setBudget(handle_, {.limit = 2ms, .deferrable = true});
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  timings_.reset();
+
+  // Pending deferral is cleared
+  ASSERT_TRUE(timings_.run(handle_, "script", Update(3ms)));
+  ASSERT_EQ(updates_, 2UL);
+
+  const auto stats = timings_.stats(handle_);
+  ASSERT_EQ(stats->samples, 1UL);
+  ASSERT_EQ(stats->overruns, 1UL);
+  ASSERT_EQ(stats->deferrals, 0UL);
+
+  for (const auto& [handle, timing] : timings_)
+  {
+    ASSERT_EQ(timing.name(), "script");
+    ASSERT_EQ(timing.budget().limit, 2ms);
+  }
+}
@@ -7,14 +7,17 @@
 
 // C++ Standard Library
 #include <iosfwd>
+#include <memory>
 
 // SDE
 #include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
 #include "sde/expected.hpp"
 #include "sde/graphics/font_fwd.hpp"
 #include "sde/graphics/font_handle.hpp"
 #include "sde/resource.hpp"
 #include "sde/resource_cache.hpp"
+#include "sde/resource_content.hpp"
 #include "sde/unique_resource.hpp"
 
 namespace sde::graphics
@@ -32,6 +35,9 @@ std::ostream& operator<<(std::ostream& os, FontError error);
 
 struct FontNativeDeleter
 {
+  /// Shared owner of native font face, if face is aliased between fonts with identical content
+  std::shared_ptr<void> shared = nullptr;
+
   void operator()(void* font) const;
 };
 
@@ -49,8 +55,27 @@ class FontCache : public ResourceCache<FontCache>
 {
   friend fundemental_type;
 
+public:
+  /**
+   * @brief Enables sharing of native font faces between fonts with identical file contents
+   */
+  void set_content_aliasing(bool enabled) { content_index_.enable(enabled); }
+
+  /**
+   * @brief Returns statistics about shared font faces
+   */
+  const ResourceContentStats& content_stats() const { return content_index_.stats(); }
+
+  /**
+   * @brief Reads font files through \p file_system instead of directly from disk
+   */
+  void set_file_system(std::shared_ptr<const AssetFileSystem> file_system) { file_system_ = std::move(file_system); }
+
 private:
-  static expected<void, FontError> reload(dependencies deps, Font& font);
+  ResourceContentIndex<> content_index_;
+  std::shared_ptr<const AssetFileSystem> file_system_;
+
+  expected<void, FontError> reload(dependencies deps, Font& font);
   static expected<void, FontError> unload(dependencies deps, Font& font);
   expected<Font, FontError> generate(dependencies deps, const asset::path& font_path);
 };
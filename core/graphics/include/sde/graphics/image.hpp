@@ -8,9 +8,12 @@
 // C++ Standard Library
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
 
 // SDE
 #include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
+#include "sde/cooked_asset.hpp"
 #include "sde/expected.hpp"
 #include "sde/geometry.hpp"
 #include "sde/graphics/image_fwd.hpp"
@@ -19,6 +22,7 @@
 #include "sde/graphics/typecode.hpp"
 #include "sde/resource.hpp"
 #include "sde/resource_cache.hpp"
+#include "sde/resource_content.hpp"
 #include "sde/unique_resource.hpp"
 #include "sde/unordered_map.hpp"
 #include "sde/view.hpp"
@@ -110,12 +114,16 @@ enum class ImageError
   kAssetInvalid,
   kImageNotFound,
   kUnsupportedBitDepth,
+  kAssetCookFailed,
 };
 
 std::ostream& operator<<(std::ostream& os, ImageError error);
 
 struct ImageDataBufferDeleter
 {
+  /// Shared owner of image data, if data is aliased between images with identical content
+  std::shared_ptr<void> shared = nullptr;
+
   void operator()(void* data) const;
 };
 
@@ -183,10 +191,48 @@ public:
   using fundemental_type::to_handle;
   ImageHandle to_handle(const asset::path& path) const;
 
+  /**
+   * @brief Enables sharing of decoded image data between images with identical file contents and load options
+   */
+  void set_content_aliasing(bool enabled) { content_index_.enable(enabled); }
+
+  /**
+   * @brief Returns statistics about shared image data
+   */
+  const ResourceContentStats& content_stats() const { return content_index_.stats(); }
+
+  /**
+   * @brief Reads image files through \p file_system instead of directly from disk
+   */
+  void set_file_system(std::shared_ptr<const AssetFileSystem> file_system) { file_system_ = std::move(file_system); }
+
+  /**
+   * @brief Uses image data which was decoded ahead of time from \p cooked_assets , when available
+   */
+  void set_cooked_assets(std::shared_ptr<const CookedAssetStore> cooked_assets)
+  {
+    cooked_assets_ = std::move(cooked_assets);
+  }
+
+  /**
+   * @brief Decodes image at \p image_path with \p options and writes it to \p cooked_assets
+   */
+  static expected<void, ImageError>
+  cook(const CookedAssetStore& cooked_assets, const asset::path& image_path, const ImageOptions& options = {});
+
 private:
+  struct ImageContentInfo
+  {
+    ImageChannels channels;
+    ImageShape shape;
+  };
+
   sde::unordered_map<asset::path, ImageHandle> path_to_image_handle_;
+  ResourceContentIndex<ImageContentInfo> content_index_;
+  std::shared_ptr<const AssetFileSystem> file_system_;
+  std::shared_ptr<const CookedAssetStore> cooked_assets_;
 
-  static expected<void, ImageError> reload(dependencies deps, Image& image);
+  expected<void, ImageError> reload(dependencies deps, Image& image);
   static expected<void, ImageError> unload(dependencies deps, Image& image);
 
   expected<Image, ImageError>
@@ -5,18 +5,24 @@
  */
 #pragma once
 
+// C++ Standard Library
+#include <memory_resource>
+#include <vector>
+
 // SDE
 #include "sde/graphics/shapes.hpp"
-#include "sde/vector.hpp"
+#include "sde/memory.hpp"
 
 namespace sde::graphics
 {
 
 struct RenderBuffer
 {
-  sde::vector<Circle> circles;
-  sde::vector<Quad> quads;
-  sde::vector<TexturedQuad> textured_quads;
+  template <typename T> using buffer_type = std::vector<T, tagged_allocator<T, MemoryTag::kGraphics>>;
+
+  buffer_type<Circle> circles;
+  buffer_type<Quad> quads;
+  buffer_type<TexturedQuad> textured_quads;
 
   void reset()
   {
@@ -24,6 +30,25 @@ struct RenderBuffer
     quads.clear();
     textured_quads.clear();
   }
+
+  /**
+   * @brief Clears all buffers and draws future buffer memory from \p resource
+   *
+   * @param resource  memory resource for buffers; default graphics memory resource if nullptr
+   *
+   * @warning if \p resource is reset every frame (e.g. AppProperties::frame_arena) then this must be called at the
+   *          start of every frame, before any buffer is filled
+   */
+  void reset(std::pmr::memory_resource* resource)
+  {
+    if (resource == nullptr)
+    {
+      resource = memory_resource(MemoryTag::kGraphics);
+    }
+    circles = buffer_type<Circle>{tagged_allocator<Circle, MemoryTag::kGraphics>{resource}};
+    quads = buffer_type<Quad>{tagged_allocator<Quad, MemoryTag::kGraphics>{resource}};
+    textured_quads = buffer_type<TexturedQuad>{tagged_allocator<TexturedQuad, MemoryTag::kGraphics>{resource}};
+  }
 };
 
 }  // namespace sde::graphics
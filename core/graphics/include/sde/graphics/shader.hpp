@@ -8,12 +8,14 @@
 // C++ Standard Library
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 
 // SDE
 #include "sde/asset.hpp"
+#include "sde/asset_file_system.hpp"
 #include "sde/expected.hpp"
 #include "sde/graphics/shader_fwd.hpp"
 #include "sde/graphics/shader_handle.hpp"
@@ -133,8 +135,16 @@ class ShaderCache : public ResourceCache<ShaderCache>
 {
   friend fundemental_type;
 
+public:
+  /**
+   * @brief Reads shader sources through \p file_system instead of directly from disk
+   */
+  void set_file_system(std::shared_ptr<const AssetFileSystem> file_system) { file_system_ = std::move(file_system); }
+
 private:
-  static expected<void, ShaderError> reload(dependencies deps, Shader& shader);
+  std::shared_ptr<const AssetFileSystem> file_system_;
+
+  expected<void, ShaderError> reload(dependencies deps, Shader& shader);
   static expected<void, ShaderError> unload(dependencies deps, Shader& shader);
 
   expected<Shader, ShaderError> generate(dependencies deps, const asset::path& path);
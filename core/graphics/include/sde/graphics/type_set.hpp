@@ -7,9 +7,11 @@
 
 // C++ Standard Library
 #include <iosfwd>
+#include <memory>
 
 // SDE
 #include "sde/asset.hpp"
+#include "sde/cooked_asset.hpp"
 #include "sde/expected.hpp"
 #include "sde/geometry.hpp"
 #include "sde/graphics/font_fwd.hpp"
@@ -71,6 +73,7 @@ enum class TypeSetError
   kGlyphDataMissing,
   kGlyphRenderingFailure,
   kGlyphAtlasTextureCreationFailed,
+  kAssetCookFailed,
 };
 
 std::ostream& operator<<(std::ostream& os, TypeSetError error);
@@ -79,7 +82,24 @@ class TypeSetCache : public ResourceCache<TypeSetCache>
 {
   friend fundemental_type;
 
+public:
+  /**
+   * @brief Uses glyph atlases baked ahead of time from \p cooked_assets , when available
+   */
+  void set_cooked_assets(std::shared_ptr<const CookedAssetStore> cooked_assets)
+  {
+    cooked_assets_ = std::move(cooked_assets);
+  }
+
+  /**
+   * @brief Bakes glyph atlas and metrics for \p font at \p options and writes them to \p cooked_assets
+   */
+  static expected<void, TypeSetError>
+  cook(const CookedAssetStore& cooked_assets, const Font& font, const TypeSetOptions& options = {});
+
 private:
+  std::shared_ptr<const CookedAssetStore> cooked_assets_;
+
   expected<void, TypeSetError> reload(dependencies deps, TypeSet& type_set);
   expected<void, TypeSetError> unload(dependencies deps, TypeSet& type_set);
   expected<TypeSet, TypeSetError> generate(dependencies deps, FontHandle font, const TypeSetOptions& options = {});
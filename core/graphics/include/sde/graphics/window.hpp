@@ -22,6 +22,8 @@ struct WindowOptions
 {
   const char* title = "sde";
   Vec2i initial_size = {640, 480};
+  /// Number of display refreshes to wait between buffer swaps; 0 disables VSync (see Window::setSwapInterval)
+  int swap_interval = 1;
 };
 
 enum class WindowError
@@ -58,6 +60,14 @@ public:
 
   expected<void, WindowError> setCursorIcon(ImageRef icon) const;
 
+  /**
+   * @brief Sets the number of display refreshes to wait between buffer swaps
+   *
+   *        0 swaps immediately (no VSync), 1 swaps once per refresh, and -1 allows late swaps to happen immediately
+   *        where the driver supports adaptive VSync. Activates this window's context.
+   */
+  void setSwapInterval(int interval) const;
+
 private:
   explicit Window(NativeWindowHandle native_handle);
 };
@@ -1,6 +1,7 @@
 // C++ Standard Library
 #include <array>
 #include <numeric>
+#include <optional>
 #include <ostream>
 #include <type_traits>
 #include <vector>
@@ -48,13 +49,29 @@ std::ostream& operator<<(std::ostream& os, FontError error)
 
 void FontNativeDeleter::operator()(void* font) const
 {
-  SDE_LOG_DEBUG() << "FontNativeDeleter(" << font << ')';
-  FT_Done_Face(reinterpret_cast<FT_Face>(font));
+  // Aliased faces are released when their last shared owner is destroyed
+  if (shared == nullptr)
+  {
+    SDE_LOG_DEBUG() << "FontNativeDeleter(" << font << ')';
+    FT_Done_Face(reinterpret_cast<FT_Face>(font));
+  }
 }
 
 expected<void, FontError> FontCache::reload([[maybe_unused]] dependencies deps, Font& font)
 {
-  if (!asset::exists(font.path))
+  // Read font file through file system, if set
+  std::optional<AssetData> encoded;
+  if (file_system_ != nullptr)
+  {
+    auto data_or_error = file_system_->read(font.path);
+    if (!data_or_error.has_value())
+    {
+      SDE_LOG_DEBUG() << "AssetNotFound: " << data_or_error.error();
+      return make_unexpected(FontError::kAssetNotFound);
+    }
+    encoded = std::move(data_or_error).value();
+  }
+  else if (!asset::exists(font.path))
   {
     SDE_LOG_DEBUG() << "AssetNotFound";
     return make_unexpected(FontError::kAssetNotFound);
@@ -62,16 +79,74 @@ expected<void, FontError> FontCache::reload([[maybe_unused]] dependencies deps,
 
   static_assert(std::is_pointer_v<FT_Face>);
 
+  // Check if identical font content was already loaded
+  std::optional<Hash> content_key;
+  if (content_index_.enabled())
+  {
+    content_key = encoded.has_value() ? std::optional<Hash>{ComputeContentHash(encoded->bytes.data(), encoded->bytes.size())}
+                                      : ComputeContentHash(font.path);
+  }
+
+  if (content_key.has_value())
+  {
+    if (auto content = content_index_.find(*content_key); content.has_value())
+    {
+      font.native_id = FontNativeID{content->data.get(), FontNativeDeleter{std::move(content->data)}};
+      SDE_LOG_DEBUG() << "Font(" << font.native_id << ") " << font.path << " (aliased)";
+      return {};
+    }
+  }
+
+  const auto decode_start = Clock::now();
+
   FT_Face face = nullptr;
 
   static constexpr FT_Long kFontIndex = 0;
-  if (FT_New_Face(FreeType, font.path.string().c_str(), kFontIndex, &face) != kFreeTypeSuccess)
+  if (encoded.has_value())
+  {
+    if (
+      FT_New_Memory_Face(
+        FreeType,
+        reinterpret_cast<const FT_Byte*>(encoded->bytes.data()),
+        static_cast<FT_Long>(encoded->bytes.size()),
+        kFontIndex,
+        &face) != kFreeTypeSuccess)
+    {
+      SDE_LOG_DEBUG() << "AssetInvalid";
+      return make_unexpected(FontError::kAssetInvalid);
+    }
+  }
+  else if (FT_New_Face(FreeType, font.path.string().c_str(), kFontIndex, &face) != kFreeTypeSuccess)
   {
     SDE_LOG_DEBUG() << "AssetInvalid";
     return make_unexpected(FontError::kAssetInvalid);
   }
 
-  font.native_id = FontNativeID{reinterpret_cast<void*>(face)};
+  // Faces created from memory read from font bytes for as long as they are alive, so these bytes must outlive the face
+  if (encoded.has_value())
+  {
+    std::shared_ptr<void> shared{reinterpret_cast<void*>(face), [owner = std::move(encoded->owner)](void* face_ptr) {
+                                   FontNativeDeleter{}(face_ptr);
+                                 }};
+    font.native_id = FontNativeID{reinterpret_cast<void*>(face), FontNativeDeleter{shared}};
+    if (content_key.has_value())
+    {
+      content_index_.insert(
+        *content_key, {.data = std::move(shared)}, encoded->bytes.size(), Clock::now() - decode_start);
+    }
+  }
+  // Share face with subsequently loaded fonts with identical content
+  else if (content_key.has_value())
+  {
+    std::shared_ptr<void> shared{reinterpret_cast<void*>(face), FontNativeDeleter{}};
+    font.native_id = FontNativeID{reinterpret_cast<void*>(face), FontNativeDeleter{shared}};
+    content_index_.insert(
+      *content_key, {.data = std::move(shared)}, asset::file_size(font.path), Clock::now() - decode_start);
+  }
+  else
+  {
+    font.native_id = FontNativeID{reinterpret_cast<void*>(face)};
+  }
   SDE_LOG_DEBUG() << "Font(" << font.native_id << ") " << font.path;
   return {};
 }
@@ -1,6 +1,9 @@
 // C++ Standard Library
+#include <cstdint>
 #include <iomanip>
+#include <optional>
 #include <ostream>
+#include <span>
 
 // STB
 #pragma GCC diagnostic push
@@ -39,6 +42,115 @@ int to_stbi_enum(ImageChannels mode)
   return STBI_default;
 }
 
+/**
+ * @brief Cooked image meta-information
+ */
+struct CookedImageInfo
+{
+  std::int32_t height;
+  std::int32_t width;
+  std::int32_t channel_count;
+  std::int32_t element_type;
+};
+
+/**
+ * @brief Decodes \p image from \p encoded data, or from its path if \p encoded is not provided
+ */
+expected<void*, ImageError> decodeImage(Image& image, const std::optional<AssetData>& encoded)
+{
+  // Set flag determining whether image should be flipped on load
+  stbi_set_flip_vertically_on_load(image.options.flip_vertically);
+
+  // Get STBI channel code
+  const int channel_count_forced = to_stbi_enum(image.options.channels);
+
+  // Load image data and sizing
+  int height_on_load = 0;
+  int width_on_load = 0;
+  int channel_count_on_load = 0;
+  void* image_data_ptr = nullptr;
+  switch (image.options.element_type)
+  {
+  case TypeCode::kUInt8: {
+    image_data_ptr = encoded.has_value()
+      ? reinterpret_cast<void*>(stbi_load_from_memory(
+          reinterpret_cast<const stbi_uc*>(encoded->bytes.data()),
+          static_cast<int>(encoded->bytes.size()),
+          &height_on_load,
+          &width_on_load,
+          &channel_count_on_load,
+          channel_count_forced))
+      : reinterpret_cast<void*>(stbi_load(
+          image.path.string().c_str(), &height_on_load, &width_on_load, &channel_count_on_load, channel_count_forced));
+    break;
+  }
+  case TypeCode::kUInt16: {
+    image_data_ptr = encoded.has_value()
+      ? reinterpret_cast<void*>(stbi_load_16_from_memory(
+          reinterpret_cast<const stbi_uc*>(encoded->bytes.data()),
+          static_cast<int>(encoded->bytes.size()),
+          &height_on_load,
+          &width_on_load,
+          &channel_count_on_load,
+          channel_count_forced))
+      : reinterpret_cast<void*>(stbi_load_16(
+          image.path.string().c_str(), &height_on_load, &width_on_load, &channel_count_on_load, channel_count_forced));
+    break;
+  }
+  default: {
+    SDE_LOG_ERROR() << "UnsupportedBitDepth: " << SDE_OSNV(image.options.element_type);
+    return make_unexpected(ImageError::kUnsupportedBitDepth);
+  }
+  }
+
+  // Check if image point is valid
+  if (image_data_ptr == nullptr)
+  {
+    SDE_LOG_ERROR() << "AssetInvalid: " << SDE_OSNV(image.path);
+    return make_unexpected(ImageError::kAssetInvalid);
+  }
+
+  SDE_LOG_DEBUG() << "Loaded image: " << SDE_OSNV(image.path) << ", " << SDE_OSNV(height_on_load) << ", "
+                  << SDE_OSNV(width_on_load);
+
+  // Set loaded image image
+  image.options.channels = from_channel_count(channel_count_on_load);
+  image.shape.value.x() = height_on_load;
+  image.shape.value.y() = width_on_load;
+
+  return image_data_ptr;
+}
+
+/**
+ * @brief Sets \p image data to refer to \p cooked payload directly, without copying
+ *
+ * @return shared owner of image data, or nullptr if \p cooked does not match \p image
+ */
+std::shared_ptr<void> loadCookedImage(Image& image, const CookedAsset<CookedImageInfo>& cooked)
+{
+  if (cooked.info.element_type != static_cast<std::int32_t>(image.options.element_type))
+  {
+    return nullptr;
+  }
+
+  const auto channels = from_channel_count(static_cast<std::size_t>(cooked.info.channel_count));
+  const ImageShape shape{.value = {cooked.info.height, cooked.info.width}};
+  if (
+    (channels == ImageChannels::kDefault) or
+    (cooked.payload.size() !=
+     static_cast<std::size_t>(shape.pixels()) * to_channel_count(channels) * byte_count(image.options.element_type)))
+  {
+    return nullptr;
+  }
+
+  void* const image_data_ptr = const_cast<std::byte*>(cooked.payload.data());
+  std::shared_ptr<void> shared{std::const_pointer_cast<void>(cooked.owner), image_data_ptr};
+  image.options.channels = channels;
+  image.shape = shape;
+  image.data_buffer = ImageDataBuffer{image_data_ptr, ImageDataBufferDeleter{shared}};
+  return shared;
+}
+
 }  // namespace anonymous
 
 std::ostream& operator<<(std::ostream& os, ImageChannels channels)
@@ -68,11 +180,19 @@ std::ostream& operator<<(std::ostream& os, ImageError error)
     SDE_OS_ENUM_CASE(ImageError::kAssetInvalid)
     SDE_OS_ENUM_CASE(ImageError::kImageNotFound)
     SDE_OS_ENUM_CASE(ImageError::kUnsupportedBitDepth)
+    SDE_OS_ENUM_CASE(ImageError::kAssetCookFailed)
   }
   return os;
 }
 
-void ImageDataBufferDeleter::operator()(void* data) const { stbi_image_free(data); }
+void ImageDataBufferDeleter::operator()(void* data) const
+{
+  // Aliased data is released when its last shared owner is destroyed
+  if (shared == nullptr)
+  {
+    stbi_image_free(data);
+  }
+}
 
 ImageHandle ImageCache::to_handle(const asset::path& path) const
 {
@@ -103,57 +223,99 @@ expected<void, ImageError> ImageCache::reload([[maybe_unused]] dependencies deps
     return {};
   }
 
+  // Read encoded image through file system, if set
+  std::optional<AssetData> encoded;
+  if (file_system_ != nullptr)
+  {
+    auto data_or_error = file_system_->read(image.path);
+    if (!data_or_error.has_value())
+    {
+      SDE_LOG_ERROR() << "AssetNotFound: " << SDE_OSNV(image.path) << " (" << data_or_error.error() << ')';
+      return make_unexpected(ImageError::kAssetNotFound);
+    }
+    encoded = std::move(data_or_error).value();
+  }
   // Check if image point is valid
-  if (!asset::exists(image.path))
+  else if (!asset::exists(image.path))
   {
     SDE_LOG_ERROR() << "AssetNotFound: " << SDE_OSNV(image.path);
     return make_unexpected(ImageError::kAssetNotFound);
   }
 
-  // Set flag determining whether image should be flipped on load
-  stbi_set_flip_vertically_on_load(image.options.flip_vertically);
-
-  // Get STBI channel code
-  const int channel_count_forced = to_stbi_enum(image.options.channels);
-
-  // Load image data and sizing
-  int height_on_load = 0;
-  int width_on_load = 0;
-  int channel_count_on_load = 0;
-  void* image_data_ptr = nullptr;
-  switch (image.options.element_type)
+  // Key image content by file contents and load options for aliasing and cooked lookup
+  std::optional<Hash> content_key;
+  if (content_index_.enabled() or (cooked_assets_ != nullptr))
   {
-  case TypeCode::kUInt8: {
-    image_data_ptr = reinterpret_cast<void*>(stbi_load(
-      image.path.string().c_str(), &height_on_load, &width_on_load, &channel_count_on_load, channel_count_forced));
-    break;
-  }
-  case TypeCode::kUInt16: {
-    image_data_ptr = reinterpret_cast<void*>(stbi_load_16(
-      image.path.string().c_str(), &height_on_load, &width_on_load, &channel_count_on_load, channel_count_forced));
-    break;
-  }
-  default: {
-    SDE_LOG_ERROR() << "UnsupportedBitDepth: " << SDE_OSNV(image.options.element_type);
-    return make_unexpected(ImageError::kUnsupportedBitDepth);
+    if (const auto content_hash = encoded.has_value()
+          ? std::optional<Hash>{ComputeContentHash(encoded->bytes.data(), encoded->bytes.size())}
+          : ComputeContentHash(image.path);
+        content_hash.has_value())
+    {
+      content_key = (*content_hash) + ComputeHash(image.options);
+    }
   }
+
+  // Check if identical image content was already decoded with the same options
+  if (content_key.has_value() and content_index_.enabled())
+  {
+    if (auto content = content_index_.find(*content_key); content.has_value())
+    {
+      SDE_LOG_DEBUG() << "Aliased image: " << SDE_OSNV(image.path) << ", " << SDE_OSNV(content->info.shape.height())
+                      << ", " << SDE_OSNV(content->info.shape.width());
+      image.options.channels = content->info.channels;
+      image.shape = content->info.shape;
+      image.data_buffer = ImageDataBuffer{content->data.get(), ImageDataBufferDeleter{std::move(content->data)}};
+      return {};
+    }
   }
 
-  // Check if image point is valid
-  if (image_data_ptr == nullptr)
+  const auto decode_start = Clock::now();
+
+  // Use image data which was decoded ahead of time, if available
+  if (content_key.has_value() and (cooked_assets_ != nullptr))
   {
-    SDE_LOG_ERROR() << "AssetInvalid: " << SDE_OSNV(image.path);
-    return make_unexpected(ImageError::kAssetInvalid);
+    if (auto cooked = cooked_assets_->find<CookedImageInfo>(*content_key); cooked.has_value())
+    {
+      if (auto shared = loadCookedImage(image, *cooked); shared != nullptr)
+      {
+        SDE_LOG_DEBUG() << "Loaded cooked image: " << SDE_OSNV(image.path);
+        if (content_index_.enabled())
+        {
+          content_index_.insert(
+            *content_key,
+            {.data = std::move(shared),
+             .info = {.channels = image.options.channels, .shape = image.shape}},
+            image.getTotalSizeInBytes(),
+            Clock::now() - decode_start);
+        }
+        return {};
+      }
+      SDE_LOG_WARN() << "Ignoring invalid cooked image: " << SDE_OSNV(image.path);
+    }
   }
 
-  SDE_LOG_DEBUG() << "Loaded image: " << SDE_OSNV(image.path) << ", " << SDE_OSNV(height_on_load) << ", "
-                  << SDE_OSNV(width_on_load);
+  auto image_data_or_error = decodeImage(image, encoded);
+  if (!image_data_or_error.has_value())
+  {
+    return make_unexpected(image_data_or_error.error());
+  }
+  void* const image_data_ptr = *image_data_or_error;
 
-  // Set loaded image image
-  image.options.channels = from_channel_count(channel_count_on_load);
-  image.shape.value.x() = height_on_load;
-  image.shape.value.y() = width_on_load;
-  image.data_buffer = ImageDataBuffer{image_data_ptr};
+  // Share decoded data with subsequently loaded images with identical content
+  if (content_key.has_value() and content_index_.enabled())
+  {
+    std::shared_ptr<void> shared{image_data_ptr, ImageDataBufferDeleter{}};
+    image.data_buffer = ImageDataBuffer{image_data_ptr, ImageDataBufferDeleter{shared}};
+    content_index_.insert(
+      *content_key,
+      {.data = std::move(shared), .info = {.channels = image.options.channels, .shape = image.shape}},
+      image.getTotalSizeInBytes(),
+      Clock::now() - decode_start);
+  }
+  else
+  {
+    image.data_buffer = ImageDataBuffer{image_data_ptr};
+  }
   return {};
 }
 
@@ -164,6 +326,41 @@ expected<void, ImageError> ImageCache::unload([[maybe_unused]] dependencies deps
   return {};
 }
 
+expected<void, ImageError>
+ImageCache::cook(const CookedAssetStore& cooked_assets, const asset::path& image_path, const ImageOptions& options)
+{
+  // Key is computed before decoding, since decoding resolves default load options
+  const auto content_hash = cooked_assets.source_hash(image_path);
+  if (!content_hash.has_value())
+  {
+    SDE_LOG_ERROR() << "AssetNotFound: " << SDE_OSNV(image_path);
+    return make_unexpected(ImageError::kAssetNotFound);
+  }
+  const auto key = (*content_hash) + ComputeHash(options);
+
+  Image image{.path = image_path, .options = options, .shape = {.value = {0, 0}}, .data_buffer = ImageDataBuffer{nullptr}};
+  auto image_data_or_error = decodeImage(image, std::nullopt);
+  if (!image_data_or_error.has_value())
+  {
+    return make_unexpected(image_data_or_error.error());
+  }
+  image.data_buffer = ImageDataBuffer{*image_data_or_error};
+
+  const CookedImageInfo info{
+    .height = image.shape.value.x(),
+    .width = image.shape.value.y(),
+    .channel_count = static_cast<std::int32_t>(image.getChannelCount()),
+    .element_type = static_cast<std::int32_t>(image.options.element_type)};
+  const std::span<const std::byte> payload{
+    reinterpret_cast<const std::byte*>(image.data_buffer.value()), image.getTotalSizeInBytes()};
+  if (auto ok_or_error = cooked_assets.write(key, info, payload); !ok_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << "AssetCookFailed: " << SDE_OSNV(image_path) << " (" << ok_or_error.error() << ')';
+    return make_unexpected(ImageError::kAssetCookFailed);
+  }
+  return {};
+}
+
 expected<Image, ImageError>
 ImageCache::generate([[maybe_unused]] dependencies deps, const asset::path& image_path, const ImageOptions& options)
 {
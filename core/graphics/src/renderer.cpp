@@ -25,6 +25,7 @@
 #include "sde/graphics/tile_set.hpp"
 #include "sde/graphics/typedef.hpp"
 #include "sde/logging.hpp"
+#include "sde/profiler.hpp"
 #include "sde/time_ostream.hpp"
 #include "sde/vector.hpp"
 
@@ -844,6 +845,7 @@ void Renderer2D::refresh(const RenderResources& resources)
 
 void Renderer2D::flush(const dependencies& deps, const RenderUniforms& uniforms, const Mat3f& viewport_from_world)
 {
+  SDE_PROFILE_SCOPE("Renderer2D::flush");
   const auto shader = deps(next_active_resources_.shader);
   SDE_ASSERT_TRUE(shader);
 
@@ -932,6 +934,8 @@ RenderPass::~RenderPass()
     return;
   }
 
+  SDE_PROFILE_SCOPE("RenderPass::submit");
+
   if (auto ok_or_error = submit(make_const_view(buffer_->circles)); !ok_or_error)
   {
     SDE_LOG_ERROR() << "error on submit(circles): " << SDE_OSNV(ok_or_error.error());
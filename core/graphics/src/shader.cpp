@@ -508,6 +508,21 @@ void NativeShaderDeleter::operator()(native_shader_id_t id) const
 
 expected<void, ShaderError> ShaderCache::reload([[maybe_unused]] dependencies deps, Shader& shader)
 {
+  // Read shader source from asset pack or memory-mapped loose file
+  if (file_system_ != nullptr)
+  {
+    const auto data_or_error = file_system_->read(shader.path);
+    if (!data_or_error.has_value())
+    {
+      SDE_LOG_ERROR() << "AssetNotFound: " << SDE_OSNV(shader.path) << " (" << data_or_error.error() << ')';
+      return make_unexpected(ShaderError::kAssetNotFound);
+    }
+    SDE_LOG_INFO() << "Shader loaded from file system: " << SDE_OSNV(shader.path);
+    return compile(
+      shader,
+      std::string_view{reinterpret_cast<const char*>(data_or_error->bytes.data()), data_or_error->bytes.size()});
+  }
+
   // Check if image point is valid
   if (!asset::exists(shader.path))
   {
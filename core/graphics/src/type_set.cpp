@@ -1,6 +1,8 @@
 // C++ Standard Library
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
 #include <ostream>
 #include <type_traits>
@@ -43,7 +45,78 @@ const auto kDefaultGlyphs{[] {
   return glyphs;
 }()};
 
-expected<void, TypeSetError> loadGlyphsFromFont(sde::vector<Glyph>& glyph_lut, const Font& font, int glyph_height)
+/**
+ * @brief Cooked glyph atlas meta-information
+ */
+struct CookedGlyphAtlasInfo
+{
+  std::int32_t width_px;
+  std::int32_t height_px;
+  std::uint32_t glyph_count;
+};
+
+/**
+ * @brief Cooked glyph metrics, stored ahead of atlas pixels in cooked glyph atlas payloads
+ */
+struct CookedGlyph
+{
+  char character;
+  std::int32_t size_px[2];
+  std::int32_t bearing_px[2];
+  float advance_px;
+};
+
+/**
+ * @brief Stacks glyphs vertically in the order given, setting glyph atlas bounds
+ *
+ * @return glyph atlas dimensions, in pixels
+ */
+Vec2i layoutGlyphAtlas(sde::vector<Glyph>& glyph_lut)
+{
+  Vec2i atlas_dimensions{0, 0};
+  for (const auto& g : glyph_lut)
+  {
+    atlas_dimensions.x() = std::max(atlas_dimensions.x(), g.size_px.x());
+    atlas_dimensions.y() += g.size_px.y();
+  }
+
+  if (atlas_dimensions.prod() == 0)
+  {
+    return atlas_dimensions;
+  }
+
+  int prev_px_y = 0;
+  for (auto& g : glyph_lut)
+  {
+    if (g.size_px.prod() == 0)
+    {
+      continue;
+    }
+
+    const Vec2i tex_coord_min_px{0, prev_px_y};
+    const Vec2i tex_coord_max_px{tex_coord_min_px + g.size_px};
+
+    const Vec2f tex_coord_min{tex_coord_min_px.array().cast<float>() / atlas_dimensions.array().cast<float>()};
+    const Vec2f tex_coord_max{tex_coord_max_px.array().cast<float>() / atlas_dimensions.array().cast<float>()};
+
+    g.atlas_bounds = Rect2f{Vec2f{tex_coord_min.x(), tex_coord_max.y()}, Vec2f{tex_coord_max.x(), tex_coord_min.y()}};
+
+    prev_px_y += g.size_px.y();
+  }
+  return atlas_dimensions;
+}
+
+/**
+ * @brief Glyph metrics and single-channel glyph atlas pixels
+ */
+struct GlyphAtlas
+{
+  sde::vector<Glyph> glyphs;
+  Vec2i dimensions;
+  sde::vector<std::uint8_t> pixels;
+};
+
+expected<GlyphAtlas, TypeSetError> bakeGlyphAtlas(const Font& font, int glyph_height)
 {
   if (glyph_height == 0)
   {
@@ -51,8 +124,6 @@ expected<void, TypeSetError> loadGlyphsFromFont(sde::vector<Glyph>& glyph_lut, c
     return make_unexpected(TypeSetError::kGlyphSizeInvalid);
   }
 
-  glyph_lut.resize(kDefaultGlyphCount);
-
   const auto face = reinterpret_cast<FT_Face>(font.native_id.value());
 
   static constexpr int kWidthFromHeight = 0;
@@ -61,6 +132,13 @@ expected<void, TypeSetError> loadGlyphsFromFont(sde::vector<Glyph>& glyph_lut, c
     SDE_LOG_DEBUG_FMT("GlyphSizeInvalid (font: %p, height: %lu)", face, glyph_height);
     return make_unexpected(TypeSetError::kGlyphSizeInvalid);
   }
+
+  GlyphAtlas atlas;
+  atlas.glyphs.resize(kDefaultGlyphCount);
+
+  // Each glyph is rendered once; bitmaps are held until atlas dimensions are known
+  sde::vector<sde::vector<std::uint8_t>> bitmaps;
+  bitmaps.resize(kDefaultGlyphCount);
   for (std::size_t char_index = 0; char_index < kDefaultGlyphs.size(); ++char_index)
   {
     if (FT_Load_Char(face, kDefaultGlyphs[char_index], FT_LOAD_RENDER) != kFreeTypeSuccess)
@@ -68,48 +146,69 @@ expected<void, TypeSetError> loadGlyphsFromFont(sde::vector<Glyph>& glyph_lut, c
       SDE_LOG_DEBUG() << "GlyphMissing: " << SDE_OSNV(char_index);
       return make_unexpected(TypeSetError::kGlyphDataMissing);
     }
-    else
+
+    const auto& bitmap = face->glyph->bitmap;
+    atlas.glyphs[char_index] = Glyph{
+      .character = kDefaultGlyphs[char_index],
+      .size_px = Vec2i{static_cast<float>(bitmap.width), static_cast<float>(bitmap.rows)},
+      .bearing_px = Vec2i{static_cast<float>(face->glyph->bitmap_left), static_cast<float>(face->glyph->bitmap_top)},
+      .advance_px = static_cast<float>(face->glyph->advance.x) / 64.0F,
+      .atlas_bounds = Rect2f{},
+    };
+
+    auto& glyph_bitmap = bitmaps[char_index];
+    glyph_bitmap.resize(static_cast<std::size_t>(bitmap.width) * static_cast<std::size_t>(bitmap.rows));
+    for (std::size_t row = 0; row < static_cast<std::size_t>(bitmap.rows); ++row)
     {
-      glyph_lut[char_index] = Glyph{
-        .character = kDefaultGlyphs[char_index],
-        .size_px = Vec2i{static_cast<float>(face->glyph->bitmap.width), static_cast<float>(face->glyph->bitmap.rows)},
-        .bearing_px = Vec2i{static_cast<float>(face->glyph->bitmap_left), static_cast<float>(face->glyph->bitmap_top)},
-        .advance_px = static_cast<float>(face->glyph->advance.x) / 64.0F,
-        .atlas_bounds = Rect2f{},
-      };
+      std::copy_n(
+        bitmap.buffer + static_cast<std::ptrdiff_t>(row) * bitmap.pitch,
+        bitmap.width,
+        glyph_bitmap.data() + row * bitmap.width);
     }
   }
-  return {};
-}
 
-expected<TextureHandle, TypeSetError> sendGlyphsToTexture(
-  TypeSetCache::dependencies deps,
-  TextureHandle glyph_atlas,
-  sde::vector<Glyph>& glyph_lut,
-  const Font& font,
-  const TypeSetOptions& options)
-{
-  // Compute required texture dimensions
-  Vec2i texture_dimensions{0, 0};
-  for (const auto& g : glyph_lut)
+  atlas.dimensions = layoutGlyphAtlas(atlas.glyphs);
+  if (atlas.dimensions.prod() == 0)
   {
-    texture_dimensions.x() = std::max(texture_dimensions.x(), g.size_px.x());
-    texture_dimensions.y() += g.size_px.y();
+    SDE_LOG_ERROR() << "GlyphAtlasTextureCreationFailed : " << SDE_OSNV(atlas.dimensions);
+    return make_unexpected(TypeSetError::kGlyphAtlasTextureCreationFailed);
   }
 
-  if (texture_dimensions.prod() == 0)
+  const auto atlas_width = static_cast<std::size_t>(atlas.dimensions.x());
+  atlas.pixels.resize(atlas_width * static_cast<std::size_t>(atlas.dimensions.y()), 0);
+
+  std::size_t prev_px_y = 0;
+  for (std::size_t char_index = 0; char_index < atlas.glyphs.size(); ++char_index)
   {
-    SDE_LOG_ERROR() << "GlyphAtlasTextureCreationFailed : " << SDE_OSNV(texture_dimensions);
-    return make_unexpected(TypeSetError::kGlyphAtlasTextureCreationFailed);
+    const auto& g = atlas.glyphs[char_index];
+    const auto glyph_width = static_cast<std::size_t>(g.size_px.x());
+    const auto glyph_height = static_cast<std::size_t>(g.size_px.y());
+    for (std::size_t row = 0; row < glyph_height; ++row)
+    {
+      std::copy_n(
+        bitmaps[char_index].data() + row * glyph_width,
+        glyph_width,
+        atlas.pixels.data() + (prev_px_y + row) * atlas_width);
+    }
+    prev_px_y += glyph_height;
   }
+  return atlas;
+}
 
+expected<TextureHandle, TypeSetError> sendGlyphsToTexture(
+  TypeSetCache::dependencies deps,
+  TextureHandle glyph_atlas,
+  const Vec2i& atlas_dimensions,
+  View<const std::uint8_t> atlas_pixels,
+  const TypeSetOptions& options)
+{
   // clang-format off
   auto glyph_atlas_or_error = 
     deps.get<TextureCache>().find_or_create(
       glyph_atlas,
       deps,
       TypeCode::kUInt8,
-      TextureShape{.value=texture_dimensions},
+      TextureShape{.value=atlas_dimensions},
       TextureLayout::kR,
       TextureOptions{
         .u_wrapping = TextureWrapping::kClampToEdge,
@@ -126,49 +225,57 @@ expected<TextureHandle, TypeSetError> sendGlyphsToTexture(
     return make_unexpected(TypeSetError::kGlyphAtlasTextureCreationFailed);
   }
 
-  const auto face = reinterpret_cast<FT_Face>(font.native_id.value());
-
-  int prex_px_y = 0;
-  for (auto& g : glyph_lut)
+  // Upload all glyphs at once
+  if (const auto ok_or_error = replace(*glyph_atlas_or_error->value, atlas_pixels); !ok_or_error.has_value())
   {
-    if (g.size_px.prod() == 0)
-    {
-      continue;
-    }
-
-    // TODO(bcairl) is there anyway to prevent rendering twice?
-    if (FT_Load_Char(face, g.character, FT_LOAD_RENDER) != kFreeTypeSuccess)
-    {
-      SDE_LOG_ERROR() << "GlyphMissing: " << SDE_OSNV(g.character);
-      return make_unexpected(TypeSetError::kGlyphDataMissing);
-    }
-
-    const auto* buffer_ptr = reinterpret_cast<std::uint8_t*>(face->glyph->bitmap.buffer);
-    const auto buffer_length =
-      static_cast<std::size_t>(face->glyph->bitmap.width) * static_cast<std::size_t>(face->glyph->bitmap.rows);
-
-    const Vec2i tex_coord_min_px{0, prex_px_y};
-    const Vec2i tex_coord_max_px{tex_coord_min_px + g.size_px};
+    SDE_LOG_ERROR() << "GlyphRenderingFailure: " << ok_or_error.error();
+    return make_unexpected(TypeSetError::kGlyphRenderingFailure);
+  }
 
-    if (const auto ok_or_error = replace(
-          *glyph_atlas_or_error->value,
-          make_const_view(buffer_ptr, buffer_length),
-          Bounds2i{tex_coord_min_px, tex_coord_max_px});
-        !ok_or_error.has_value())
-    {
-      SDE_LOG_ERROR() << "GlyphRenderingFailure: " << ok_or_error.error();
-      return make_unexpected(TypeSetError::kGlyphRenderingFailure);
-    }
+  return glyph_atlas_or_error->handle;
+}
 
-    const Vec2f tex_coord_min{tex_coord_min_px.array().cast<float>() / texture_dimensions.array().cast<float>()};
-    const Vec2f tex_coord_max{tex_coord_max_px.array().cast<float>() / texture_dimensions.array().cast<float>()};
+std::optional<Hash>
+cookedGlyphAtlasKey(const CookedAssetStore& cooked_assets, const Font& font, const TypeSetOptions& options)
+{
+  if (const auto font_hash = cooked_assets.source_hash(font.path); font_hash.has_value())
+  {
+    return (*font_hash) + ComputeHash(options);
+  }
+  return std::nullopt;
+}
 
-    g.atlas_bounds = Rect2f{Vec2f{tex_coord_min.x(), tex_coord_max.y()}, Vec2f{tex_coord_max.x(), tex_coord_min.y()}};
+std::optional<GlyphAtlas> fromCookedGlyphAtlas(const CookedAsset<CookedGlyphAtlasInfo>& cooked)
+{
+  const std::size_t glyph_bytes = cooked.info.glyph_count * sizeof(CookedGlyph);
+  const std::size_t pixel_bytes =
+    static_cast<std::size_t>(cooked.info.width_px) * static_cast<std::size_t>(cooked.info.height_px);
+  if (cooked.payload.size() != (glyph_bytes + pixel_bytes))
+  {
+    return std::nullopt;
+  }
 
-    prex_px_y += g.size_px.y();
+  GlyphAtlas atlas;
+  atlas.glyphs.resize(cooked.info.glyph_count);
+  for (std::size_t i = 0; i < atlas.glyphs.size(); ++i)
+  {
+    CookedGlyph g;
+    std::memcpy(&g, cooked.payload.data() + i * sizeof(CookedGlyph), sizeof(CookedGlyph));
+    atlas.glyphs[i] = Glyph{
+      .character = g.character,
+      .size_px = Vec2i{g.size_px[0], g.size_px[1]},
+      .bearing_px = Vec2i{g.bearing_px[0], g.bearing_px[1]},
+      .advance_px = g.advance_px,
+      .atlas_bounds = Rect2f{},
+    };
   }
 
-  return glyph_atlas_or_error->handle;
+  atlas.dimensions = layoutGlyphAtlas(atlas.glyphs);
+  if ((atlas.dimensions.x() != cooked.info.width_px) or (atlas.dimensions.y() != cooked.info.height_px))
+  {
+    return std::nullopt;
+  }
+  return atlas;
 }
 
 }  // namespace
@@ -184,6 +291,7 @@ std::ostream& operator<<(std::ostream& os, TypeSetError error)
     SDE_OS_ENUM_CASE(TypeSetError::kGlyphDataMissing)
     SDE_OS_ENUM_CASE(TypeSetError::kGlyphRenderingFailure)
     SDE_OS_ENUM_CASE(TypeSetError::kGlyphAtlasTextureCreationFailed)
+    SDE_OS_ENUM_CASE(TypeSetError::kAssetCookFailed)
   }
   return os;
 }
@@ -224,23 +332,102 @@ expected<void, TypeSetError> TypeSetCache::reload(dependencies deps, TypeSet& ty
     font->path.string().c_str(),
     fonts.size());
 
-  if (auto ok_or_error = loadGlyphsFromFont(type_set.glyphs, *font, static_cast<int>(type_set.options.height_px));
-      !ok_or_error.has_value())
+  // Use glyph atlas which was baked ahead of time, if available
+  if (cooked_assets_ != nullptr)
   {
-    return make_unexpected(ok_or_error.error());
+    if (const auto key = cookedGlyphAtlasKey(*cooked_assets_, *font, type_set.options); key.has_value())
+    {
+      if (const auto cooked = cooked_assets_->find<CookedGlyphAtlasInfo>(*key); cooked.has_value())
+      {
+        if (auto atlas = fromCookedGlyphAtlas(*cooked); atlas.has_value())
+        {
+          const auto pixels = cooked->payload.subspan(cooked->info.glyph_count * sizeof(CookedGlyph));
+          auto glyph_atlas_or_error = sendGlyphsToTexture(
+            deps,
+            type_set.glyph_atlas,
+            atlas->dimensions,
+            make_const_view(reinterpret_cast<const std::uint8_t*>(pixels.data()), pixels.size()),
+            type_set.options);
+          if (!glyph_atlas_or_error.has_value())
+          {
+            return make_unexpected(glyph_atlas_or_error.error());
+          }
+          type_set.glyph_atlas = (*glyph_atlas_or_error);
+          type_set.glyphs = std::move(atlas->glyphs);
+          SDE_LOG_DEBUG_FMT("GlyphAtlasTexture(%lu) (cooked)", type_set.glyph_atlas.id());
+          return {};
+        }
+        SDE_LOG_WARN() << "Ignoring invalid cooked glyph atlas: " << SDE_OSNV(font->path);
+      }
+    }
+  }
+
+  auto atlas_or_error = bakeGlyphAtlas(*font, static_cast<int>(type_set.options.height_px));
+  if (!atlas_or_error.has_value())
+  {
+    return make_unexpected(atlas_or_error.error());
   }
 
-  auto glyph_atlas_or_error = sendGlyphsToTexture(deps, type_set.glyph_atlas, type_set.glyphs, *font, type_set.options);
+  auto glyph_atlas_or_error = sendGlyphsToTexture(
+    deps,
+    type_set.glyph_atlas,
+    atlas_or_error->dimensions,
+    make_const_view(atlas_or_error->pixels.data(), atlas_or_error->pixels.size()),
+    type_set.options);
   if (!glyph_atlas_or_error.has_value())
   {
     SDE_LOG_ERROR() << glyph_atlas_or_error.error();
     return make_unexpected(glyph_atlas_or_error.error());
   }
   type_set.glyph_atlas = (*glyph_atlas_or_error);
+  type_set.glyphs = std::move(atlas_or_error->glyphs);
   SDE_LOG_DEBUG_FMT("GlyphAtlasTexture(%lu)", type_set.glyph_atlas.id());
   return {};
 }
 
+expected<void, TypeSetError>
+TypeSetCache::cook(const CookedAssetStore& cooked_assets, const Font& font, const TypeSetOptions& options)
+{
+  const auto key = cookedGlyphAtlasKey(cooked_assets, font, options);
+  if (!key.has_value())
+  {
+    SDE_LOG_ERROR() << "InvalidFont: " << SDE_OSNV(font.path);
+    return make_unexpected(TypeSetError::kInvalidFont);
+  }
+
+  auto atlas_or_error = bakeGlyphAtlas(font, static_cast<int>(options.height_px));
+  if (!atlas_or_error.has_value())
+  {
+    return make_unexpected(atlas_or_error.error());
+  }
+
+  const auto& atlas = *atlas_or_error;
+  sde::vector<std::byte> payload;
+  payload.resize(atlas.glyphs.size() * sizeof(CookedGlyph) + atlas.pixels.size());
+  for (std::size_t i = 0; i < atlas.glyphs.size(); ++i)
+  {
+    const auto& g = atlas.glyphs[i];
+    const CookedGlyph cooked_glyph{
+      .character = g.character,
+      .size_px = {g.size_px.x(), g.size_px.y()},
+      .bearing_px = {g.bearing_px.x(), g.bearing_px.y()},
+      .advance_px = g.advance_px};
+    std::memcpy(payload.data() + i * sizeof(CookedGlyph), &cooked_glyph, sizeof(CookedGlyph));
+  }
+  std::memcpy(payload.data() + atlas.glyphs.size() * sizeof(CookedGlyph), atlas.pixels.data(), atlas.pixels.size());
+
+  const CookedGlyphAtlasInfo info{
+    .width_px = atlas.dimensions.x(),
+    .height_px = atlas.dimensions.y(),
+    .glyph_count = static_cast<std::uint32_t>(atlas.glyphs.size())};
+  if (auto ok_or_error = cooked_assets.write(*key, info, {payload.data(), payload.size()}); !ok_or_error.has_value())
+  {
+    SDE_LOG_ERROR() << "AssetCookFailed: " << SDE_OSNV(font.path) << " (" << ok_or_error.error() << ')';
+    return make_unexpected(TypeSetError::kAssetCookFailed);
+  }
+  return {};
+}
+
 expected<void, TypeSetError> TypeSetCache::unload(dependencies deps, TypeSet& type_set)
 {
   deps.get<TextureCache>().remove(type_set.glyph_atlas, deps);
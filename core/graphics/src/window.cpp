@@ -89,6 +89,12 @@ Window::Window(NativeWindowHandle native_handle) : UniqueResource<NativeWindowHa
 
 void Window::activate() const { glfwMakeContextCurrent(reinterpret_cast<GLFWwindow*>(value())); }
 
+void Window::setSwapInterval(int interval) const
+{
+  this->activate();
+  glfwSwapInterval(interval);
+}
+
 bool Window::poll() const
 {
   auto* w = reinterpret_cast<GLFWwindow*>(value());
@@ -145,8 +151,7 @@ expected<Window, WindowError> Window::create(const WindowOptions& options)
   enable_native_error_logs();
 #endif  // SDE_GLFW_DEBUG
 
-  static constexpr int kBufferSwapInterval_EnableVSync = 1;
-  glfwSwapInterval(kBufferSwapInterval_EnableVSync);
+  window.setSwapInterval(options.swap_interval);
   glfwSetInputMode(glfw_window, GLFW_STICKY_KEYS, GLFW_TRUE);
 
   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
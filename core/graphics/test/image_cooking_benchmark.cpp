@@ -0,0 +1,83 @@
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// STB
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+// SDE
+#include "sde/cooked_asset.hpp"
+#include "sde/graphics/image.hpp"
+#include "sde/resource_dependencies.hpp"
+
+using namespace sde;
+using namespace sde::graphics;
+
+namespace
+{
+
+constexpr const char* kImageDirectory = "ImageCookingBenchmark.images";
+constexpr const char* kCookedDirectory = "ImageCookingBenchmark.cooked";
+
+/// Number of images loaded at startup
+constexpr std::size_t kImageCount = 16;
+
+std::vector<asset::path> WriteImages(int size_px)
+{
+  asset::remove_all(kImageDirectory);
+  asset::remove_all(kCookedDirectory);
+  asset::create_directories(kImageDirectory);
+  asset::create_directories(kCookedDirectory);
+
+  const CookedAssetStore cooked_assets{kCookedDirectory};
+  std::vector<asset::path> paths;
+  std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size_px * size_px * 4));
+  for (std::size_t i = 0; i < kImageCount; ++i)
+  {
+    // Smooth gradients with some noise, so images compress roughly like real sprites
+    std::uint32_t noise = static_cast<std::uint32_t>(i + 1);
+    for (std::size_t p = 0; p < pixels.size(); ++p)
+    {
+      noise = noise * 1664525U + 1013904223U;
+      pixels[p] = static_cast<std::uint8_t>((p / 4) % size_px + i + ((noise >> 24) & 0x7));
+    }
+    paths.push_back(asset::path{kImageDirectory} / ("image-" + std::to_string(i) + ".png"));
+    stbi_write_png(paths.back().string().c_str(), size_px, size_px, 4, pixels.data(), size_px * 4);
+    [[maybe_unused]] auto _ = ImageCache::cook(cooked_assets, paths.back());
+  }
+  return paths;
+}
+
+void Startup(benchmark::State& state, bool cooked)
+{
+  const auto paths = WriteImages(state.range(0));
+  const auto cooked_assets = std::make_shared<const CookedAssetStore>(kCookedDirectory);
+  for (auto _ : state)
+  {
+    ImageCache cache;
+    if (cooked)
+    {
+      cache.set_cooked_assets(cooked_assets);
+    }
+    for (const auto& path : paths)
+    {
+      benchmark::DoNotOptimize(cache.create(NoDependencies, path));
+    }
+  }
+  asset::remove_all(kImageDirectory);
+  asset::remove_all(kCookedDirectory);
+}
+
+}  // namespace
+
+static void BM_ImageStartupDecoded(benchmark::State& state) { Startup(state, false); }
+BENCHMARK(BM_ImageStartupDecoded)->RangeMultiplier(4)->Range(64, 1024);
+
+static void BM_ImageStartupCooked(benchmark::State& state) { Startup(state, true); }
+BENCHMARK(BM_ImageStartupCooked)->RangeMultiplier(4)->Range(64, 1024);
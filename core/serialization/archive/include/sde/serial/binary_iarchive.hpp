@@ -6,6 +6,8 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -31,6 +33,19 @@ public:
 
   const IStreamT* operator->() const { return is_; }
 
+  /**
+   * @brief Returns a view of the next \p len bytes in the stream, without copying
+   *
+   *        Only available for streams which can provide views of their bytes (e.g. mmap_istream)
+   *
+   * @return view of \p len bytes; an empty view, leaving the stream unchanged, if bytes can not be viewed
+   */
+  std::span<const std::byte> read_view(std::size_t len)
+    requires requires(IStreamT& is) { is.read_view(len); }
+  {
+    return is_->read_view(len);
+  }
+
 private:
   template <typename ValueT> static constexpr void read_impl(label<ValueT> _)
   { /* labels are ignored */
@@ -33,7 +33,7 @@ public:
 private:
   template <typename ValueT> void write_impl(const label<ValueT> l)
   {
-    hash_ += ComputeHash(l.value);
+    hash_ += Hash{ComputeBytesHashValue(l.value)};
     hash_ += ComputeTypeHash<ValueT>();
   }
 
@@ -50,8 +50,8 @@ private:
   template <typename PointerT, std::size_t Len>
   void write_impl([[maybe_unused]] const basic_packet_fixed_size<PointerT, Len>& _)
   {
-    hash_ += ComputeTypeHash<PointerT>();
-    hash_ += ComputeHash(Len);
+    static constexpr Hash kPacketHash = ComputeTypeHash<PointerT>() + Hash{Len};
+    hash_ += kPacketHash;
   }
 
   Hash hash_;
@@ -0,0 +1,69 @@
+// C++ Standard Library
+#include <string>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/serial/hash_oarchive.hpp"
+#include "sde/serial/named.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+// Stand-in for native script instance data, which are versioned by digest of their saved layout
+struct ScriptData
+{
+  bool initialized = false;
+  float time_scale = 1.F;
+  double elapsed = 0.0;
+  int frame_count = 0;
+  std::size_t entity_count = 0;
+  float bounds[4] = {};
+};
+
+sde::Hash ComputeVersion()
+{
+  hash_oarchive oar;
+  ScriptData data;
+  oar << named{"initialized", data.initialized};
+  oar << named{"time_scale", data.time_scale};
+  oar << named{"elapsed", data.elapsed};
+  oar << named{"frame_count", data.frame_count};
+  oar << named{"entity_count", data.entity_count};
+  oar << named{"bounds", data.bounds};
+  return oar.digest();
+}
+
+}  // namespace
+
+static void BM_ScriptVersionPerCall(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(ComputeVersion());
+  }
+}
+BENCHMARK(BM_ScriptVersionPerCall);
+
+static void BM_ScriptVersionCached(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    static const sde::Hash kVersion = ComputeVersion();
+    benchmark::DoNotOptimize(kVersion);
+  }
+}
+BENCHMARK(BM_ScriptVersionCached);
+
+static void BM_TypeHash(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(sde::ComputeTypeHash<std::vector<std::string>>());
+  }
+}
+BENCHMARK(BM_TypeHash);
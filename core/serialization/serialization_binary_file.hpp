@@ -12,5 +12,6 @@
 #include "sde/serial/binary_oarchive.hpp"
 #include "sde/serial/file_istream.hpp"
 #include "sde/serial/file_ostream.hpp"
+#include "sde/serial/mmap_istream.hpp"
 #include "sde/serialization.hpp"
 #include "sde/serialization_binary_file_fwd.hpp"
@@ -6,6 +6,9 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstdint>
+#include <cstring>
+#include <span>
 #include <vector>
 
 // SDE
@@ -41,6 +44,31 @@ struct load<IArchiveT, std::vector<ValueT, Allocator>>
   {
     std::size_t len{0};
     iar >> named{"len", len};
+    if constexpr (is_trivially_serializable_v<IArchiveT, ValueT> and requires { iar.read_view(len); })
+    {
+      // Construct directly from stream memory (e.g. a file mapping), skipping value-initialization and reads; lengths
+      // which the stream can not hold are checked first, so that the size of the view can not overflow
+      const bool fits = len <= (iar->available() / sizeof(ValueT));
+      if (const auto view = fits ? iar.read_view(len * sizeof(ValueT)) : std::span<const std::byte>{};
+          fits and (view.size() == len * sizeof(ValueT)))
+      {
+        if (reinterpret_cast<std::uintptr_t>(view.data()) % alignof(ValueT) == 0)
+        {
+          const auto* first = reinterpret_cast<const ValueT*>(view.data());
+          vec.assign(first, first + len);
+        }
+        else if (len > 0)
+        {
+          vec.resize(len);
+          std::memcpy(vec.data(), view.data(), view.size());
+        }
+        else
+        {
+          vec.clear();
+        }
+        return;
+      }
+    }
     vec.resize(len);
     if constexpr (is_trivially_serializable_v<IArchiveT, ValueT>)
     {
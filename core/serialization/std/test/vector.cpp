@@ -5,6 +5,9 @@
  */
 
 // C++ Standard Library
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -58,3 +61,72 @@ TEST(StdVector, NonTriviallySerializableElement)
     ASSERT_EQ(read, kExpected);
   }
 }
+
+TEST(StdVector, TriviallySerializableElementFromView)
+{
+  const std::vector<std::uint32_t> kExpected(1000, 7U);
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"first", kExpected}));
+    ASSERT_NO_THROW((oar << named{"second", kExpected}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    std::vector<std::uint32_t> first;
+    std::vector<std::uint32_t> second;
+    ASSERT_NO_THROW((iar >> named{"first", first}));
+    ASSERT_NO_THROW((iar >> named{"second", second}));
+    ASSERT_EQ(first, kExpected);
+    ASSERT_EQ(second, kExpected);
+    ASSERT_EQ(ims.available(), 0UL);
+  }
+}
+
+TEST(StdVector, TriviallySerializableElementTruncated)
+{
+  const std::vector<std::uint32_t> kExpected = {1, 2, 3, 4, 5};
+
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"value", kExpected}));
+  }
+
+  // Drop the last element
+  mem_istream ims_full{std::move(oms)};
+  std::vector<std::uint8_t> truncated(ims_full.available() - sizeof(std::uint32_t));
+  ims_full.read(truncated.data(), truncated.size());
+
+  mem_istream ims{std::move(truncated)};
+  {
+    binary_iarchive iar{ims};
+    std::vector<std::uint32_t> read;
+    ASSERT_NO_THROW((iar >> named{"value", read}));
+    ASSERT_EQ(read.size(), kExpected.size());
+    ASSERT_EQ(ims.available(), 0UL);
+  }
+}
+
+TEST(StdVector, TriviallySerializableElementLengthOverflow)
+{
+  // Length whose size in bytes wraps around to a small value, followed by that many bytes
+  const std::size_t kLength = (std::numeric_limits<std::size_t>::max() / sizeof(std::uint32_t)) + 3;
+  mem_ostream oms{};
+  {
+    binary_oarchive oar{oms};
+    ASSERT_NO_THROW((oar << named{"len", kLength}));
+    ASSERT_NO_THROW((oar << named{"data", std::uint64_t{0}}));
+  }
+
+  mem_istream ims{std::move(oms)};
+  {
+    binary_iarchive iar{ims};
+    std::vector<std::uint32_t> read;
+    ASSERT_THROW((iar >> named{"value", read}), std::length_error);
+    ASSERT_TRUE(read.empty());
+  }
+}
@@ -0,0 +1,123 @@
+// C++ Standard Library
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/serial/binary_archive.hpp"
+#include "sde/serial/file_istream.hpp"
+#include "sde/serial/file_ostream.hpp"
+#include "sde/serial/mmap_istream.hpp"
+#include "sde/serial/named.hpp"
+#include "sde/serial/std/vector.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+/// Stand-in for per-entity component data; many small, trivially serializable vectors
+constexpr std::size_t kEntityCount = 10000;
+constexpr std::size_t kEntityComponentLen = 16;
+
+void WriteTileMap(const char* path, std::size_t tile_count)
+{
+  std::vector<std::uint32_t> tile_indices(tile_count);
+  std::iota(tile_indices.begin(), tile_indices.end(), 0);
+  auto ofs = file_ostream::create(path, file_ostream::default_flags, file_ostream::default_block_size).value();
+  binary_oarchive oar{ofs};
+  oar << named{"tile_indices", tile_indices};
+}
+
+void WriteEntities(const char* path)
+{
+  const std::vector<float> component(kEntityComponentLen, 1.F);
+  auto ofs = file_ostream::create(path, file_ostream::default_flags, file_ostream::default_block_size).value();
+  binary_oarchive oar{ofs};
+  for (std::size_t e = 0; e < kEntityCount; ++e)
+  {
+    oar << named{"component", component};
+  }
+}
+
+template <typename IStreamT> void ReadTileMap(IStreamT& ifs)
+{
+  binary_iarchive iar{ifs};
+  std::vector<std::uint32_t> tile_indices;
+  iar >> named{"tile_indices", tile_indices};
+  benchmark::DoNotOptimize(tile_indices.data());
+}
+
+template <typename IStreamT> void ReadEntities(IStreamT& ifs)
+{
+  binary_iarchive iar{ifs};
+  std::vector<float> component;
+  for (std::size_t e = 0; e < kEntityCount; ++e)
+  {
+    iar >> named{"component", component};
+    benchmark::DoNotOptimize(component.data());
+  }
+}
+
+}  // namespace
+
+static void BM_TileMapLoadFile(benchmark::State& state)
+{
+  WriteTileMap("tile-map-load.bin", state.range(0) * state.range(0));
+  for (auto _ : state)
+  {
+    auto ifs = file_istream::create("tile-map-load.bin").value();
+    ReadTileMap(ifs);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) * sizeof(std::uint32_t));
+}
+BENCHMARK(BM_TileMapLoadFile)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_TileMapLoadMmap(benchmark::State& state)
+{
+  WriteTileMap("tile-map-load.bin", state.range(0) * state.range(0));
+  for (auto _ : state)
+  {
+    auto ifs = mmap_istream::create("tile-map-load.bin").value();
+    ReadTileMap(ifs);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(0) * sizeof(std::uint32_t));
+}
+BENCHMARK(BM_TileMapLoadMmap)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_EntityLoadFile(benchmark::State& state)
+{
+  WriteEntities("entity-load.bin");
+  for (auto _ : state)
+  {
+    auto ifs = file_istream::create("entity-load.bin").value();
+    ReadEntities(ifs);
+  }
+}
+BENCHMARK(BM_EntityLoadFile);
+
+static void BM_EntityLoadBufferedFile(benchmark::State& state)
+{
+  WriteEntities("entity-load.bin");
+  for (auto _ : state)
+  {
+    auto ifs =
+      file_istream::create("entity-load.bin", file_istream::default_flags, file_istream::default_block_size).value();
+    ReadEntities(ifs);
+  }
+}
+BENCHMARK(BM_EntityLoadBufferedFile);
+
+static void BM_EntityLoadMmap(benchmark::State& state)
+{
+  WriteEntities("entity-load.bin");
+  for (auto _ : state)
+  {
+    auto ifs = mmap_istream::create("entity-load.bin").value();
+    ReadEntities(ifs);
+  }
+}
+BENCHMARK(BM_EntityLoadMmap);
@@ -0,0 +1,80 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file compressed_format.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+namespace sde::serial
+{
+
+/**
+ * @brief Layout shared by compressed_ostream and compressed_istream
+ *
+ *        A compressed stream starts with a header (magic, block size) followed by blocks. Each block starts with its
+ *        uncompressed length, its stored length and a checksum of its uncompressed bytes. Blocks which do not
+ *        compress are stored as-is, which is marked by the high bit of the stored length. All integers are
+ *        little-endian.
+ */
+struct compressed_format
+{
+  /// Marks the start of a compressed stream
+  static constexpr std::uint8_t kMagic[4] = {'S', 'D', 'E', 'Z'};
+
+  /// Size of stream header, in bytes
+  static constexpr std::size_t kHeaderSize = sizeof(kMagic) + sizeof(std::uint32_t);
+
+  /// Size of block header, in bytes
+  static constexpr std::size_t kBlockHeaderSize = sizeof(std::uint32_t) * 2 + sizeof(std::uint64_t);
+
+  /// Set in stored length of blocks which are stored uncompressed
+  static constexpr std::uint32_t kStoredRawFlag = 0x80000000U;
+
+  /// Default uncompressed size of a block
+  static constexpr std::size_t kDefaultBlockSize = 64UL * 1024UL;
+
+  /// Largest allowed uncompressed size of a block
+  static constexpr std::size_t kMaxBlockSize = 4UL * 1024UL * 1024UL;
+
+  static void store_u32(std::uint8_t* dst, std::uint32_t value)
+  {
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+      dst[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+  }
+
+  static void store_u64(std::uint8_t* dst, std::uint64_t value)
+  {
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+      dst[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+  }
+
+  static std::uint32_t load_u32(const std::uint8_t* src)
+  {
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+      value |= static_cast<std::uint32_t>(src[i]) << (8 * i);
+    }
+    return value;
+  }
+
+  static std::uint64_t load_u64(const std::uint8_t* src)
+  {
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+      value |= static_cast<std::uint64_t>(src[i]) << (8 * i);
+    }
+    return value;
+  }
+};
+
+}  // namespace sde::serial
@@ -0,0 +1,197 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file compressed_istream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <optional>
+
+// SDE
+#include "sde/hash.hpp"
+#include "sde/serial/compressed_format.hpp"
+#include "sde/serial/compressed_stream_error.hpp"
+#include "sde/serial/istream.hpp"
+#include "sde/serial/lz_block.hpp"
+
+namespace sde::serial
+{
+
+/**
+ * @brief Input stream adaptor which decompresses bytes written by a compressed_ostream
+ *
+ *        Each block is checked against its checksum once decompressed. On any error the stream stops producing
+ *        bytes, so reads come up short, and compressed_istream::error reports what went wrong.
+ *
+ * @note  the wrapped stream must outlive this adaptor
+ */
+template <typename IStreamT> class compressed_istream final : public istream<compressed_istream<IStreamT>>
+{
+  friend class istream<compressed_istream<IStreamT>>;
+
+public:
+  explicit compressed_istream(istream<IStreamT>& is) : is_{std::addressof(is)}
+  {
+    std::uint8_t header[compressed_format::kHeaderSize];
+    if (is_->read(header, sizeof(header)) != sizeof(header) or
+        std::memcmp(header, compressed_format::kMagic, sizeof(compressed_format::kMagic)) != 0)
+    {
+      error_ = CompressedStreamError::kInvalidHeader;
+      return;
+    }
+
+    block_size_ = compressed_format::load_u32(header + sizeof(compressed_format::kMagic));
+    if ((block_size_ == 0) or (block_size_ > compressed_format::kMaxBlockSize))
+    {
+      error_ = CompressedStreamError::kInvalidHeader;
+      return;
+    }
+
+    raw_ = std::make_unique_for_overwrite<std::uint8_t[]>(block_size_);
+    compressed_ = std::make_unique_for_overwrite<std::uint8_t[]>(lz_block_compress_bound(block_size_));
+  }
+
+  /**
+   * @brief Returns the first error encountered, if any
+   */
+  const std::optional<CompressedStreamError>& error() const { return error_; }
+
+private:
+  compressed_istream(const compressed_istream&) = delete;
+  compressed_istream& operator=(const compressed_istream&) = delete;
+
+  /**
+   * @copydoc istream<compressed_istream>::read
+   */
+  std::size_t read_impl(void* ptr, std::size_t len)
+  {
+    auto* dst = static_cast<std::uint8_t*>(ptr);
+    std::size_t read_bytes = 0;
+    while (read_bytes < len)
+    {
+      if ((raw_pos_ == raw_len_) and !this->read_block())
+      {
+        break;
+      }
+      const std::size_t n = std::min(len - read_bytes, raw_len_ - raw_pos_);
+      std::memcpy(dst + read_bytes, raw_.get() + raw_pos_, n);
+      raw_pos_ += n;
+      read_bytes += n;
+    }
+    return read_bytes;
+  }
+
+  /**
+   * @copydoc istream<compressed_istream>::peek
+   */
+  char peek_impl()
+  {
+    if ((raw_pos_ == raw_len_) and !this->read_block())
+    {
+      return static_cast<char>(EOF);
+    }
+    return static_cast<char>(raw_[raw_pos_]);
+  }
+
+  /**
+   * @copydoc istream<compressed_istream>::available
+   *
+   * @note  total uncompressed size is not known up front; this is the number of decompressed bytes in the current
+   *        block plus the number of compressed bytes left in the wrapped stream, which is zero only once the stream
+   *        is exhausted
+   */
+  std::size_t available_impl() const
+  {
+    return error_.has_value() ? 0UL : ((raw_len_ - raw_pos_) + is_->available());
+  }
+
+  /**
+   * @brief Reads, decompresses and verifies the next block
+   */
+  bool read_block()
+  {
+    raw_len_ = 0;
+    raw_pos_ = 0;
+    if (error_.has_value() or (is_->available() == 0))
+    {
+      return false;
+    }
+
+    std::uint8_t header[compressed_format::kBlockHeaderSize];
+    if (is_->read(header, sizeof(header)) != sizeof(header))
+    {
+      error_ = CompressedStreamError::kTruncatedBlock;
+      return false;
+    }
+
+    const std::size_t raw_len = compressed_format::load_u32(header);
+    const std::uint32_t stored_len_code = compressed_format::load_u32(header + sizeof(std::uint32_t));
+    const std::uint64_t checksum = compressed_format::load_u64(header + 2 * sizeof(std::uint32_t));
+    const bool stored_raw = (stored_len_code & compressed_format::kStoredRawFlag) != 0;
+    const std::size_t stored_len = stored_len_code & ~compressed_format::kStoredRawFlag;
+
+    if ((raw_len == 0) or (raw_len > block_size_) or (stored_len > lz_block_compress_bound(raw_len)) or
+        (stored_raw and (stored_len != raw_len)))
+    {
+      error_ = CompressedStreamError::kInvalidBlock;
+      return false;
+    }
+
+    if (stored_raw)
+    {
+      if (is_->read(raw_.get(), raw_len) != raw_len)
+      {
+        error_ = CompressedStreamError::kTruncatedBlock;
+        return false;
+      }
+    }
+    else
+    {
+      if (is_->read(compressed_.get(), stored_len) != stored_len)
+      {
+        error_ = CompressedStreamError::kTruncatedBlock;
+        return false;
+      }
+      if (lz_block_decompress(compressed_.get(), stored_len, raw_.get(), raw_len) != raw_len)
+      {
+        error_ = CompressedStreamError::kInvalidBlock;
+        return false;
+      }
+    }
+
+    if (ComputeBytesHashValue(raw_.get(), raw_len) != checksum)
+    {
+      error_ = CompressedStreamError::kChecksumMismatch;
+      return false;
+    }
+
+    raw_len_ = raw_len;
+    return true;
+  }
+
+  /// Wrapped input stream
+  istream<IStreamT>* is_;
+  /// Largest uncompressed size of a block, from stream header
+  std::size_t block_size_ = 0;
+  /// Uncompressed bytes of the current block
+  std::unique_ptr<std::uint8_t[]> raw_;
+  /// Number of uncompressed bytes in the current block
+  std::size_t raw_len_ = 0;
+  /// Read position in the current block
+  std::size_t raw_pos_ = 0;
+  /// Compressed bytes of the current block
+  std::unique_ptr<std::uint8_t[]> compressed_;
+  /// First error encountered
+  std::optional<CompressedStreamError> error_;
+};
+
+template <typename IStreamT> compressed_istream(istream<IStreamT>& is) -> compressed_istream<IStreamT>;
+
+}  // namespace sde::serial
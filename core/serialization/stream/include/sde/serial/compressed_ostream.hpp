@@ -0,0 +1,156 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file compressed_ostream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// SDE
+#include "sde/hash.hpp"
+#include "sde/serial/compressed_format.hpp"
+#include "sde/serial/lz_block.hpp"
+#include "sde/serial/ostream.hpp"
+
+namespace sde::serial
+{
+
+/**
+ * @brief Output stream adaptor which compresses bytes before writing them to another stream
+ *
+ *        Bytes are gathered into blocks of \c block_size , each of which is compressed and written with a checksum
+ *        (see compressed_format). A partially filled block is written out on flush and on destruction.
+ *
+ * @note  the wrapped stream must outlive this adaptor
+ */
+template <typename OStreamT> class compressed_ostream final : public ostream<compressed_ostream<OStreamT>>
+{
+  friend class ostream<compressed_ostream<OStreamT>>;
+
+public:
+  explicit compressed_ostream(ostream<OStreamT>& os, std::size_t block_size = compressed_format::kDefaultBlockSize) :
+      os_{std::addressof(os)},
+      block_size_{std::min(std::max(block_size, std::size_t{1}), compressed_format::kMaxBlockSize)},
+      raw_{std::make_unique_for_overwrite<std::uint8_t[]>(block_size_)},
+      compressed_{std::make_unique_for_overwrite<std::uint8_t[]>(
+        compressed_format::kBlockHeaderSize + lz_block_compress_bound(block_size_))},
+      table_{std::make_unique_for_overwrite<std::uint32_t[]>(kLZBlockTableSize)}
+  {
+    std::uint8_t header[compressed_format::kHeaderSize];
+    std::memcpy(header, compressed_format::kMagic, sizeof(compressed_format::kMagic));
+    compressed_format::store_u32(header + sizeof(compressed_format::kMagic), static_cast<std::uint32_t>(block_size_));
+    os_->write(header, sizeof(header));
+  }
+
+  ~compressed_ostream() { this->write_block(); }
+
+  /**
+   * @brief Returns total number of uncompressed bytes written
+   */
+  std::size_t bytes_in() const { return bytes_in_; }
+
+  /**
+   * @brief Returns total number of bytes written to the wrapped stream, including headers
+   */
+  std::size_t bytes_out() const { return bytes_out_; }
+
+private:
+  compressed_ostream(const compressed_ostream&) = delete;
+  compressed_ostream& operator=(const compressed_ostream&) = delete;
+
+  /**
+   * @copydoc ostream<compressed_ostream>::write
+   */
+  std::size_t write_impl(const void* ptr, std::size_t len)
+  {
+    const auto* src = static_cast<const std::uint8_t*>(ptr);
+    std::size_t remaining = len;
+    while (remaining > 0)
+    {
+      const std::size_t n = std::min(remaining, block_size_ - raw_len_);
+      std::memcpy(raw_.get() + raw_len_, src, n);
+      raw_len_ += n;
+      src += n;
+      remaining -= n;
+      if (raw_len_ == block_size_)
+      {
+        this->write_block();
+      }
+    }
+    bytes_in_ += len;
+    return len;
+  }
+
+  /**
+   * @copydoc ostream<compressed_ostream>::flush
+   */
+  void flush_impl()
+  {
+    this->write_block();
+    os_->flush();
+  }
+
+  /**
+   * @brief Compresses and writes out all buffered bytes
+   */
+  void write_block()
+  {
+    if (raw_len_ == 0)
+    {
+      return;
+    }
+
+    std::uint8_t* const header = compressed_.get();
+    std::uint8_t* const payload = header + compressed_format::kBlockHeaderSize;
+
+    std::size_t stored_len =
+      lz_block_compress(raw_.get(), raw_len_, payload, lz_block_compress_bound(raw_len_), table_.get());
+    std::uint32_t stored_len_code = static_cast<std::uint32_t>(stored_len);
+    if ((stored_len == 0) or (stored_len >= raw_len_))
+    {
+      // Incompressible; store as-is
+      std::memcpy(payload, raw_.get(), raw_len_);
+      stored_len = raw_len_;
+      stored_len_code = static_cast<std::uint32_t>(stored_len) | compressed_format::kStoredRawFlag;
+    }
+
+    compressed_format::store_u32(header, static_cast<std::uint32_t>(raw_len_));
+    compressed_format::store_u32(header + sizeof(std::uint32_t), stored_len_code);
+    compressed_format::store_u64(header + 2 * sizeof(std::uint32_t), ComputeBytesHashValue(raw_.get(), raw_len_));
+
+    const std::size_t block_len = compressed_format::kBlockHeaderSize + stored_len;
+    bytes_out_ += os_->write(header, block_len);
+    raw_len_ = 0;
+  }
+
+  /// Wrapped output stream
+  ostream<OStreamT>* os_;
+  /// Uncompressed size of a full block
+  std::size_t block_size_;
+  /// Uncompressed bytes of the current block
+  std::unique_ptr<std::uint8_t[]> raw_;
+  /// Number of uncompressed bytes in the current block
+  std::size_t raw_len_ = 0;
+  /// Block header and compressed bytes of the current block
+  std::unique_ptr<std::uint8_t[]> compressed_;
+  /// Scratch space for lz_block_compress
+  std::unique_ptr<std::uint32_t[]> table_;
+  /// Total number of uncompressed bytes written
+  std::size_t bytes_in_ = 0;
+  /// Total number of bytes written to the wrapped stream
+  std::size_t bytes_out_ = compressed_format::kHeaderSize;
+};
+
+template <typename OStreamT> compressed_ostream(ostream<OStreamT>& os) -> compressed_ostream<OStreamT>;
+
+template <typename OStreamT>
+compressed_ostream(ostream<OStreamT>& os, std::size_t block_size) -> compressed_ostream<OStreamT>;
+
+}  // namespace sde::serial
@@ -0,0 +1,10 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file compressed_stream.hpp
+ */
+#pragma once
+
+// SDE
+#include "sde/serial/compressed_istream.hpp"
+#include "sde/serial/compressed_ostream.hpp"
@@ -0,0 +1,24 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file compressed_stream_error.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <iosfwd>
+
+namespace sde::serial
+{
+
+enum class CompressedStreamError
+{
+  kInvalidHeader,
+  kTruncatedBlock,
+  kInvalidBlock,
+  kChecksumMismatch,
+};
+
+std::ostream& operator<<(std::ostream& os, CompressedStreamError error);
+
+}  // namespace sde::serial
@@ -9,7 +9,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <memory>
+#include <span>
 
 // SDE
 #include "sde/expected.hpp"
@@ -19,12 +22,19 @@
 namespace sde::serial
 {
 
+/**
+ * @brief Input stream which reads from a native file handle
+ *
+ *        When created with a non-zero \c block_size , the file is read one block at a time into a user-space
+ *        buffer, from which small reads are served; reads which are at least as large as a block bypass the buffer.
+ *        Streams without a file handle read directly from a fixed region of memory (see mmap_istream).
+ */
 class file_handle_istream : public istream<file_handle_istream>
 {
   friend class istream<file_handle_istream>;
 
 public:
-  explicit file_handle_istream(std::FILE* file_handle);
+  explicit file_handle_istream(std::FILE* file_handle, std::size_t block_size = 0);
 
   file_handle_istream(file_handle_istream&& other);
   file_handle_istream& operator=(file_handle_istream&& other);
@@ -33,37 +43,103 @@ public:
 
   void swap(file_handle_istream& other);
 
+  /**
+   * @brief Moves the read position to \p pos bytes from the start of the file
+   *
+   * @note discards buffered bytes
+   */
+  bool seek(std::size_t pos);
+
+  /**
+   * @brief Returns the current read position
+   */
+  std::size_t tell() const { return file_bytes_total_ - file_bytes_remaining_; }
+
+  /**
+   * @brief Returns size of user-space buffer; zero if stream is unbuffered
+   */
+  std::size_t block_size() const { return buffer_capacity_; }
+
+  /**
+   * @brief Returns a view of the next \p len bytes and moves past them, without copying
+   *
+   *        Only succeeds when all \p len bytes are already in memory, which is always the case for memory-backed
+   *        streams. Views into a block buffer are invalidated by the next read.
+   *
+   * @return view of \p len bytes; an empty view, leaving the stream unchanged, if bytes are not available in memory
+   */
+  std::span<const std::byte> read_view(std::size_t len)
+  {
+    if (len > (buffer_len_ - buffer_pos_))
+    {
+      return {};
+    }
+    const std::span<const std::byte> view{buffer_ + buffer_pos_, len};
+    buffer_pos_ += len;
+    file_bytes_remaining_ -= len;
+    return view;
+  }
+
+protected:
+  /**
+   * @brief Sets up a memory-backed stream which reads from \p data
+   */
+  file_handle_istream(const std::byte* data, std::size_t len);
+
 private:
   /**
    * @copydoc istream<file_istream>::read
    */
   std::size_t read_impl(void* ptr, std::size_t len)
   {
-    const std::size_t read_bytes = std::fread(ptr, sizeof(std::byte), len, file_handle_);
-    file_bytes_remaining_ -= read_bytes;
-    return read_bytes;
+    // Bytes past the end of the buffer are left to read_underflow, so the copy never leaves the buffer
+    if (const std::size_t buffered = buffer_len_ - buffer_pos_; (len > 0) and (len <= buffered))
+    {
+      std::memcpy(ptr, buffer_ + buffer_pos_, len);
+      buffer_pos_ += len;
+      file_bytes_remaining_ -= len;
+      return len;
+    }
+    return (len == 0) ? 0 : read_underflow(ptr, len);
   }
 
   /**
    * @copydoc istream<file_istream>::peek
    */
-  char peek_impl()
-  {
-    char ch = std::getc(file_handle_);
-    std::ungetc(ch, file_handle_);
-    return ch;
-  }
+  char peek_impl();
 
   /**
    * @copydoc istream<file_istream>::available
    */
   std::size_t available_impl() const { return file_bytes_remaining_; }
 
+  /**
+   * @brief Handles reads which can not be served entirely from buffered bytes
+   */
+  std::size_t read_underflow(void* ptr, std::size_t len);
+
+  /**
+   * @brief Reads the next block from the file handle into the buffer
+   */
+  std::size_t fill_buffer();
+
+  /// Storage for user-space read buffer
+  std::unique_ptr<std::byte[]> buffer_storage_;
+  /// Bytes from which reads are served; either a user-space read buffer or the memory backing this stream
+  const std::byte* buffer_ = nullptr;
+  /// Size of user-space read buffer
+  std::size_t buffer_capacity_ = 0;
+  /// Number of valid bytes in user-space read buffer
+  std::size_t buffer_len_ = 0;
+  /// Read position in user-space read buffer
+  std::size_t buffer_pos_ = 0;
+  /// Total number of bytes in file
+  std::size_t file_bytes_total_ = 0;
   /// Number of remaining bytes in file
   std::size_t file_bytes_remaining_ = 0;
 
 protected:
-  /// Native file handle
+  /// Native file handle; nullptr for memory-backed streams
   std::FILE* file_handle_ = nullptr;
 };
 
@@ -78,8 +154,19 @@ public:
 
   static constexpr flags default_flags{.nobuf = true, .binary = true};
 
+  /// Recommended block size for buffered file input
+  static constexpr std::size_t default_block_size = 64UL * 1024UL;
+
+  /**
+   * @brief Opens a file for reading
+   *
+   * @param path  path to file
+   * @param fileopt  file open options
+   * @param block_size  size of user-space read buffer; reads are unbuffered if zero. When non-zero, stdio
+   *                    buffering is disabled regardless of \c fileopt.nobuf
+   */
   static expected<file_istream, FileStreamError>
-  create(const std::filesystem::path& path, const flags fileopt = default_flags);
+  create(const std::filesystem::path& path, const flags fileopt = default_flags, const std::size_t block_size = 0);
 
   file_istream(file_istream&& other) = default;
   file_istream& operator=(file_istream&& other) = default;
@@ -87,7 +174,7 @@ public:
   ~file_istream();
 
 private:
-  explicit file_istream(std::FILE* file_handle);
+  explicit file_istream(std::FILE* file_handle, std::size_t block_size);
 };
 
 }  // namespace sde::serial
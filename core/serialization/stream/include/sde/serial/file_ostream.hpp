@@ -9,7 +9,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <memory>
 
 // SDE
 #include "sde/expected.hpp"
@@ -19,14 +21,47 @@
 namespace sde::serial
 {
 
+/**
+ * @brief Output stream which writes to a native file handle
+ *
+ *        When created with a non-zero \c block_size , small writes are gathered into a user-space buffer of that
+ *        size and written to the file handle one block at a time; writes which are at least as large as a block
+ *        bypass the buffer. Buffered bytes are written out on flush, seek and destruction.
+ */
 class file_handle_ostream : public ostream<file_handle_ostream>
 {
   friend class ostream<file_handle_ostream>;
 
 public:
-  explicit file_handle_ostream(std::FILE* file_handle) : file_handle_{file_handle} {}
+  explicit file_handle_ostream(std::FILE* file_handle, std::size_t block_size = 0);
+
+  file_handle_ostream(file_handle_ostream&& other);
+
+  ~file_handle_ostream();
+
+  /**
+   * @brief Moves the write position to \p pos bytes from the start of the file
+   *
+   * @note flushes buffered bytes before moving
+   */
+  bool seek(std::size_t pos);
+
+  /**
+   * @brief Flushes buffered bytes, as flush() does
+   *
+   * @return false if any bytes written since the file was opened could not be written out
+   */
+  [[nodiscard]] bool try_flush();
+
+  /**
+   * @brief Returns the current write position, including buffered bytes
+   */
+  std::size_t tell() const;
 
-  file_handle_ostream(file_handle_ostream&& other) : file_handle_{other.file_handle_} { other.file_handle_ = nullptr; }
+  /**
+   * @brief Returns size of user-space buffer; zero if stream is unbuffered
+   */
+  std::size_t block_size() const { return buffer_capacity_; }
 
 private:
   /**
@@ -34,13 +69,40 @@ private:
    */
   std::size_t write_impl(const void* ptr, std::size_t len)
   {
-    return std::fwrite(ptr, sizeof(std::byte), len, file_handle_);
+    if (len == 0)
+    {
+      return 0;
+    }
+    else if ((buffer_capacity_ > 0) and (len <= (buffer_capacity_ - buffer_len_)))
+    {
+      std::memcpy(buffer_.get() + buffer_len_, ptr, len);
+      buffer_len_ += len;
+      return len;
+    }
+    return write_overflow(ptr, len);
   }
 
   /**
    * @copydoc ostream<file_ostream>::flush
    */
-  void flush_impl() { std::fflush(file_handle_); }
+  void flush_impl();
+
+  /**
+   * @brief Handles writes which do not fit in the remaining buffer space
+   */
+  std::size_t write_overflow(const void* ptr, std::size_t len);
+
+  /**
+   * @brief Writes all buffered bytes to the file handle
+   */
+  bool flush_buffer();
+
+  /// User-space write buffer
+  std::unique_ptr<std::byte[]> buffer_;
+  /// Size of user-space write buffer
+  std::size_t buffer_capacity_ = 0;
+  /// Number of bytes currently held in user-space write buffer
+  std::size_t buffer_len_ = 0;
 
 protected:
   /// Native file handle
@@ -60,15 +122,26 @@ public:
 
   static constexpr flags default_flags{.nobuf = true, .append = false, .binary = true};
 
+  /// Recommended block size for buffered file output
+  static constexpr std::size_t default_block_size = 64UL * 1024UL;
+
+  /**
+   * @brief Opens a file for writing
+   *
+   * @param path  path to file
+   * @param fileopt  file open options
+   * @param block_size  size of user-space write buffer; writes are unbuffered if zero. When non-zero, stdio
+   *                    buffering is disabled regardless of \c fileopt.nobuf
+   */
   static expected<file_ostream, FileStreamError>
-  create(const std::filesystem::path& path, const flags fileopt = default_flags);
+  create(const std::filesystem::path& path, const flags fileopt = default_flags, const std::size_t block_size = 0);
 
   file_ostream(file_ostream&& other) = default;
 
   ~file_ostream();
 
 private:
-  explicit file_ostream(std::FILE* file_handle);
+  explicit file_ostream(std::FILE* file_handle, std::size_t block_size);
 };
 
 }  // namespace sde::serial
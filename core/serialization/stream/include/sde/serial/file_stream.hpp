@@ -8,3 +8,4 @@
 // SDE
 #include "sde/serial/file_istream.hpp"
 #include "sde/serial/file_ostream.hpp"
+#include "sde/serial/mmap_istream.hpp"
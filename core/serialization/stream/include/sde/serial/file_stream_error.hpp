@@ -15,6 +15,7 @@ enum class FileStreamError
 {
   kFileDoesNotExist,
   kFileOpenFailed,
+  kFileMapFailed,
 };
 
 std::ostream& operator<<(std::ostream& os, FileStreamError error);
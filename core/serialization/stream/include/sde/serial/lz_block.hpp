@@ -0,0 +1,61 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file lz_block.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+
+namespace sde::serial
+{
+
+/**
+ * @brief Number of entries in the match table used by lz_block_compress
+ */
+static constexpr std::size_t kLZBlockTableSize = 1UL << 14UL;
+
+/**
+ * @brief Returns the largest possible compressed size of \p len input bytes
+ */
+constexpr std::size_t lz_block_compress_bound(std::size_t len) { return len + (len / 255UL) + 16UL; }
+
+/**
+ * @brief Compresses a block of bytes using an LZ4-style sequence encoding
+ *
+ *        Output is a series of sequences, each made up of a token byte (literal length and match length
+ *        nibbles), extended literal length bytes, literals, a 2-byte little-endian match offset and extended match
+ *        length bytes. The final sequence holds only literals.
+ *
+ * @param src  input bytes
+ * @param src_len  number of input bytes
+ * @param dst  output buffer
+ * @param dst_capacity  size of output buffer; always large enough if at least lz_block_compress_bound(src_len)
+ * @param table  scratch space of kLZBlockTableSize entries, reused between calls
+ *
+ * @return compressed size, in bytes; zero if output does not fit in \p dst_capacity
+ */
+std::size_t lz_block_compress(
+  const void* src,
+  std::size_t src_len,
+  void* dst,
+  std::size_t dst_capacity,
+  std::uint32_t* table);
+
+/**
+ * @brief Decompresses a block of bytes produced by lz_block_compress
+ *
+ *        Every read and write is bounds checked, so malformed input is safe to decode.
+ *
+ * @param src  compressed bytes
+ * @param src_len  number of compressed bytes
+ * @param dst  output buffer
+ * @param dst_capacity  size of output buffer
+ *
+ * @return decompressed size, in bytes; zero if \p src is malformed or output does not fit in \p dst_capacity
+ */
+std::size_t lz_block_decompress(const void* src, std::size_t src_len, void* dst, std::size_t dst_capacity);
+
+}  // namespace sde::serial
@@ -0,0 +1,58 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file mem_buffer_pool.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace sde::serial
+{
+
+/**
+ * @brief Keeps storage of finished memory streams around so that later streams can write without reallocating
+ *
+ *        A mem_ostream created from a pool takes its storage from the pool and hands it back when it is destroyed.
+ *        Storage may be handed back from any thread.
+ */
+class mem_buffer_pool
+{
+public:
+  /// Default number of buffers kept by a pool
+  static constexpr std::size_t default_max_buffers = 8;
+
+  explicit mem_buffer_pool(std::size_t max_buffers = default_max_buffers);
+
+  mem_buffer_pool(const mem_buffer_pool&) = delete;
+  mem_buffer_pool& operator=(const mem_buffer_pool&) = delete;
+
+  /**
+   * @brief Takes a buffer of at least \p min_size bytes from the pool, or allocates one if none is available
+   */
+  std::vector<std::uint8_t> acquire(std::size_t min_size);
+
+  /**
+   * @brief Hands \p buffer back to the pool; \p buffer is freed if the pool is full
+   */
+  void release(std::vector<std::uint8_t>&& buffer);
+
+  /**
+   * @brief Returns the number of buffers currently held by the pool
+   */
+  std::size_t size() const;
+
+private:
+  /// Maximum number of buffers held by the pool
+  std::size_t max_buffers_;
+  /// Protects buffers_
+  mutable std::mutex mutex_;
+  /// Buffers available for reuse
+  std::vector<std::vector<std::uint8_t>> buffers_;
+};
+
+}  // namespace sde::serial
@@ -6,8 +6,11 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <span>
 #include <vector>
 
 // SDE
@@ -16,8 +19,15 @@
 namespace sde::serial
 {
 
+class mem_buffer_pool;
 class mem_ostream;
 
+/**
+ * @brief Input stream which reads from a contiguous memory buffer
+ *
+ *        The stream either owns its buffer, or is a view over bytes owned elsewhere (for example, those written to a
+ *        mem_ostream which outlives the stream).
+ */
 class mem_istream final : public istream<mem_istream>
 {
   friend class istream<mem_istream>;
@@ -27,21 +37,65 @@ public:
 
   mem_istream(mem_istream&& other);
 
+  /**
+   * @brief Takes all bytes written to \p other ; storage is returned to the pool of \p other on destruction, if any
+   */
   mem_istream(mem_ostream&& other);
 
+  /**
+   * @brief Creates a stream which reads from \p view without copying; \p view must outlive the stream
+   */
+  explicit mem_istream(std::span<const std::byte> view);
+
   ~mem_istream();
 
+  /**
+   * @brief Returns a view of the next \p len bytes and moves past them, without copying
+   *
+   * @return view of \p len bytes; an empty view, leaving the stream unchanged, if fewer bytes are available
+   */
+  std::span<const std::byte> read_view(std::size_t len)
+  {
+    if (len > (len_ - pos_))
+    {
+      return {};
+    }
+    const std::span<const std::byte> view{reinterpret_cast<const std::byte*>(data_) + pos_, len};
+    pos_ += len;
+    return view;
+  }
+
+  /**
+   * @brief Moves the read position to \p pos bytes from the start of the stream
+   *
+   * @return false, leaving the stream unchanged, if \p pos is past the end of the stream
+   */
+  bool seek(std::size_t pos)
+  {
+    if (pos > len_)
+    {
+      return false;
+    }
+    pos_ = pos;
+    return true;
+  }
+
+  /**
+   * @brief Returns the read position, in bytes from the start of the stream
+   */
+  std::size_t tell() const { return pos_; }
+
 private:
   /**
    * @copydoc istream<mem_istream>::read
    */
   std::size_t read_impl(void* ptr, std::size_t len)
   {
-    if (len + pos_ > buffer_.size())
+    if (len + pos_ > len_)
     {
-      len = buffer_.size() - pos_;
+      len = len_ - pos_;
     }
-    std::memcpy(ptr, buffer_.data() + pos_, len);
+    std::memcpy(ptr, data_ + pos_, len);
     pos_ += len;
     return len;
   }
@@ -49,16 +103,25 @@ private:
   /**
    * @copydoc istream<mem_istream>::peek
    */
-  char peek_impl() { return buffer_[pos_]; }
+  char peek_impl() { return (pos_ < len_) ? static_cast<char>(data_[pos_]) : static_cast<char>(EOF); }
 
   /**
    * @copydoc istream<mem_istream>::available
    */
-  std::size_t available_impl() const { return buffer_.size() - pos_; }
+  std::size_t available_impl() const { return len_ - pos_; }
 
-  /// Byte stream buffer
+  /// Byte stream buffer, if owned by this stream
   std::vector<std::uint8_t> buffer_ = {};
 
+  /// Pool to return buffer to on destruction, if any
+  mem_buffer_pool* pool_ = nullptr;
+
+  /// Start of readable bytes
+  const std::uint8_t* data_ = nullptr;
+
+  /// Number of readable bytes
+  std::size_t len_ = 0;
+
   /// Current read-byte position
   std::size_t pos_ = 0;
 };
@@ -6,8 +6,10 @@
 #pragma once
 
 // C++ Standard Library
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <span>
 #include <vector>
 
 // SDE
@@ -16,6 +18,14 @@
 namespace sde::serial
 {
 
+class mem_buffer_pool;
+
+/**
+ * @brief Output stream which writes to a contiguous, growable memory buffer
+ *
+ *        Storage grows geometrically, so many small writes do not each reallocate. Storage may be taken from, and
+ *        returned to, a mem_buffer_pool to be reused by later streams.
+ */
 class mem_ostream final : public ostream<mem_ostream>
 {
   friend class ostream<mem_ostream>;
@@ -24,24 +34,75 @@ class mem_ostream final : public ostream<mem_ostream>
 public:
   mem_ostream(const std::size_t initial_capacity = 64UL);
 
+  /**
+   * @brief Creates a stream which takes its storage from \p pool and returns it on destruction
+   */
+  explicit mem_ostream(mem_buffer_pool& pool, const std::size_t initial_capacity = 64UL);
+
   mem_ostream(mem_ostream&& other);
 
+  mem_ostream& operator=(mem_ostream&& other);
+
   ~mem_ostream();
 
+  /**
+   * @brief Returns pointer to the start of all written bytes
+   */
+  const std::uint8_t* data() const { return buffer_.data(); }
+
+  /**
+   * @brief Returns the number of written bytes
+   */
+  std::size_t size() const { return len_; }
+
+  /**
+   * @brief Returns the number of bytes which can be written before storage grows
+   */
+  std::size_t capacity() const { return buffer_.size(); }
+
+  /**
+   * @brief Returns a view of all written bytes
+   */
+  std::span<const std::byte> view() const { return {reinterpret_cast<const std::byte*>(buffer_.data()), len_}; }
+
+  /**
+   * @brief Ensures that at least \p capacity bytes can be written without storage growing
+   */
+  void reserve(std::size_t capacity);
+
+  /**
+   * @brief Discards all written bytes, keeping storage for reuse
+   */
+  void clear() { len_ = 0; }
+
 private:
   /**
    * @copydoc ostream<mem_ostream>::write
    */
   std::size_t write_impl(const void* ptr, std::size_t len)
   {
-    const std::size_t pos = buffer_.size();
-    buffer_.resize(buffer_.size() + len);
-    std::memcpy(buffer_.data() + pos, ptr, len);
+    if (len_ + len > buffer_.size())
+    {
+      grow(len_ + len);
+    }
+    std::memcpy(buffer_.data() + len_, ptr, len);
+    len_ += len;
     return len;
   }
 
-  /// Byte stream buffer
+  /**
+   * @brief Grows storage to at least \p required bytes
+   */
+  void grow(std::size_t required);
+
+  /// Byte stream buffer; its size is the capacity of the stream
   std::vector<std::uint8_t> buffer_ = {};
+
+  /// Number of bytes written
+  std::size_t len_ = 0;
+
+  /// Pool to return buffer to on destruction, if any
+  mem_buffer_pool* pool_ = nullptr;
 };
 
 }  // namespace sde::serial
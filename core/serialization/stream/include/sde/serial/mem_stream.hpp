@@ -6,5 +6,6 @@
 #pragma once
 
 // SDE
+#include "sde/serial/mem_buffer_pool.hpp"
 #include "sde/serial/mem_istream.hpp"
 #include "sde/serial/mem_ostream.hpp"
@@ -0,0 +1,47 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file mmap_istream.hpp
+ */
+#pragma once
+
+// C++ Standard Library
+#include <cstddef>
+#include <filesystem>
+
+// SDE
+#include "sde/expected.hpp"
+#include "sde/serial/file_istream.hpp"
+#include "sde/serial/file_stream_error.hpp"
+
+namespace sde::serial
+{
+
+/**
+ * @brief Input stream which reads from a read-only memory mapping of a file
+ *
+ *        All file bytes are addressable, so file_handle_istream::read_view always succeeds for in-range reads and
+ *        views stay valid for the lifetime of the stream. Can be used anywhere a file_handle_istream is expected.
+ */
+class mmap_istream final : public file_handle_istream
+{
+public:
+  static expected<mmap_istream, FileStreamError> create(const std::filesystem::path& path);
+
+  mmap_istream(mmap_istream&& other);
+  mmap_istream& operator=(mmap_istream&& other);
+
+  ~mmap_istream();
+
+private:
+  mmap_istream(void* mapping, std::size_t mapping_len);
+
+  void swap(mmap_istream& other);
+
+  /// Start of file mapping; nullptr for empty files
+  void* mapping_ = nullptr;
+  /// Length of file mapping, in bytes
+  std::size_t mapping_len_ = 0;
+};
+
+}  // namespace sde::serial
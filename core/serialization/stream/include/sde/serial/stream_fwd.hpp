@@ -15,5 +15,6 @@ class file_handle_ostream;
 class file_handle_istream;
 class file_ostream;
 class file_istream;
+class mmap_istream;
 
 }  // namespace sde::serial
@@ -0,0 +1,23 @@
+// C++ Standard Library
+#include <ostream>
+
+// SDE
+#include "sde/logging.hpp"
+#include "sde/serial/compressed_stream_error.hpp"
+
+namespace sde::serial
+{
+
+std::ostream& operator<<(std::ostream& os, CompressedStreamError error)
+{
+  switch (error)
+  {
+    SDE_OS_ENUM_CASE(CompressedStreamError::kInvalidHeader)
+    SDE_OS_ENUM_CASE(CompressedStreamError::kTruncatedBlock)
+    SDE_OS_ENUM_CASE(CompressedStreamError::kInvalidBlock)
+    SDE_OS_ENUM_CASE(CompressedStreamError::kChecksumMismatch)
+  }
+  return os;
+}
+
+}  // namespace sde::serial
@@ -1,3 +1,7 @@
+// C++ Standard Library
+#include <algorithm>
+#include <utility>
+
 // SDE
 #include "sde/serial/file_istream.hpp"
 
@@ -18,7 +22,11 @@ file_handle_istream& file_handle_istream::operator=(file_handle_istream&& other)
   return *this;
 }
 
-file_handle_istream::file_handle_istream(std::FILE* file_handle) : file_bytes_remaining_{0}, file_handle_{file_handle}
+file_handle_istream::file_handle_istream(std::FILE* file_handle, std::size_t block_size) :
+    buffer_storage_{(block_size == 0) ? nullptr : std::make_unique_for_overwrite<std::byte[]>(block_size)},
+    buffer_{buffer_storage_.get()},
+    buffer_capacity_{block_size},
+    file_handle_{file_handle}
 {
   file_bytes_remaining_ = [file = file_handle_] {
     std::fpos_t previous_pos;
@@ -28,15 +36,121 @@ file_handle_istream::file_handle_istream(std::FILE* file_handle) : file_bytes_re
     std::fsetpos(file, &previous_pos);
     return size;
   }();
+  file_bytes_total_ = file_bytes_remaining_;
 }
 
+file_handle_istream::file_handle_istream(const std::byte* data, std::size_t len) :
+    buffer_{data},
+    buffer_capacity_{len},
+    buffer_len_{len},
+    buffer_pos_{0},
+    file_bytes_total_{len},
+    file_bytes_remaining_{len},
+    file_handle_{nullptr}
+{}
+
 void file_handle_istream::swap(file_handle_istream& other)
 {
+  std::swap(this->buffer_storage_, other.buffer_storage_);
+  std::swap(this->buffer_, other.buffer_);
+  std::swap(this->buffer_capacity_, other.buffer_capacity_);
+  std::swap(this->buffer_len_, other.buffer_len_);
+  std::swap(this->buffer_pos_, other.buffer_pos_);
   std::swap(this->file_handle_, other.file_handle_);
+  std::swap(this->file_bytes_total_, other.file_bytes_total_);
   std::swap(this->file_bytes_remaining_, other.file_bytes_remaining_);
 }
 
-expected<file_istream, FileStreamError> file_istream::create(const std::filesystem::path& path, const flags fileopt)
+bool file_handle_istream::seek(std::size_t pos)
+{
+  if (pos > file_bytes_total_)
+  {
+    return false;
+  }
+  else if (file_handle_ == nullptr)
+  {
+    buffer_pos_ = pos;
+  }
+  else if (std::fseek(file_handle_, static_cast<long>(pos), SEEK_SET) == 0)
+  {
+    buffer_len_ = 0;
+    buffer_pos_ = 0;
+  }
+  else
+  {
+    return false;
+  }
+  file_bytes_remaining_ = file_bytes_total_ - pos;
+  return true;
+}
+
+char file_handle_istream::peek_impl()
+{
+  if ((buffer_capacity_ == 0) and (file_handle_ != nullptr))
+  {
+    char ch = std::getc(file_handle_);
+    std::ungetc(ch, file_handle_);
+    return ch;
+  }
+  if ((buffer_pos_ == buffer_len_) and (this->fill_buffer() == 0))
+  {
+    return static_cast<char>(EOF);
+  }
+  return static_cast<char>(buffer_[buffer_pos_]);
+}
+
+std::size_t file_handle_istream::read_underflow(void* ptr, std::size_t len)
+{
+  auto* dst = static_cast<std::byte*>(ptr);
+
+  // Drain whatever is left in the buffer
+  const std::size_t buffered = buffer_len_ - buffer_pos_;
+  if (buffered > 0)
+  {
+    std::memcpy(dst, buffer_ + buffer_pos_, buffered);
+  }
+  buffer_pos_ = buffer_len_;
+
+  std::size_t read_bytes = buffered;
+  const std::size_t remaining = len - buffered;
+
+  if (file_handle_ == nullptr)
+  {
+    // Memory-backed streams have nothing left past the end of the buffer
+    file_bytes_remaining_ -= read_bytes;
+    return read_bytes;
+  }
+
+  // Large reads go straight to the destination, rather than through the buffer
+  if (remaining >= buffer_capacity_)
+  {
+    read_bytes += std::fread(dst + buffered, sizeof(std::byte), remaining, file_handle_);
+  }
+  else if (const std::size_t filled = this->fill_buffer(); filled > 0)
+  {
+    const std::size_t n = std::min(filled, remaining);
+    std::memcpy(dst + buffered, buffer_, n);
+    buffer_pos_ = n;
+    read_bytes += n;
+  }
+
+  file_bytes_remaining_ -= read_bytes;
+  return read_bytes;
+}
+
+std::size_t file_handle_istream::fill_buffer()
+{
+  if (file_handle_ == nullptr)
+  {
+    return 0;
+  }
+  buffer_len_ = std::fread(buffer_storage_.get(), sizeof(std::byte), buffer_capacity_, file_handle_);
+  buffer_pos_ = 0;
+  return buffer_len_;
+}
+
+expected<file_istream, FileStreamError>
+file_istream::create(const std::filesystem::path& path, const flags fileopt, const std::size_t block_size)
 {
   if (!std::filesystem::exists(path))
   {
@@ -49,14 +163,17 @@ expected<file_istream, FileStreamError> file_istream::create(const std::filesyst
     return make_unexpected(FileStreamError::kFileOpenFailed);
   }
 
-  if (fileopt.nobuf)
+  // User-space buffer replaces stdio buffering, rather than adding to it
+  if (fileopt.nobuf or (block_size > 0))
   {
     std::setvbuf(file_handle, nullptr, _IONBF, 0);
   }
-  return file_istream{file_handle};
+  return file_istream{file_handle, block_size};
 }
 
-file_istream::file_istream(std::FILE* file_handle) : file_handle_istream{file_handle} {}
+file_istream::file_istream(std::FILE* file_handle, std::size_t block_size) :
+    file_handle_istream{file_handle, block_size}
+{}
 
 file_istream::~file_istream()
 {
@@ -67,4 +184,4 @@ file_istream::~file_istream()
   std::fclose(file_handle_);
 }
 
-}  // namespace sde::serial
\ No newline at end of file
+}  // namespace sde::serial
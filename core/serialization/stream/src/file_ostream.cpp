@@ -1,7 +1,9 @@
+// C++ Standard Library
+#include <utility>
+
 // SDE
 #include "sde/serial/file_ostream.hpp"
 
-#include <iostream>
 namespace sde::serial
 {
 namespace  // anonymous
@@ -21,7 +23,81 @@ const char* flags_to_write_mode_str(file_ostream::flags fileopt)
 
 }  // namespace anonymous
 
-expected<file_ostream, FileStreamError> file_ostream::create(const std::filesystem::path& path, const flags fileopt)
+file_handle_ostream::file_handle_ostream(std::FILE* file_handle, std::size_t block_size) :
+    buffer_{(block_size == 0) ? nullptr : std::make_unique_for_overwrite<std::byte[]>(block_size)},
+    buffer_capacity_{block_size},
+    buffer_len_{0},
+    file_handle_{file_handle}
+{}
+
+file_handle_ostream::file_handle_ostream(file_handle_ostream&& other) :
+    buffer_{std::move(other.buffer_)},
+    buffer_capacity_{std::exchange(other.buffer_capacity_, 0)},
+    buffer_len_{std::exchange(other.buffer_len_, 0)},
+    file_handle_{std::exchange(other.file_handle_, nullptr)}
+{}
+
+file_handle_ostream::~file_handle_ostream()
+{
+  if (file_handle_ == nullptr)
+  {
+    return;
+  }
+  this->flush_buffer();
+}
+
+bool file_handle_ostream::seek(std::size_t pos)
+{
+  return this->flush_buffer() and (std::fseek(file_handle_, static_cast<long>(pos), SEEK_SET) == 0);
+}
+
+std::size_t file_handle_ostream::tell() const
+{
+  return static_cast<std::size_t>(std::ftell(file_handle_)) + buffer_len_;
+}
+
+void file_handle_ostream::flush_impl()
+{
+  this->flush_buffer();
+  std::fflush(file_handle_);
+}
+
+bool file_handle_ostream::try_flush()
+{
+  const bool flushed = this->flush_buffer();
+  return (std::fflush(file_handle_) == 0) and flushed and (std::ferror(file_handle_) == 0);
+}
+
+std::size_t file_handle_ostream::write_overflow(const void* ptr, std::size_t len)
+{
+  if (!this->flush_buffer())
+  {
+    return 0;
+  }
+
+  // Large writes go straight to the file, rather than being split into blocks
+  if (len >= buffer_capacity_)
+  {
+    return std::fwrite(ptr, sizeof(std::byte), len, file_handle_);
+  }
+
+  std::memcpy(buffer_.get(), ptr, len);
+  buffer_len_ = len;
+  return len;
+}
+
+bool file_handle_ostream::flush_buffer()
+{
+  if (buffer_len_ == 0)
+  {
+    return true;
+  }
+  const std::size_t written = std::fwrite(buffer_.get(), sizeof(std::byte), buffer_len_, file_handle_);
+  return std::exchange(buffer_len_, 0) == written;
+}
+
+expected<file_ostream, FileStreamError>
+file_ostream::create(const std::filesystem::path& path, const flags fileopt, const std::size_t block_size)
 {
   std::FILE* file_handle = std::fopen(path.c_str(), flags_to_write_mode_str(fileopt));
   if (file_handle == nullptr)
@@ -29,14 +105,17 @@ expected<file_ostream, FileStreamError> file_ostream::create(const std::filesyst
     return make_unexpected(FileStreamError::kFileOpenFailed);
   }
 
-  if (fileopt.nobuf)
+  // User-space buffer replaces stdio buffering, rather than adding to it
+  if (fileopt.nobuf or (block_size > 0))
   {
     std::setvbuf(file_handle, nullptr, _IONBF, 0);
   }
-  return file_ostream{file_handle};
+  return file_ostream{file_handle, block_size};
 }
 
-file_ostream::file_ostream(std::FILE* file_handle) : file_handle_ostream{file_handle} {}
+file_ostream::file_ostream(std::FILE* file_handle, std::size_t block_size) :
+    file_handle_ostream{file_handle, block_size}
+{}
 
 file_ostream::~file_ostream()
 {
@@ -44,7 +123,9 @@ file_ostream::~file_ostream()
   {
     return;
   }
+  this->flush();
   std::fclose(file_handle_);
+  file_handle_ = nullptr;
 }
 
-}  // namespace sde::serial
\ No newline at end of file
+}  // namespace sde::serial
@@ -14,6 +14,7 @@ std::ostream& operator<<(std::ostream& os, FileStreamError error)
   {
     SDE_OS_ENUM_CASE(FileStreamError::kFileDoesNotExist)
     SDE_OS_ENUM_CASE(FileStreamError::kFileOpenFailed)
+    SDE_OS_ENUM_CASE(FileStreamError::kFileMapFailed)
   }
   return os;
 }
@@ -0,0 +1,276 @@
+// C++ Standard Library
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+// SDE
+#include "sde/serial/lz_block.hpp"
+
+namespace sde::serial
+{
+namespace  // anonymous
+{
+
+/// Shortest encodable match
+constexpr std::size_t kMinMatch = 4;
+
+/// Input bytes at the end of a block which are always emitted as literals
+constexpr std::size_t kLastLiterals = 5;
+
+/// Matches are not started within this many bytes of the end of a block
+constexpr std::size_t kMatchFindLimit = 12;
+
+/// Largest encodable match offset
+constexpr std::size_t kMaxOffset = 65535;
+
+/// Nibble value which signals that a length continues in subsequent bytes
+constexpr std::size_t kLengthMask = 15;
+
+/// Controls how quickly the match finder skips ahead through incompressible input
+constexpr std::size_t kSkipTrigger = 6;
+
+inline std::uint32_t read32(const std::uint8_t* p)
+{
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline std::uint32_t hash32(std::uint32_t sequence)
+{
+  static constexpr int kHashShift = 32 - std::countr_zero(kLZBlockTableSize);
+  return (sequence * 2654435761U) >> kHashShift;
+}
+
+/// Writes extended length bytes for \p len , which has already had its nibble subtracted
+inline std::uint8_t* write_length(std::uint8_t* op, std::size_t len)
+{
+  while (len >= 255)
+  {
+    *op++ = 255;
+    len -= 255;
+  }
+  *op++ = static_cast<std::uint8_t>(len);
+  return op;
+}
+
+/// Reads extended length bytes; returns false if input runs out
+inline bool read_length(const std::uint8_t*& ip, const std::uint8_t* const iend, std::size_t& len)
+{
+  std::uint8_t b;
+  do
+  {
+    if (ip == iend)
+    {
+      return false;
+    }
+    b = *ip++;
+    len += b;
+  } while (b == 255);
+  return true;
+}
+
+/// Returns an upper bound on the size of a sequence with the given lengths
+constexpr std::size_t sequence_bound(std::size_t literal_len, std::size_t match_len)
+{
+  return 1 + (literal_len / 255 + 1) + literal_len + 2 + (match_len / 255 + 1);
+}
+
+/// Writes a sequence, or only literals if \p match_len is zero
+std::uint8_t* write_sequence(
+  std::uint8_t* op,
+  const std::uint8_t* literals,
+  std::size_t literal_len,
+  std::size_t offset,
+  std::size_t match_len)
+{
+  std::uint8_t* token = op++;
+  *token = static_cast<std::uint8_t>(std::min(literal_len, kLengthMask) << 4);
+  if (literal_len >= kLengthMask)
+  {
+    op = write_length(op, literal_len - kLengthMask);
+  }
+  if (literal_len > 0)
+  {
+    std::memcpy(op, literals, literal_len);
+    op += literal_len;
+  }
+
+  if (match_len == 0)
+  {
+    return op;
+  }
+
+  *op++ = static_cast<std::uint8_t>(offset & 0xFF);
+  *op++ = static_cast<std::uint8_t>(offset >> 8);
+
+  const std::size_t match_code = match_len - kMinMatch;
+  *token |= static_cast<std::uint8_t>(std::min(match_code, kLengthMask));
+  if (match_code >= kLengthMask)
+  {
+    op = write_length(op, match_code - kLengthMask);
+  }
+  return op;
+}
+
+}  // namespace anonymous
+
+std::size_t lz_block_compress(
+  const void* src,
+  std::size_t src_len,
+  void* dst,
+  std::size_t dst_capacity,
+  std::uint32_t* table)
+{
+  const auto* const istart = static_cast<const std::uint8_t*>(src);
+  auto* const ostart = static_cast<std::uint8_t*>(dst);
+  const std::uint8_t* const oend = ostart + dst_capacity;
+
+  std::uint8_t* op = ostart;
+  std::size_t anchor = 0;
+
+  if (src_len > kMatchFindLimit)
+  {
+    // Table holds (position + 1) of the last occurrence of each hashed 4-byte sequence; zero is empty
+    std::fill(table, table + kLZBlockTableSize, 0U);
+
+    const std::size_t match_find_limit = src_len - kMatchFindLimit;
+    const std::size_t match_end_limit = src_len - kLastLiterals;
+
+    std::size_t ip = 0;
+    std::size_t search_count = 1UL << kSkipTrigger;
+    while (ip < match_find_limit)
+    {
+      const std::uint32_t sequence = read32(istart + ip);
+      const std::uint32_t h = hash32(sequence);
+      const std::size_t candidate_plus_one = table[h];
+      table[h] = static_cast<std::uint32_t>(ip + 1);
+
+      if ((candidate_plus_one == 0) or ((ip + 1 - candidate_plus_one) > kMaxOffset) or
+          (read32(istart + candidate_plus_one - 1) != sequence))
+      {
+        // Step further ahead the longer we go without finding a match
+        ip += (search_count++ >> kSkipTrigger);
+        continue;
+      }
+      search_count = 1UL << kSkipTrigger;
+
+      std::size_t candidate = candidate_plus_one - 1;
+
+      // Extend match backwards, into pending literals
+      while ((ip > anchor) and (candidate > 0) and (istart[ip - 1] == istart[candidate - 1]))
+      {
+        --ip;
+        --candidate;
+      }
+
+      // Extend match forwards
+      std::size_t match_len = kMinMatch;
+      while (((ip + match_len) < match_end_limit) and (istart[candidate + match_len] == istart[ip + match_len]))
+      {
+        ++match_len;
+      }
+
+      const std::size_t literal_len = ip - anchor;
+      if (sequence_bound(literal_len, match_len) > static_cast<std::size_t>(oend - op))
+      {
+        return 0;
+      }
+      op = write_sequence(op, istart + anchor, literal_len, ip - candidate, match_len);
+
+      ip += match_len;
+      anchor = ip;
+
+      // Index a position inside the match, which helps find overlapping repeats
+      if (ip < match_find_limit)
+      {
+        table[hash32(read32(istart + ip - 2))] = static_cast<std::uint32_t>(ip - 2 + 1);
+      }
+    }
+  }
+
+  // Remaining input is emitted as literals
+  const std::size_t literal_len = src_len - anchor;
+  if (sequence_bound(literal_len, 0) > static_cast<std::size_t>(oend - op))
+  {
+    return 0;
+  }
+  op = write_sequence(op, istart + anchor, literal_len, 0, 0);
+  return static_cast<std::size_t>(op - ostart);
+}
+
+std::size_t lz_block_decompress(const void* src, std::size_t src_len, void* dst, std::size_t dst_capacity)
+{
+  const auto* ip = static_cast<const std::uint8_t*>(src);
+  const std::uint8_t* const iend = ip + src_len;
+  auto* const ostart = static_cast<std::uint8_t*>(dst);
+  std::uint8_t* op = ostart;
+  const std::uint8_t* const oend = ostart + dst_capacity;
+
+  while (ip < iend)
+  {
+    const std::uint8_t token = *ip++;
+
+    // Copy literals
+    std::size_t literal_len = token >> 4;
+    if ((literal_len == kLengthMask) and !read_length(ip, iend, literal_len))
+    {
+      return 0;
+    }
+    if ((literal_len > static_cast<std::size_t>(iend - ip)) or (literal_len > static_cast<std::size_t>(oend - op)))
+    {
+      return 0;
+    }
+    std::memcpy(op, ip, literal_len);
+    ip += literal_len;
+    op += literal_len;
+
+    // Last sequence holds only literals
+    if (ip == iend)
+    {
+      break;
+    }
+
+    // Copy match
+    if ((iend - ip) < 2)
+    {
+      return 0;
+    }
+    const std::size_t offset = static_cast<std::size_t>(ip[0]) | (static_cast<std::size_t>(ip[1]) << 8);
+    ip += 2;
+    if ((offset == 0) or (offset > static_cast<std::size_t>(op - ostart)))
+    {
+      return 0;
+    }
+
+    std::size_t match_len = token & kLengthMask;
+    if ((match_len == kLengthMask) and !read_length(ip, iend, match_len))
+    {
+      return 0;
+    }
+    match_len += kMinMatch;
+    if (match_len > static_cast<std::size_t>(oend - op))
+    {
+      return 0;
+    }
+
+    const std::uint8_t* match = op - offset;
+    if (offset >= match_len)
+    {
+      std::memcpy(op, match, match_len);
+      op += match_len;
+    }
+    else
+    {
+      // Overlapping match repeats the last offset bytes
+      for (std::size_t i = 0; i < match_len; ++i)
+      {
+        *op++ = *match++;
+      }
+    }
+  }
+
+  return static_cast<std::size_t>(op - ostart);
+}
+
+}  // namespace sde::serial
@@ -0,0 +1,64 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ *
+ * @file mem_buffer_pool.cpp
+ */
+
+// C++ Standard Library
+#include <algorithm>
+#include <utility>
+
+// SDE
+#include "sde/serial/mem_buffer_pool.hpp"
+
+namespace sde::serial
+{
+
+mem_buffer_pool::mem_buffer_pool(std::size_t max_buffers) : max_buffers_{max_buffers}
+{
+  buffers_.reserve(max_buffers_);
+}
+
+std::vector<std::uint8_t> mem_buffer_pool::acquire(std::size_t min_size)
+{
+  std::vector<std::uint8_t> buffer;
+  {
+    std::lock_guard lock{mutex_};
+    if (!buffers_.empty())
+    {
+      // Prefer largest buffer, which is least likely to need to grow again
+      const auto itr = std::max_element(std::begin(buffers_), std::end(buffers_), [](const auto& lhs, const auto& rhs) {
+        return lhs.size() < rhs.size();
+      });
+      buffer = std::move(*itr);
+      *itr = std::move(buffers_.back());
+      buffers_.pop_back();
+    }
+  }
+  if (buffer.size() < min_size)
+  {
+    buffer.resize(min_size);
+  }
+  return buffer;
+}
+
+void mem_buffer_pool::release(std::vector<std::uint8_t>&& buffer)
+{
+  if (buffer.empty())
+  {
+    return;
+  }
+  std::lock_guard lock{mutex_};
+  if (buffers_.size() < max_buffers_)
+  {
+    buffers_.push_back(std::move(buffer));
+  }
+}
+
+std::size_t mem_buffer_pool::size() const
+{
+  std::lock_guard lock{mutex_};
+  return buffers_.size();
+}
+
+}  // namespace sde::serial
@@ -8,18 +8,45 @@
 #include <utility>
 
 // SDE
+#include "sde/serial/mem_buffer_pool.hpp"
 #include "sde/serial/mem_istream.hpp"
 #include "sde/serial/mem_ostream.hpp"
 
 namespace sde::serial
 {
 
-mem_istream::mem_istream(std::vector<std::uint8_t>&& buffer) : buffer_{std::move(buffer)}, pos_{0} {}
-
-mem_istream::mem_istream(mem_istream&& other) : buffer_{std::move(other.buffer_)}, pos_{0} {}
+mem_istream::mem_istream(std::vector<std::uint8_t>&& buffer) :
+    buffer_{std::move(buffer)}, data_{buffer_.data()}, len_{buffer_.size()}, pos_{0}
+{}
+
+mem_istream::mem_istream(mem_istream&& other) :
+    buffer_{std::move(other.buffer_)},
+    pool_{std::exchange(other.pool_, nullptr)},
+    data_{std::exchange(other.data_, nullptr)},
+    len_{std::exchange(other.len_, 0)},
+    pos_{std::exchange(other.pos_, 0)}
+{}
+
+mem_istream::mem_istream(mem_ostream&& other) :
+    buffer_{std::move(other.buffer_)},
+    pool_{std::exchange(other.pool_, nullptr)},
+    data_{buffer_.data()},
+    len_{std::exchange(other.len_, 0)},
+    pos_{0}
+{
+  other.buffer_.clear();
+}
 
-mem_istream::mem_istream(mem_ostream&& other) : buffer_{std::move(other.buffer_)}, pos_{0} {}
+mem_istream::mem_istream(std::span<const std::byte> view) :
+    data_{reinterpret_cast<const std::uint8_t*>(view.data())}, len_{view.size()}, pos_{0}
+{}
 
-mem_istream::~mem_istream() = default;
+mem_istream::~mem_istream()
+{
+  if (pool_ != nullptr)
+  {
+    pool_->release(std::move(buffer_));
+  }
+}
 
-}  // namespace sde::serial
\ No newline at end of file
+}  // namespace sde::serial
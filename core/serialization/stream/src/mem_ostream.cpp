@@ -5,18 +5,72 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <memory>
 #include <utility>
 
 // SDE
+#include "sde/serial/mem_buffer_pool.hpp"
 #include "sde/serial/mem_ostream.hpp"
 
 namespace sde::serial
 {
 
-mem_ostream::mem_ostream(const std::size_t initial_capacity) { buffer_.reserve(initial_capacity); }
+mem_ostream::mem_ostream(const std::size_t initial_capacity) { buffer_.resize(initial_capacity); }
 
-mem_ostream::mem_ostream(mem_ostream&& other) : buffer_{std::move(other.buffer_)} {}
+mem_ostream::mem_ostream(mem_buffer_pool& pool, const std::size_t initial_capacity) :
+    buffer_{pool.acquire(initial_capacity)}, len_{0}, pool_{std::addressof(pool)}
+{}
 
-mem_ostream::~mem_ostream() = default;
+mem_ostream::mem_ostream(mem_ostream&& other) :
+    buffer_{std::move(other.buffer_)},
+    len_{std::exchange(other.len_, 0)},
+    pool_{std::exchange(other.pool_, nullptr)}
+{
+  other.buffer_.clear();
+}
+
+mem_ostream& mem_ostream::operator=(mem_ostream&& other)
+{
+  if (this != std::addressof(other))
+  {
+    if (pool_ != nullptr)
+    {
+      pool_->release(std::move(buffer_));
+    }
+    buffer_ = std::move(other.buffer_);
+    len_ = std::exchange(other.len_, 0);
+    pool_ = std::exchange(other.pool_, nullptr);
+    other.buffer_.clear();
+  }
+  return *this;
+}
+
+mem_ostream::~mem_ostream()
+{
+  if (pool_ != nullptr)
+  {
+    pool_->release(std::move(buffer_));
+  }
+}
+
+void mem_ostream::reserve(std::size_t capacity)
+{
+  if (capacity > buffer_.size())
+  {
+    buffer_.resize(capacity);
+  }
+}
+
+void mem_ostream::grow(std::size_t required)
+{
+  // Doubling keeps the total cost of copying existing bytes linear in the number of bytes written; only written bytes
+  // are copied, not the unused tail of the previous buffer
+  std::vector<std::uint8_t> grown;
+  grown.reserve(std::max(required, buffer_.size() * 2));
+  grown.insert(grown.end(), buffer_.data(), buffer_.data() + len_);
+  grown.resize(grown.capacity());
+  buffer_ = std::move(grown);
+}
 
-}  // namespace sde::serial
\ No newline at end of file
+}  // namespace sde::serial
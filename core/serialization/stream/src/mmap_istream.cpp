@@ -0,0 +1,91 @@
+// C++ Standard Library
+#include <utility>
+
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// SDE
+#include "sde/serial/mmap_istream.hpp"
+
+namespace sde::serial
+{
+
+expected<mmap_istream, FileStreamError> mmap_istream::create(const std::filesystem::path& path)
+{
+  if (!std::filesystem::exists(path))
+  {
+    return make_unexpected(FileStreamError::kFileDoesNotExist);
+  }
+
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return make_unexpected(FileStreamError::kFileOpenFailed);
+  }
+
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0)
+  {
+    ::close(fd);
+    return make_unexpected(FileStreamError::kFileOpenFailed);
+  }
+
+  // Zero-length mappings are not allowed
+  const std::size_t mapping_len = static_cast<std::size_t>(file_stat.st_size);
+  if (mapping_len == 0)
+  {
+    ::close(fd);
+    return mmap_istream{nullptr, 0};
+  }
+
+  // Archives are read in full, so fault in all pages up front
+  void* mapping = ::mmap(nullptr, mapping_len, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+
+  // Mapping holds its own reference to the file
+  ::close(fd);
+
+  if (mapping == MAP_FAILED)
+  {
+    return make_unexpected(FileStreamError::kFileMapFailed);
+  }
+
+  return mmap_istream{mapping, mapping_len};
+}
+
+mmap_istream::mmap_istream(void* mapping, std::size_t mapping_len) :
+    file_handle_istream{static_cast<const std::byte*>(mapping), mapping_len},
+    mapping_{mapping},
+    mapping_len_{mapping_len}
+{}
+
+mmap_istream::mmap_istream(mmap_istream&& other) : file_handle_istream{static_cast<const std::byte*>(nullptr), 0}
+{
+  this->swap(other);
+}
+
+mmap_istream& mmap_istream::operator=(mmap_istream&& other)
+{
+  this->swap(other);
+  return *this;
+}
+
+void mmap_istream::swap(mmap_istream& other)
+{
+  file_handle_istream::swap(other);
+  std::swap(this->mapping_, other.mapping_);
+  std::swap(this->mapping_len_, other.mapping_len_);
+}
+
+mmap_istream::~mmap_istream()
+{
+  if (mapping_ == nullptr)
+  {
+    return;
+  }
+  ::munmap(mapping_, mapping_len_);
+}
+
+}  // namespace sde::serial
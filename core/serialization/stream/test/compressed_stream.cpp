@@ -0,0 +1,354 @@
+/**
+ * @copyright 2024-present Brian Cairl
+ */
+
+// C++ Standard Library
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/serial/compressed_istream.hpp"
+#include "sde/serial/compressed_ostream.hpp"
+#include "sde/serial/lz_block.hpp"
+#include "sde/serial/mem_istream.hpp"
+#include "sde/serial/mem_ostream.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+std::vector<std::uint8_t> RandomBytes(std::size_t len, std::uint32_t seed)
+{
+  std::mt19937 gen{seed};
+  std::uniform_int_distribution<int> dist{0, 255};
+  std::vector<std::uint8_t> bytes(len);
+  for (auto& b : bytes)
+  {
+    b = static_cast<std::uint8_t>(dist(gen));
+  }
+  return bytes;
+}
+
+/// Bytes resembling serialized tile indices and entity state: repeats, runs and small integers
+std::vector<std::uint8_t> CompressibleBytes(std::size_t len, std::uint32_t seed)
+{
+  std::mt19937 gen{seed};
+  std::uniform_int_distribution<std::uint32_t> dist{0, 7};
+  std::vector<std::uint8_t> bytes;
+  bytes.reserve(len);
+  while (bytes.size() < len)
+  {
+    const std::uint32_t value = dist(gen);
+    const std::size_t run = 1 + dist(gen) * 4;
+    for (std::size_t i = 0; i < run and bytes.size() < len; ++i)
+    {
+      bytes.push_back(static_cast<std::uint8_t>(value));
+      bytes.push_back(0);
+    }
+  }
+  bytes.resize(len);
+  return bytes;
+}
+
+std::vector<std::uint8_t> CompressBlock(const std::vector<std::uint8_t>& raw)
+{
+  std::vector<std::uint32_t> table(kLZBlockTableSize);
+  std::vector<std::uint8_t> compressed(lz_block_compress_bound(raw.size()));
+  compressed.resize(lz_block_compress(raw.data(), raw.size(), compressed.data(), compressed.size(), table.data()));
+  return compressed;
+}
+
+std::vector<std::uint8_t> CompressStream(const std::vector<std::uint8_t>& raw, std::size_t block_size)
+{
+  mem_ostream oms;
+  {
+    compressed_ostream cos{oms, block_size};
+    cos.write(raw.data(), raw.size());
+  }
+  mem_istream ims{std::move(oms)};
+  std::vector<std::uint8_t> compressed(ims.available());
+  ims.read(compressed.data(), compressed.size());
+  return compressed;
+}
+
+}  // namespace
+
+TEST(LZBlock, RoundTripEmpty)
+{
+  const std::vector<std::uint8_t> raw;
+  const auto compressed = CompressBlock(raw);
+  ASSERT_FALSE(compressed.empty());
+
+  std::uint8_t out[1];
+  ASSERT_EQ(lz_block_decompress(compressed.data(), compressed.size(), out, sizeof(out)), 0UL);
+}
+
+TEST(LZBlock, RoundTripSizes)
+{
+  for (std::size_t len : {1UL, 4UL, 12UL, 13UL, 15UL, 16UL, 100UL, 255UL, 270UL, 4096UL, 65536UL, 200000UL})
+  {
+    for (const auto& raw : {RandomBytes(len, len), CompressibleBytes(len, len)})
+    {
+      const auto compressed = CompressBlock(raw);
+      ASSERT_FALSE(compressed.empty()) << "length: " << len;
+      ASSERT_LE(compressed.size(), lz_block_compress_bound(len));
+
+      std::vector<std::uint8_t> decompressed(len);
+      ASSERT_EQ(lz_block_decompress(compressed.data(), compressed.size(), decompressed.data(), len), len);
+      ASSERT_EQ(decompressed, raw) << "length: " << len;
+    }
+  }
+}
+
+TEST(LZBlock, CompressesRepeats)
+{
+  const std::vector<std::uint8_t> raw(100000, 42);
+  const auto compressed = CompressBlock(raw);
+  ASSERT_LT(compressed.size(), raw.size() / 100);
+
+  std::vector<std::uint8_t> decompressed(raw.size());
+  ASSERT_EQ(lz_block_decompress(compressed.data(), compressed.size(), decompressed.data(), raw.size()), raw.size());
+  ASSERT_EQ(decompressed, raw);
+}
+
+TEST(LZBlock, OutputTooSmall)
+{
+  const auto raw = CompressibleBytes(1000, 0);
+  const auto compressed = CompressBlock(raw);
+
+  std::vector<std::uint8_t> table(kLZBlockTableSize * sizeof(std::uint32_t));
+  std::vector<std::uint8_t> small(compressed.size() - 1);
+  ASSERT_EQ(
+    lz_block_compress(
+      raw.data(), raw.size(), small.data(), small.size(), reinterpret_cast<std::uint32_t*>(table.data())),
+    0UL);
+
+  std::vector<std::uint8_t> decompressed(raw.size() - 1);
+  ASSERT_EQ(lz_block_decompress(compressed.data(), compressed.size(), decompressed.data(), decompressed.size()), 0UL);
+}
+
+TEST(LZBlock, FuzzDecoderRandomInput)
+{
+  std::vector<std::uint8_t> out(4096);
+  for (std::uint32_t seed = 0; seed < 5000; ++seed)
+  {
+    const auto input = RandomBytes(1 + seed % 512, seed);
+    const std::size_t n = lz_block_decompress(input.data(), input.size(), out.data(), out.size());
+    ASSERT_LE(n, out.size());
+  }
+}
+
+TEST(LZBlock, FuzzDecoderMutatedInput)
+{
+  const auto raw = CompressibleBytes(4096, 1);
+  const auto compressed = CompressBlock(raw);
+
+  std::mt19937 gen{2};
+  std::uniform_int_distribution<std::size_t> position{0, compressed.size() - 1};
+  std::uniform_int_distribution<int> byte{0, 255};
+  std::uniform_int_distribution<std::size_t> mutation_count{1, 8};
+
+  std::vector<std::uint8_t> out(raw.size());
+  for (int trial = 0; trial < 5000; ++trial)
+  {
+    auto mutated = compressed;
+    for (std::size_t m = mutation_count(gen); m > 0; --m)
+    {
+      mutated[position(gen)] = static_cast<std::uint8_t>(byte(gen));
+    }
+    mutated.resize(position(gen) + 1);
+    const std::size_t n = lz_block_decompress(mutated.data(), mutated.size(), out.data(), out.size());
+    ASSERT_LE(n, out.size());
+  }
+}
+
+TEST(CompressedStream, RoundTrip)
+{
+  for (const std::size_t block_size : {16UL, 1000UL, 65536UL})
+  {
+    for (const auto& raw : {RandomBytes(100000, 3), CompressibleBytes(100000, 4)})
+    {
+      mem_ostream oms;
+      {
+        compressed_ostream cos{oms, block_size};
+
+        // Write in uneven pieces, which straddle block boundaries
+        std::size_t offset = 0;
+        for (std::size_t i = 1; offset < raw.size(); ++i)
+        {
+          const std::size_t len = std::min(i * 7, raw.size() - offset);
+          ASSERT_EQ(cos.write(raw.data() + offset, len), len);
+          offset += len;
+        }
+        ASSERT_EQ(cos.bytes_in(), raw.size());
+      }
+
+      mem_istream ims{std::move(oms)};
+      compressed_istream cis{ims};
+      ASSERT_FALSE(cis.error().has_value());
+
+      std::vector<std::uint8_t> readback(raw.size());
+      std::size_t offset = 0;
+      for (std::size_t i = 1; offset < raw.size(); ++i)
+      {
+        const std::size_t len = std::min(i * 13, raw.size() - offset);
+        ASSERT_EQ(cis.read(readback.data() + offset, len), len);
+        offset += len;
+      }
+      ASSERT_EQ(readback, raw) << "block size: " << block_size;
+      ASSERT_EQ(cis.available(), 0UL);
+      ASSERT_FALSE(cis.error().has_value());
+    }
+  }
+}
+
+TEST(CompressedStream, CompressibleDataShrinks)
+{
+  const auto raw = CompressibleBytes(1 << 20, 5);
+  const auto compressed = CompressStream(raw, compressed_format::kDefaultBlockSize);
+  ASSERT_LT(compressed.size(), raw.size() / 2);
+}
+
+TEST(CompressedStream, IncompressibleDataStoredRaw)
+{
+  const auto raw = RandomBytes(1 << 16, 6);
+  const auto compressed = CompressStream(raw, compressed_format::kDefaultBlockSize);
+  ASSERT_EQ(compressed.size(), raw.size() + compressed_format::kHeaderSize + compressed_format::kBlockHeaderSize);
+}
+
+TEST(CompressedStream, FlushWritesPartialBlock)
+{
+  const auto raw = CompressibleBytes(100, 7);
+  mem_ostream oms;
+  compressed_ostream cos{oms, 1024};
+  cos.write(raw.data(), raw.size());
+  ASSERT_EQ(cos.bytes_out(), compressed_format::kHeaderSize);
+  cos.flush();
+  ASSERT_GT(cos.bytes_out(), compressed_format::kHeaderSize);
+}
+
+TEST(CompressedStream, Peek)
+{
+  const std::vector<std::uint8_t> raw = {'a', 'b'};
+  mem_istream ims{CompressStream(raw, 1)};
+  compressed_istream cis{ims};
+  ASSERT_EQ(cis.peek(), 'a');
+
+  char ch;
+  cis.read(&ch, 1);
+  ASSERT_EQ(cis.peek(), 'b');
+  cis.read(&ch, 1);
+  ASSERT_EQ(cis.peek(), static_cast<char>(EOF));
+}
+
+TEST(CompressedStream, InvalidHeader)
+{
+  mem_istream ims{RandomBytes(100, 8)};
+  compressed_istream cis{ims};
+  ASSERT_EQ(cis.error(), CompressedStreamError::kInvalidHeader);
+
+  std::uint8_t buf[10];
+  ASSERT_EQ(cis.read(buf, sizeof(buf)), 0UL);
+  ASSERT_EQ(cis.available(), 0UL);
+}
+
+TEST(CompressedStream, DetectsCorruptChecksum)
+{
+  const auto raw = CompressibleBytes(10000, 9);
+  auto compressed = CompressStream(raw, compressed_format::kDefaultBlockSize);
+
+  // Flip a bit in the checksum of the first block
+  compressed[compressed_format::kHeaderSize + 2 * sizeof(std::uint32_t)] ^= 0x10;
+
+  mem_istream ims{std::move(compressed)};
+  compressed_istream cis{ims};
+  std::vector<std::uint8_t> readback(raw.size());
+  ASSERT_EQ(cis.read(readback.data(), readback.size()), 0UL);
+  ASSERT_EQ(cis.error(), CompressedStreamError::kChecksumMismatch);
+}
+
+TEST(CompressedStream, DetectsCorruptLiteral)
+{
+  const auto raw = RandomBytes(64, 14);
+  std::vector<std::uint8_t> repeated;
+  for (int i = 0; i < 100; ++i)
+  {
+    repeated.insert(repeated.end(), raw.begin(), raw.end());
+  }
+  auto compressed = CompressStream(repeated, compressed_format::kDefaultBlockSize);
+
+  // First sequence starts with literals copied from the input
+  const std::size_t first_literal = compressed_format::kHeaderSize + compressed_format::kBlockHeaderSize + 2;
+  ASSERT_EQ(compressed[first_literal], raw[0]);
+  compressed[first_literal] ^= 0x01;
+
+  mem_istream ims{std::move(compressed)};
+  compressed_istream cis{ims};
+  std::vector<std::uint8_t> readback(repeated.size());
+  ASSERT_EQ(cis.read(readback.data(), readback.size()), 0UL);
+  ASSERT_EQ(cis.error(), CompressedStreamError::kChecksumMismatch);
+}
+
+TEST(CompressedStream, DetectsCorruptStoredBlock)
+{
+  const auto raw = RandomBytes(1000, 10);
+  auto compressed = CompressStream(raw, compressed_format::kDefaultBlockSize);
+  compressed.back() ^= 0x01;
+
+  mem_istream ims{std::move(compressed)};
+  compressed_istream cis{ims};
+  std::vector<std::uint8_t> readback(raw.size());
+  ASSERT_EQ(cis.read(readback.data(), readback.size()), 0UL);
+  ASSERT_EQ(cis.error(), CompressedStreamError::kChecksumMismatch);
+}
+
+TEST(CompressedStream, DetectsTruncation)
+{
+  const auto raw = CompressibleBytes(10000, 11);
+  auto compressed = CompressStream(raw, 4096);
+  compressed.resize(compressed.size() - 10);
+
+  mem_istream ims{std::move(compressed)};
+  compressed_istream cis{ims};
+  std::vector<std::uint8_t> readback(raw.size());
+  ASSERT_EQ(cis.read(readback.data(), readback.size()), 8192UL);
+  ASSERT_EQ(cis.error(), CompressedStreamError::kTruncatedBlock);
+}
+
+TEST(CompressedStream, FuzzMutatedStream)
+{
+  const auto raw = CompressibleBytes(20000, 12);
+  const auto compressed = CompressStream(raw, 4096);
+
+  std::mt19937 gen{13};
+  std::uniform_int_distribution<std::size_t> position{0, compressed.size() - 1};
+  std::uniform_int_distribution<int> byte{0, 255};
+
+  std::vector<std::uint8_t> readback(raw.size());
+  for (int trial = 0; trial < 1000; ++trial)
+  {
+    auto mutated = compressed;
+    mutated[position(gen)] = static_cast<std::uint8_t>(byte(gen));
+
+    mem_istream ims{std::move(mutated)};
+    compressed_istream cis{ims};
+    const std::size_t n = cis.read(readback.data(), readback.size());
+
+    // Any change to the stream is either caught, or decodes to the same bytes (e.g. an equivalent match offset)
+    if (!cis.error().has_value())
+    {
+      ASSERT_EQ(n, raw.size());
+      ASSERT_EQ(readback, raw);
+    }
+    else
+    {
+      ASSERT_LT(n, raw.size());
+    }
+  }
+}
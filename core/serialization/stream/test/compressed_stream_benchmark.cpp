@@ -0,0 +1,145 @@
+// C++ Standard Library
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/serial/binary_archive.hpp"
+#include "sde/serial/compressed_istream.hpp"
+#include "sde/serial/compressed_ostream.hpp"
+#include "sde/serial/mem_istream.hpp"
+#include "sde/serial/mem_ostream.hpp"
+#include "sde/serial/named.hpp"
+#include "sde/serial/std/vector.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+struct Position
+{
+  float x;
+  float y;
+};
+
+struct Sprite
+{
+  std::uint32_t texture_handle;
+  std::uint32_t frame;
+  float scale;
+};
+
+}  // namespace
+
+namespace sde::serial
+{
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, Position> : std::true_type
+{};
+
+template <typename ArchiveT> struct is_trivially_serializable<ArchiveT, Sprite> : std::true_type
+{};
+
+}  // namespace sde::serial
+
+namespace
+{
+
+/**
+ * @brief Serializes a registry laid out like an entt snapshot of a typical scene
+ *
+ *        Entity ids, a few component pools and a tile map, written through a binary archive
+ */
+std::vector<std::uint8_t> SerializedRegistry(std::size_t entity_count)
+{
+  std::mt19937 gen{0};
+  std::uniform_real_distribution<float> coordinate{-100.F, 100.F};
+  std::uniform_int_distribution<std::uint32_t> texture{1, 8};
+
+  std::vector<std::uint32_t> entities(entity_count);
+  std::vector<Position> positions(entity_count);
+  std::vector<Position> velocities(entity_count, Position{0.F, 0.F});
+  std::vector<Sprite> sprites(entity_count);
+  for (std::size_t e = 0; e < entity_count; ++e)
+  {
+    entities[e] = static_cast<std::uint32_t>(e);
+    positions[e] = {coordinate(gen), coordinate(gen)};
+    sprites[e] = {texture(gen), 0, 1.F};
+    if (e % 8 == 0)
+    {
+      velocities[e] = {coordinate(gen) * 0.01F, 0.F};
+    }
+  }
+
+  // Tile maps are mostly a handful of repeated indices
+  std::vector<std::uint32_t> tile_indices(256 * 256);
+  for (std::size_t i = 0; i < tile_indices.size(); ++i)
+  {
+    tile_indices[i] = ((i / 256) % 16 < 2) ? 3U : ((i % 17 == 0) ? 5U : 1U);
+  }
+
+  mem_ostream oms;
+  {
+    binary_oarchive oar{oms};
+    oar << named{"entities", entities};
+    oar << named{"positions", positions};
+    oar << named{"velocities", velocities};
+    oar << named{"sprites", sprites};
+    oar << named{"tile_indices", tile_indices};
+  }
+  mem_istream ims{std::move(oms)};
+  std::vector<std::uint8_t> bytes(ims.available());
+  ims.read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+std::vector<std::uint8_t> Compress(const std::vector<std::uint8_t>& raw)
+{
+  mem_ostream oms;
+  {
+    compressed_ostream cos{oms};
+    cos.write(raw.data(), raw.size());
+  }
+  mem_istream ims{std::move(oms)};
+  std::vector<std::uint8_t> bytes(ims.available());
+  ims.read(bytes.data(), bytes.size());
+  return bytes;
+}
+
+}  // namespace
+
+static void BM_CompressRegistry(benchmark::State& state)
+{
+  const auto raw = SerializedRegistry(state.range(0));
+  std::size_t compressed_size = 0;
+  for (auto _ : state)
+  {
+    mem_ostream oms{raw.size()};
+    compressed_ostream cos{oms};
+    cos.write(raw.data(), raw.size());
+    cos.flush();
+    compressed_size = cos.bytes_out();
+  }
+  state.SetBytesProcessed(state.iterations() * raw.size());
+  state.counters["ratio"] = static_cast<double>(raw.size()) / static_cast<double>(compressed_size);
+}
+BENCHMARK(BM_CompressRegistry)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+
+static void BM_DecompressRegistry(benchmark::State& state)
+{
+  const auto raw = SerializedRegistry(state.range(0));
+  const auto compressed = Compress(raw);
+  std::vector<std::uint8_t> readback(raw.size());
+  for (auto _ : state)
+  {
+    mem_istream ims{std::vector<std::uint8_t>{compressed}};
+    compressed_istream cis{ims};
+    benchmark::DoNotOptimize(cis.read(readback.data(), readback.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * raw.size());
+}
+BENCHMARK(BM_DecompressRegistry)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
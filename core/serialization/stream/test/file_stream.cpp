@@ -3,9 +3,13 @@
  */
 
 // C++ Standard Library
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 // GTest
 #include <gtest/gtest.h>
@@ -13,6 +17,7 @@
 // SDE
 #include "sde/serial/file_istream.hpp"
 #include "sde/serial/file_ostream.hpp"
+#include "sde/serial/mmap_istream.hpp"
 
 
 TEST(FileInputStream, CannotOpenFile)
@@ -59,13 +64,12 @@ TEST(FileInputStream, ReadTooMany)
     sde::serial::file_istream::create("core/serialization/stream/test/resources/file_stream.dat", {.nobuf = true})
       .value();
 
-  char buf[23];
-  ifs.read(buf, sizeof(buf) + 10);
-  buf[sizeof(buf) - 1] = '\0';
+  // Buffer holds all requested bytes, more than are left in the file
+  char buf[33] = {};
+  static const char* TARGET_VALUE = "this is just a sample\n";
+  ASSERT_EQ(ifs.read(buf, sizeof(buf)), std::strlen(TARGET_VALUE));
 
   ASSERT_EQ(ifs.available(), 0UL);
-
-  static const char* TARGET_VALUE = "this is just a sample\n";
   ASSERT_EQ(std::memcmp(buf, TARGET_VALUE, std::strlen(TARGET_VALUE)), 0);
 }
 
@@ -103,3 +107,255 @@ TEST(FileStream, WriteThenRead)
 
   ASSERT_EQ(std::memcmp(write_buf, read_buf, sizeof(write_buf)), 0);
 }
+
+
+namespace
+{
+
+std::vector<std::uint8_t> MakePayload(std::size_t len)
+{
+  std::vector<std::uint8_t> payload(len);
+  for (std::size_t i = 0; i < len; ++i)
+  {
+    payload[i] = static_cast<std::uint8_t>((i * 31U) ^ (i >> 8U));
+  }
+  return payload;
+}
+
+}  // namespace
+
+
+TEST(BufferedFileStream, RoundTripMixedWriteSizes)
+{
+  static constexpr std::size_t kBlockSize = 64;
+  const auto payload = MakePayload(4096);
+
+  // Chunk lengths straddle, match and exceed the block size
+  const std::vector<std::size_t> chunk_lengths = {1, 7, 8, 63, 64, 65, 3, 200, 1, 128};
+  {
+    auto ofs = sde::serial::file_ostream::create("buffered-readback.bin", {.nobuf = true}, kBlockSize).value();
+    ASSERT_EQ(ofs.block_size(), kBlockSize);
+    std::size_t offset = 0;
+    for (std::size_t i = 0; offset < payload.size(); ++i)
+    {
+      const std::size_t len = std::min(chunk_lengths[i % chunk_lengths.size()], payload.size() - offset);
+      ASSERT_EQ(ofs.write(payload.data() + offset, len), len);
+      offset += len;
+      ASSERT_EQ(ofs.tell(), offset);
+    }
+  }
+
+  auto ifs = sde::serial::file_istream::create("buffered-readback.bin", {.nobuf = true}, kBlockSize).value();
+  ASSERT_EQ(ifs.available(), payload.size());
+
+  std::vector<std::uint8_t> readback(payload.size());
+  std::size_t offset = 0;
+  for (std::size_t i = 0; offset < payload.size(); ++i)
+  {
+    const std::size_t len = std::min(chunk_lengths[(i + 3) % chunk_lengths.size()], payload.size() - offset);
+    ASSERT_EQ(ifs.read(readback.data() + offset, len), len);
+    offset += len;
+    ASSERT_EQ(ifs.available(), payload.size() - offset);
+  }
+  ASSERT_EQ(readback, payload);
+}
+
+TEST(BufferedFileStream, FlushMakesBytesVisible)
+{
+  char write_buf[] = "buffered";
+  auto ofs = sde::serial::file_ostream::create("buffered-flush.bin", {.nobuf = true}, 1024).value();
+  ASSERT_EQ(ofs.write(write_buf), sizeof(write_buf));
+  ASSERT_EQ(std::filesystem::file_size("buffered-flush.bin"), 0UL);
+
+  ofs.flush();
+  ASSERT_EQ(std::filesystem::file_size("buffered-flush.bin"), sizeof(write_buf));
+
+  char read_buf[sizeof(write_buf)];
+  auto ifs = sde::serial::file_istream::create("buffered-flush.bin").value();
+  ASSERT_EQ(ifs.read(read_buf), sizeof(write_buf));
+  ASSERT_EQ(std::memcmp(write_buf, read_buf, sizeof(write_buf)), 0);
+}
+
+TEST(BufferedFileStream, TryFlushReportsWriteFailure)
+{
+  if (!std::filesystem::exists("/dev/full"))
+  {
+    GTEST_SKIP() << "/dev/full not available";
+  }
+  char write_buf[] = "buffered";
+  auto ofs = sde::serial::file_ostream::create("/dev/full", {.nobuf = true}, 1024).value();
+  ASSERT_EQ(ofs.write(write_buf), sizeof(write_buf));
+  ASSERT_FALSE(ofs.try_flush());
+}
+
+TEST(BufferedFileStream, MoveKeepsBufferedBytes)
+{
+  char write_buf[] = "moved";
+  {
+    auto ofs = sde::serial::file_ostream::create("buffered-move.bin", {.nobuf = true}, 1024).value();
+    ASSERT_EQ(ofs.write(write_buf), sizeof(write_buf));
+    sde::serial::file_ostream ofs_move{std::move(ofs)};
+  }
+  ASSERT_EQ(std::filesystem::file_size("buffered-move.bin"), sizeof(write_buf));
+}
+
+TEST(BufferedFileStream, SeekFlushesWrites)
+{
+  const auto payload = MakePayload(100);
+  {
+    auto ofs = sde::serial::file_ostream::create("buffered-seek.bin", {.nobuf = true}, 32).value();
+    ofs.write(payload.data(), payload.size());
+
+    // Overwrite a byte which is still buffered
+    const std::uint8_t marker = 0xFF;
+    ASSERT_TRUE(ofs.seek(90));
+    ofs.write(&marker, sizeof(marker));
+    ASSERT_EQ(ofs.tell(), 91UL);
+  }
+
+  auto ifs = sde::serial::file_istream::create("buffered-seek.bin", {.nobuf = true}, 32).value();
+  ASSERT_EQ(ifs.available(), payload.size());
+
+  std::uint8_t value = 0;
+  ASSERT_TRUE(ifs.seek(90));
+  ASSERT_EQ(ifs.tell(), 90UL);
+  ASSERT_EQ(ifs.available(), 10UL);
+  ifs.read(&value, sizeof(value));
+  ASSERT_EQ(value, 0xFF);
+
+  // Seek backwards discards buffered bytes
+  ASSERT_TRUE(ifs.seek(5));
+  ifs.read(&value, sizeof(value));
+  ASSERT_EQ(value, payload[5]);
+  ASSERT_EQ(ifs.available(), 94UL);
+
+  ASSERT_FALSE(ifs.seek(payload.size() + 1));
+}
+
+TEST(BufferedFileStream, PeekDoesNotConsume)
+{
+  char write_buf[] = "ab";
+  {
+    auto ofs = sde::serial::file_ostream::create("buffered-peek.bin", {.nobuf = true}, 16).value();
+    ofs.write(write_buf);
+  }
+
+  auto ifs = sde::serial::file_istream::create("buffered-peek.bin", {.nobuf = true}, 16).value();
+  ASSERT_EQ(ifs.peek(), 'a');
+  ASSERT_EQ(ifs.peek(), 'a');
+
+  char ch;
+  ifs.read(&ch, 1);
+  ASSERT_EQ(ch, 'a');
+  ASSERT_EQ(ifs.peek(), 'b');
+  ASSERT_EQ(ifs.available(), 2UL);
+}
+
+TEST(BufferedFileStream, ReadTooMany)
+{
+  char write_buf[] = "short payload";
+  {
+    auto ofs = sde::serial::file_ostream::create("buffered-short.bin", {.nobuf = true}, 8).value();
+    ofs.write(write_buf);
+  }
+
+  char read_buf[sizeof(write_buf) + 10];
+  auto ifs = sde::serial::file_istream::create("buffered-short.bin", {.nobuf = true}, 8).value();
+  ASSERT_EQ(ifs.read(read_buf, sizeof(read_buf)), sizeof(write_buf));
+  ASSERT_EQ(ifs.available(), 0UL);
+  ASSERT_EQ(std::memcmp(write_buf, read_buf, sizeof(write_buf)), 0);
+}
+
+
+TEST(MmapInputStream, CannotOpenFile)
+{
+  auto ifs_or_error = sde::serial::mmap_istream::create("not-a-file.bin");
+  ASSERT_FALSE(ifs_or_error.has_value());
+  ASSERT_EQ(ifs_or_error.error(), sde::serial::FileStreamError::kFileDoesNotExist);
+}
+
+TEST(MmapInputStream, ReadAll)
+{
+  auto ifs = sde::serial::mmap_istream::create("core/serialization/stream/test/resources/file_stream.dat").value();
+  ASSERT_EQ(ifs.available(), 22UL);
+
+  char buf[23];
+  ASSERT_EQ(ifs.read(buf, sizeof(buf)), 22UL);
+  ASSERT_EQ(ifs.available(), 0UL);
+
+  static const char* TARGET_VALUE = "this is just a sample\n";
+  ASSERT_EQ(std::memcmp(buf, TARGET_VALUE, std::strlen(TARGET_VALUE)), 0);
+}
+
+TEST(MmapInputStream, MoveCTor)
+{
+  auto ifs = sde::serial::mmap_istream::create("core/serialization/stream/test/resources/file_stream.dat").value();
+  sde::serial::mmap_istream ifs_move{std::move(ifs)};
+  ASSERT_EQ(ifs.available(), 0UL);
+  ASSERT_EQ(ifs_move.available(), 22UL);
+  ASSERT_EQ(ifs_move.peek(), 't');
+}
+
+TEST(MmapInputStream, ReadView)
+{
+  const auto payload = MakePayload(1000);
+  {
+    auto ofs = sde::serial::file_ostream::create("mmap-view.bin").value();
+    ofs.write(payload.data(), payload.size());
+  }
+
+  auto ifs = sde::serial::mmap_istream::create("mmap-view.bin").value();
+  std::uint8_t first = 0;
+  ifs.read(&first, sizeof(first));
+  ASSERT_EQ(first, payload[0]);
+
+  const auto view = ifs.read_view(500);
+  ASSERT_EQ(view.size(), 500UL);
+  ASSERT_EQ(std::memcmp(view.data(), payload.data() + 1, view.size()), 0);
+  ASSERT_EQ(ifs.available(), 499UL);
+  ASSERT_EQ(ifs.tell(), 501UL);
+
+  // Views remain valid after further reads
+  std::uint8_t next = 0;
+  ifs.read(&next, sizeof(next));
+  ASSERT_EQ(next, payload[501]);
+  ASSERT_EQ(std::memcmp(view.data(), payload.data() + 1, view.size()), 0);
+
+  ASSERT_TRUE(ifs.seek(0));
+  ASSERT_EQ(ifs.read_view(payload.size()).size(), payload.size());
+  ASSERT_EQ(ifs.available(), 0UL);
+}
+
+TEST(MmapInputStream, TruncatedRead)
+{
+  const auto payload = MakePayload(10);
+  {
+    auto ofs = sde::serial::file_ostream::create("mmap-truncated.bin").value();
+    ofs.write(payload.data(), payload.size());
+  }
+
+  auto ifs = sde::serial::mmap_istream::create("mmap-truncated.bin").value();
+
+  // Views past the end fail without moving the stream
+  ASSERT_TRUE(ifs.read_view(11).empty());
+  ASSERT_EQ(ifs.available(), 10UL);
+
+  std::uint8_t buf[16];
+  ASSERT_EQ(ifs.read(buf, sizeof(buf)), 10UL);
+  ASSERT_EQ(ifs.available(), 0UL);
+  ASSERT_EQ(ifs.read(buf, sizeof(buf)), 0UL);
+  ASSERT_FALSE(ifs.seek(11));
+}
+
+TEST(MmapInputStream, EmptyFile)
+{
+  {
+    auto ofs = sde::serial::file_ostream::create("mmap-empty.bin").value();
+  }
+  auto ifs = sde::serial::mmap_istream::create("mmap-empty.bin").value();
+  ASSERT_EQ(ifs.available(), 0UL);
+
+  std::uint8_t buf[4];
+  ASSERT_EQ(ifs.read(buf, sizeof(buf)), 0UL);
+  ASSERT_TRUE(ifs.read_view(0).empty());
+}
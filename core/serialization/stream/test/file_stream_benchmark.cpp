@@ -0,0 +1,98 @@
+// C++ Standard Library
+#include <cstdint>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/serial/file_istream.hpp"
+#include "sde/serial/file_ostream.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+/// Mirrors binary archive output, which is dominated by small size/handle/hash packets
+constexpr std::size_t kPacketCount = 1UL << 14UL;
+
+void WriteSmallPackets(file_ostream& ofs)
+{
+  for (std::uint64_t i = 0; i < kPacketCount; ++i)
+  {
+    ofs.write(&i, sizeof(i));
+  }
+}
+
+void WriteBenchmarkFile(const char* path)
+{
+  auto ofs = file_ostream::create(path, file_ostream::default_flags, file_ostream::default_block_size).value();
+  WriteSmallPackets(ofs);
+}
+
+}  // namespace
+
+static void BM_SmallWritesUnbuffered(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    auto ofs = file_ostream::create("small-writes-unbuffered.bin", {.nobuf = true, .binary = true}).value();
+    WriteSmallPackets(ofs);
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesUnbuffered);
+
+static void BM_SmallWritesStdioBuffered(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    auto ofs = file_ostream::create("small-writes-stdio.bin", {.nobuf = false, .binary = true}).value();
+    WriteSmallPackets(ofs);
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesStdioBuffered);
+
+static void BM_SmallWritesBuffered(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    auto ofs = file_ostream::create("small-writes-buffered.bin", file_ostream::default_flags, state.range(0)).value();
+    WriteSmallPackets(ofs);
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesBuffered)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
+
+static void BM_SmallReadsUnbuffered(benchmark::State& state)
+{
+  WriteBenchmarkFile("small-reads.bin");
+  for (auto _ : state)
+  {
+    auto ifs = file_istream::create("small-reads.bin", {.nobuf = true, .binary = true}).value();
+    std::uint64_t value = 0;
+    while (ifs.read(&value, sizeof(value)) == sizeof(value))
+    {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallReadsUnbuffered);
+
+static void BM_SmallReadsBuffered(benchmark::State& state)
+{
+  WriteBenchmarkFile("small-reads.bin");
+  for (auto _ : state)
+  {
+    auto ifs = file_istream::create("small-reads.bin", file_istream::default_flags, state.range(0)).value();
+    std::uint64_t value = 0;
+    while (ifs.read(&value, sizeof(value)) == sizeof(value))
+    {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallReadsBuffered)->RangeMultiplier(4)->Range(1 << 10, 1 << 18);
@@ -3,6 +3,7 @@
  */
 
 // C++ Standard Library
+#include <cstdio>
 #include <cstring>
 #include <string_view>
 #include <utility>
@@ -11,6 +12,7 @@
 #include <gtest/gtest.h>
 
 // SDE
+#include "sde/serial/mem_buffer_pool.hpp"
 #include "sde/serial/mem_istream.hpp"
 #include "sde/serial/mem_ostream.hpp"
 
@@ -55,6 +57,95 @@ TEST(MemInputStream, ReadTooMany)
   ASSERT_EQ(std::memcmp(buf, TARGET_VALUE, std::strlen(TARGET_VALUE)), 0);
 }
 
+TEST(MemInputStream, PeekDoesNotAdvance)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b'}};
+  ASSERT_EQ(ims.peek(), 'a');
+  ASSERT_EQ(ims.peek(), 'a');
+  ASSERT_EQ(ims.tell(), 0UL);
+  ASSERT_EQ(ims.available(), 2UL);
+}
+
+TEST(MemInputStream, PeekAtEnd)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a'}};
+  char c;
+  ASSERT_EQ(ims.read(&c, 1), 1UL);
+  ASSERT_EQ(ims.peek(), static_cast<char>(EOF));
+
+  sde::serial::mem_istream empty{std::vector<std::uint8_t>{}};
+  ASSERT_EQ(empty.peek(), static_cast<char>(EOF));
+}
+
+TEST(MemInputStream, SeekThenRead)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b', 'c', 'd'}};
+  ASSERT_TRUE(ims.seek(2));
+  ASSERT_EQ(ims.tell(), 2UL);
+  ASSERT_EQ(ims.available(), 2UL);
+  ASSERT_EQ(ims.peek(), 'c');
+
+  char buf[2];
+  ASSERT_EQ(ims.read(buf, sizeof(buf)), 2UL);
+  ASSERT_EQ(buf[0], 'c');
+  ASSERT_EQ(buf[1], 'd');
+  ASSERT_EQ(ims.tell(), 4UL);
+
+  // Seek backwards
+  ASSERT_TRUE(ims.seek(0));
+  ASSERT_EQ(ims.peek(), 'a');
+}
+
+TEST(MemInputStream, SeekToEnd)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b'}};
+  ASSERT_TRUE(ims.seek(2));
+  ASSERT_EQ(ims.available(), 0UL);
+  ASSERT_EQ(ims.peek(), static_cast<char>(EOF));
+}
+
+TEST(MemInputStream, SeekPastEnd)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b'}};
+  ASSERT_TRUE(ims.seek(1));
+  ASSERT_FALSE(ims.seek(3));
+  ASSERT_EQ(ims.tell(), 1UL);
+  ASSERT_EQ(ims.peek(), 'b');
+}
+
+TEST(MemInputStream, ReadView)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b', 'c'}};
+  const auto view = ims.read_view(2);
+  ASSERT_EQ(view.size(), 2UL);
+  ASSERT_EQ(static_cast<char>(view[1]), 'b');
+  ASSERT_EQ(ims.tell(), 2UL);
+  ASSERT_TRUE(ims.read_view(2).empty());
+  ASSERT_EQ(ims.tell(), 2UL);
+}
+
+TEST(MemInputStream, MoveKeepsPosition)
+{
+  sde::serial::mem_istream ims{std::vector<std::uint8_t>{'a', 'b', 'c'}};
+  ASSERT_TRUE(ims.seek(1));
+  sde::serial::mem_istream moved{std::move(ims)};
+  ASSERT_EQ(moved.tell(), 1UL);
+  ASSERT_EQ(moved.peek(), 'b');
+}
+
+TEST(MemInputStream, ViewOfOutputStream)
+{
+  sde::serial::mem_ostream oms{};
+  oms.write("abc", 3);
+
+  sde::serial::mem_istream ims{oms.view()};
+  ASSERT_EQ(ims.available(), 3UL);
+  ASSERT_TRUE(ims.seek(2));
+  ASSERT_EQ(ims.peek(), 'c');
+
+  // View does not consume output stream
+  ASSERT_EQ(oms.size(), 3UL);
+}
 
 TEST(MemOutputStream, Write)
 {
@@ -63,6 +154,99 @@ TEST(MemOutputStream, Write)
   ASSERT_EQ(sizeof(buf), oms.write(buf));
 }
 
+TEST(MemOutputStream, WrittenBytes)
+{
+  char buf[] = "this is a sample payload for write";
+  sde::serial::mem_ostream oms{};
+  oms.write(buf);
+  ASSERT_EQ(oms.size(), sizeof(buf));
+  ASSERT_EQ(std::memcmp(oms.data(), buf, sizeof(buf)), 0);
+}
+
+TEST(MemOutputStream, ManySmallWrites)
+{
+  sde::serial::mem_ostream oms{8};
+  for (std::uint32_t i = 0; i < 1000; ++i)
+  {
+    oms.write(&i, sizeof(i));
+  }
+  ASSERT_EQ(oms.size(), 1000 * sizeof(std::uint32_t));
+  ASSERT_GE(oms.capacity(), oms.size());
+
+  sde::serial::mem_istream ims{std::move(oms)};
+  for (std::uint32_t i = 0; i < 1000; ++i)
+  {
+    std::uint32_t value;
+    ASSERT_EQ(ims.read(&value, sizeof(value)), sizeof(value));
+    ASSERT_EQ(value, i);
+  }
+  ASSERT_EQ(ims.available(), 0UL);
+}
+
+TEST(MemOutputStream, ClearKeepsCapacity)
+{
+  sde::serial::mem_ostream oms{};
+  oms.reserve(1024);
+  const std::size_t capacity = oms.capacity();
+  ASSERT_GE(capacity, 1024UL);
+  oms.write("abc", 3);
+  oms.clear();
+  ASSERT_EQ(oms.size(), 0UL);
+  ASSERT_EQ(oms.capacity(), capacity);
+}
+
+TEST(MemOutputStream, MoveAssign)
+{
+  sde::serial::mem_ostream oms{};
+  oms.write("abc", 3);
+  sde::serial::mem_ostream other{};
+  other = std::move(oms);
+  ASSERT_EQ(other.size(), 3UL);
+  ASSERT_EQ(std::memcmp(other.data(), "abc", 3), 0);
+}
+
+TEST(MemBufferPool, BufferReused)
+{
+  sde::serial::mem_buffer_pool pool;
+  const std::uint8_t* storage = nullptr;
+  {
+    sde::serial::mem_ostream oms{pool};
+    oms.reserve(4096);
+    oms.write("abc", 3);
+    storage = oms.data();
+  }
+  ASSERT_EQ(pool.size(), 1UL);
+
+  sde::serial::mem_ostream oms{pool};
+  ASSERT_EQ(pool.size(), 0UL);
+  ASSERT_EQ(oms.data(), storage);
+  ASSERT_EQ(oms.size(), 0UL);
+  ASSERT_GE(oms.capacity(), 4096UL);
+}
+
+TEST(MemBufferPool, BufferReturnedByInputStream)
+{
+  sde::serial::mem_buffer_pool pool;
+  {
+    sde::serial::mem_ostream oms{pool};
+    oms.write("abc", 3);
+    sde::serial::mem_istream ims{std::move(oms)};
+    ASSERT_EQ(ims.available(), 3UL);
+    ASSERT_EQ(pool.size(), 0UL);
+  }
+  ASSERT_EQ(pool.size(), 1UL);
+}
+
+TEST(MemBufferPool, Bounded)
+{
+  sde::serial::mem_buffer_pool pool{1};
+  {
+    sde::serial::mem_ostream a{pool};
+    sde::serial::mem_ostream b{pool};
+  }
+  ASSERT_EQ(pool.size(), 1UL);
+}
+
 TEST(MemStream, WriteThenRead)
 {
   char write_buf[] = "this is a sample payload for readback";
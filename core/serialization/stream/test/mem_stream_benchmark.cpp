@@ -0,0 +1,102 @@
+// C++ Standard Library
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// SDE
+#include "sde/serial/mem_stream.hpp"
+
+using namespace sde::serial;
+
+namespace
+{
+
+/// Mirrors binary archive output, which is dominated by small size/handle/hash packets
+constexpr std::size_t kPacketCount = 1UL << 14UL;
+
+template <typename OStreamT> void WriteSmallPackets(OStreamT& oms)
+{
+  for (std::uint64_t i = 0; i < kPacketCount; ++i)
+  {
+    oms.write(&i, sizeof(i));
+  }
+}
+
+/**
+ * @brief Previous mem_ostream write path, which resizes its buffer on every write
+ */
+class ResizeOnWriteStream
+{
+public:
+  void write(const void* ptr, std::size_t len)
+  {
+    const std::size_t pos = buffer_.size();
+    buffer_.resize(buffer_.size() + len);
+    std::memcpy(buffer_.data() + pos, ptr, len);
+  }
+
+  const std::uint8_t* data() const { return buffer_.data(); }
+
+private:
+  std::vector<std::uint8_t> buffer_;
+};
+
+}  // namespace
+
+static void BM_SmallWritesResizeOnWrite(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    ResizeOnWriteStream oms;
+    WriteSmallPackets(oms);
+    benchmark::DoNotOptimize(oms.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesResizeOnWrite);
+
+static void BM_SmallWrites(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    mem_ostream oms;
+    WriteSmallPackets(oms);
+    benchmark::DoNotOptimize(oms.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWrites);
+
+static void BM_SmallWritesPooled(benchmark::State& state)
+{
+  mem_buffer_pool pool;
+  for (auto _ : state)
+  {
+    mem_ostream oms{pool};
+    WriteSmallPackets(oms);
+    benchmark::DoNotOptimize(oms.data());
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesPooled);
+
+static void BM_SmallWritesThenRead(benchmark::State& state)
+{
+  mem_buffer_pool pool;
+  for (auto _ : state)
+  {
+    mem_ostream oms{pool};
+    WriteSmallPackets(oms);
+    mem_istream ims{std::move(oms)};
+    std::uint64_t value = 0;
+    while (ims.read(&value, sizeof(value)) == sizeof(value))
+    {
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kPacketCount * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_SmallWritesThenRead);
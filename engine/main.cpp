@@ -1,3 +1,9 @@
+// C++ Standard Library
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+
 // SDE
 #include "sde/app.hpp"
 #include "sde/game/game.hpp"
@@ -7,12 +13,27 @@ using namespace sde;
 
 int main(int argc, char** argv)
 {
-  SDE_ASSERT_GT(argc, 1) << argv[0] << " <dir>";
+  InstallLogCrashHandlers();
+
+  SDE_ASSERT_GT(argc, 1) << argv[0] << " <dir> [headless frame count]";
 
   SDE_LOG_INFO() << "loading game data from: " << argv[1];
 
-  // Create an application window
-  auto app_or_error = App::create({.initial_size = {1000, 500}});
+  // Create an application window, or run a fixed number of frames without one
+  std::size_t frame_limit = 0;
+  if (argc > 2)
+  {
+    const char* const first = argv[2];
+    const char* const last = first + std::strlen(first);
+    if (const auto [ptr, ec] = std::from_chars(first, last, frame_limit);
+        (ec != std::errc{}) or (ptr != last) or (frame_limit == 0))
+    {
+      SDE_LOG_ERROR() << "invalid headless frame count: " << argv[2] << " (expected a positive integer)";
+      return 1;
+    }
+  }
+  auto app_or_error = (frame_limit > 0) ? App::createHeadless({.frame_limit = frame_limit})
+                                        : App::create({.initial_size = {1000, 500}});
   SDE_ASSERT_OK(app_or_error);
 
   // Create scene graph from manifest
@@ -30,6 +30,13 @@ template <typename ArchiveT> bool serialize(audio_manager* self, ArchiveT& ar) {
 
 bool initialize(audio_manager* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
+  // Headless apps have no sound device; sounds are listed, but not played, without a mixer
+  if (app.sound_device == nullptr)
+  {
+    SDE_LOG_INFO() << "Audio disabled (no sound device)";
+    return true;
+  }
+
   auto mixer_or_error = Mixer::create(app.sound_device);
 
   if (!mixer_or_error.has_value())
@@ -74,7 +81,7 @@ bool update(audio_manager* self, sde::game::GameResources& resources, const sde:
         track->jump(p);
       }
     }
-    else if (ImGui::ArrowButton("play", ImGuiDir_Right))
+    else if (self->mixer.has_value() and ImGui::ArrowButton("play", ImGuiDir_Right))
     {
       if (auto target_or_error = ListenerTarget::create(*self->mixer, 0))
       {
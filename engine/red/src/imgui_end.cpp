@@ -29,7 +29,11 @@ bool shutdown(imgui_end* self, sde::game::GameResources& resources, const sde::A
 
 bool update(imgui_end* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
-  if (ImGui::GetCurrentContext() == nullptr)
+  if (app.window == nullptr)
+  {
+    return true;
+  }
+  else if (ImGui::GetCurrentContext() == nullptr)
   {
     return false;
   }
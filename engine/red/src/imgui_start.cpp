@@ -54,6 +54,13 @@ bool shutdown(imgui_start* self, sde::game::GameResources& resources, const sde:
 
 bool initialize(imgui_start* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
+  // Headless apps have no window to draw to; without a context, ImGui scripts skip their updates
+  if (app.window == nullptr)
+  {
+    SDE_LOG_INFO() << "ImGui disabled (no window)";
+    return true;
+  }
+
   IMGUI_CHECKVERSION();
 
   self->imgui_context = ImGui::CreateContext();
@@ -81,7 +88,11 @@ bool initialize(imgui_start* self, sde::game::GameResources& resources, const sd
 
 bool update(imgui_start* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
-  if (ImGui::GetCurrentContext() == nullptr)
+  if (app.window == nullptr)
+  {
+    return true;
+  }
+  else if (ImGui::GetCurrentContext() == nullptr)
   {
     return false;
   }
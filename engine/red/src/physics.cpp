@@ -1,4 +1,9 @@
 #define SDE_SCRIPT_TYPE_NAME "physics"
+#define SDE_SCRIPT_READS "registry/Dynamics"
+#define SDE_SCRIPT_WRITES "registry/Position"
+
+// C++ Standard Library
+#include <cstddef>
 
 // SDE
 #include "sde/game/native_script_runtime.hpp"
@@ -27,8 +32,12 @@ bool shutdown(physics* self, sde::game::GameResources& resources, const sde::App
 bool update(physics* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
   auto& registry = resources.get<Registry>();
-  registry.view<Position, Dynamics>().each(
-    [dt = toSeconds(app.time_delta)](Position& pos, const Dynamics& state) { pos.center += state.velocity * dt; });
+  const float dt = toSeconds(app.simulation_time_delta);
+  for (std::size_t step = 0; step < app.simulation_steps; ++step)
+  {
+    registry.view<Position, const Dynamics>().each(
+      [dt](Position& pos, const Dynamics& state) { pos.center += state.velocity * dt; });
+  }
   return true;
 }
 
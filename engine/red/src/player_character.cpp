@@ -1,4 +1,6 @@
 #define SDE_SCRIPT_TYPE_NAME "player_character"
+#define SDE_SCRIPT_READS "entities, tile_sets"
+#define SDE_SCRIPT_WRITES "imgui, registry/Size, registry/Position, registry/Dynamics, registry/AnimatedSprite"
 
 // C++ Standard Library
 #include <array>
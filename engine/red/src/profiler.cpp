@@ -0,0 +1,193 @@
+#define SDE_SCRIPT_TYPE_NAME "profiler"
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string_view>
+
+// ImGui
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include <imgui.h>
+
+// SDE
+#include "sde/game/native_script_runtime.hpp"
+#include "sde/profiler.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+/// Name of the scope which covers a single frame (see App::spin)
+static constexpr const char* kFrameScopeName = "App::spin";
+
+/// Scopes older than this are not searched for the most recent frame, in nanoseconds
+static constexpr std::int64_t kFrameSearchWindow = 250'000'000;
+
+/// File which traces are saved to, relative to the working directory
+static constexpr const char* kTracePath = "profile.trace.json";
+
+
+struct profiler : native_script_data
+{
+  /// Stop capturing new frames when set
+  bool paused = false;
+  /// Scopes which overlap the captured frame
+  sde::vector<ProfileSpan> frame_spans;
+  /// Start of the captured frame, in nanoseconds
+  std::int64_t frame_begin_ns = 0;
+  /// End of the captured frame, in nanoseconds
+  std::int64_t frame_end_ns = 0;
+};
+
+template <typename ArchiveT> bool serialize(profiler* self, ArchiveT& ar)
+{
+  using namespace sde::serial;
+  ar& Field{"paused", self->paused};
+  return true;
+}
+
+bool initialize(profiler* self, sde::game::GameResources& resources, const sde::AppProperties& app) { return true; }
+
+bool shutdown(profiler* self, sde::game::GameResources& resources, const sde::AppProperties& app) { return true; }
+
+void capture(profiler* self)
+{
+  auto spans = ProfileCollect(ProfileNow() - kFrameSearchWindow);
+
+  // Find the most recent completed frame; the current frame is still open
+  const ProfileSpan* frame = nullptr;
+  for (const auto& span : spans)
+  {
+    if ((span.depth == 0) and (std::strcmp(span.name, kFrameScopeName) == 0) and
+        ((frame == nullptr) or (span.end_ns > frame->end_ns)))
+    {
+      frame = &span;
+    }
+  }
+
+  if (frame == nullptr)
+  {
+    return;
+  }
+
+  self->frame_begin_ns = frame->begin_ns;
+  self->frame_end_ns = frame->end_ns;
+  const auto outside_frame = [self](const auto& span) {
+    return (span.end_ns < self->frame_begin_ns) or (span.begin_ns > self->frame_end_ns);
+  };
+  spans.erase(std::remove_if(spans.begin(), spans.end(), outside_frame), spans.end());
+  self->frame_spans = std::move(spans);
+}
+
+void flame_graph(const profiler* self)
+{
+  const float frame_duration = static_cast<float>(std::max<std::int64_t>(1, self->frame_end_ns - self->frame_begin_ns));
+  const ImVec2 origin = ImGui::GetCursorScreenPos();
+  const float width = std::max(1.F, ImGui::GetContentRegionAvail().x);
+  const float row_height = ImGui::GetTextLineHeightWithSpacing();
+
+  // Each thread is drawn below the previous one, with one row per scope depth
+  sde::vector<std::pair<std::size_t, std::size_t>> thread_rows;
+  for (const auto& span : self->frame_spans)
+  {
+    auto itr = std::find_if(
+      thread_rows.begin(), thread_rows.end(), [&span](const auto& tr) { return tr.first == span.thread; });
+    if (itr == thread_rows.end())
+    {
+      thread_rows.emplace_back(span.thread, span.depth + 1);
+    }
+    else
+    {
+      itr->second = std::max(itr->second, span.depth + 1);
+    }
+  }
+
+  ImDrawList* draw_list = ImGui::GetWindowDrawList();
+  std::size_t row_offset = 0;
+  for (const auto& [thread, rows] : thread_rows)
+  {
+    for (const auto& span : self->frame_spans)
+    {
+      if (span.thread != thread)
+      {
+        continue;
+      }
+
+      const float t0 = static_cast<float>(std::max(span.begin_ns, self->frame_begin_ns) - self->frame_begin_ns);
+      const float t1 = static_cast<float>(std::min(span.end_ns, self->frame_end_ns) - self->frame_begin_ns);
+      const float y = origin.y + row_height * static_cast<float>(row_offset + span.depth);
+      const ImVec2 rect_min{origin.x + width * (t0 / frame_duration), y};
+      const ImVec2 rect_max{std::max(rect_min.x + 1.F, origin.x + width * (t1 / frame_duration)), y + row_height - 1.F};
+
+      const float hue = static_cast<float>(std::hash<std::string_view>{}(span.name) % 360UL) / 360.F;
+      draw_list->AddRectFilled(rect_min, rect_max, ImColor::HSV(hue, 0.5F, 0.7F));
+      draw_list->PushClipRect(rect_min, rect_max, true);
+      draw_list->AddText(rect_min + ImVec2{2.F, 0.F}, IM_COL32_WHITE, span.name);
+      draw_list->PopClipRect();
+
+      if (ImGui::IsMouseHoveringRect(rect_min, rect_max))
+      {
+        const char* thread_name = GetProfileThreadName(span.thread);
+        ImGui::SetTooltip(
+          "%s\n%.3f ms\nthread: %s",
+          span.name,
+          static_cast<float>(span.end_ns - span.begin_ns) * 1e-6F,
+          (thread_name == nullptr) ? "?" : thread_name);
+      }
+    }
+    row_offset += rows;
+  }
+
+  ImGui::Dummy(ImVec2{width, row_height * static_cast<float>(row_offset)});
+}
+
+bool update(profiler* self, sde::game::GameResources& resources, const sde::AppProperties& app)
+{
+  if (ImGui::GetCurrentContext() == nullptr)
+  {
+    return true;
+  }
+
+  if (!self->paused)
+  {
+    capture(self);
+  }
+
+  ImGui::Begin("profiler");
+
+  if (bool enabled = IsProfilingEnabled(); ImGui::Checkbox("enabled", &enabled))
+  {
+    SetProfilingEnabled(enabled);
+  }
+  ImGui::SameLine();
+  ImGui::Checkbox("paused", &self->paused);
+  ImGui::SameLine();
+  if (ImGui::Button("save trace"))
+  {
+    if (const auto ok_or_error = WriteChromeTrace(kTracePath, ProfileCollect()); ok_or_error.has_value())
+    {
+      SDE_LOG_INFO() << "Saved trace: " << SDE_OSNV(kTracePath);
+    }
+    else
+    {
+      SDE_LOG_ERROR() << "Failed to save trace: " << ok_or_error.error();
+    }
+  }
+
+  ImGui::Text("frame : %.3f ms", static_cast<float>(self->frame_end_ns - self->frame_begin_ns) * 1e-6F);
+  ImGui::Text(
+    "p50 : %.3f ms  p95 : %.3f ms  p99 : %.3f ms",
+    toSeconds(app.frame_time_stats.p50) * 1e3F,
+    toSeconds(app.frame_time_stats.p95) * 1e3F,
+    toSeconds(app.frame_time_stats.p99) * 1e3F);
+  ImGui::Separator();
+  flame_graph(self);
+
+  ImGui::End();
+
+  return true;
+}
+
+
+SDE_NATIVE_SCRIPT__REGISTER_AUTO(profiler);
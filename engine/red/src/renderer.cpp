@@ -70,6 +70,15 @@ template <typename ArchiveT> bool serialize(renderer_state* self, ArchiveT& ar)
 
 bool initialize(renderer_state* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
+  SDE_ASSERT_NE(app.frame_arena, nullptr);
+
+  // Headless apps have no window, and so no graphics context to render with
+  if (app.window == nullptr)
+  {
+    SDE_LOG_INFO() << "Rendering disabled (no window)";
+    return true;
+  }
+
   if (!graphics::Window::try_backend_initialization())
   {
     SDE_LOG_ERROR() << "Backend not initialized";
@@ -120,12 +129,26 @@ bool initialize(renderer_state* self, sde::game::GameResources& resources, const
   return true;
 }
 
-bool shutdown(renderer_state* self, sde::game::GameResources& resources, const sde::AppProperties& app) { return true; }
+bool shutdown(renderer_state* self, sde::game::GameResources& resources, const sde::AppProperties& app)
+{
+  // Buffers may still point into the per-frame arena; rebind them before the arena goes away
+  self->render_buffer.reset(nullptr);
+  return true;
+}
 
 bool update(renderer_state* self, sde::game::GameResources& resources, const sde::AppProperties& app)
 {
   using namespace sde::graphics;
 
+  if (app.window == nullptr)
+  {
+    return true;
+  }
+
+  // Render buffers are refilled every frame, so they draw from the per-frame arena
+  SDE_ASSERT_NE(app.frame_arena, nullptr);
+  self->render_buffer.reset(app.frame_arena);
+
   RenderResources render_resources;
   render_resources.target = self->render_target;
   render_resources.shader = self->sprite_shader;
@@ -247,14 +270,14 @@ bool update(renderer_state* self, sde::game::GameResources& resources, const sde
         type_setter.draw(
           *render_pass_or_error,
           resources.all(),
-          sde::format("pos: (%.3f, %.3f)", pos.center.x(), pos.center.y()),
+          sde::format(*app.frame_arena, "pos: (%.3f, %.3f)", pos.center.x(), pos.center.y()),
           pos.center + sde::Vec2f{0.0, -0.3F},
           {0.025F},
           Yellow(0.8));
         type_setter.draw(
           *render_pass_or_error,
           resources.all(),
-          sde::format("vel: (%.3f, %.3f)", state.velocity.x(), state.velocity.y()),
+          sde::format(*app.frame_arena, "vel: (%.3f, %.3f)", state.velocity.x(), state.velocity.y()),
           pos.center + sde::Vec2f{0.0, -0.3F - 0.05},
           {0.025F},
           Yellow(0.8));
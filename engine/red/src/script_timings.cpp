@@ -0,0 +1,108 @@
+#define SDE_SCRIPT_TYPE_NAME "script_timings"
+
+// C++ Standard Library
+#include <ostream>
+
+// ImGui
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include <imgui.h>
+
+// SDE
+#include "sde/game/native_script_runtime.hpp"
+
+using namespace sde;
+using namespace sde::game;
+
+
+struct script_timings : native_script_data
+{};
+
+template <typename ArchiveT> bool serialize(script_timings* self, ArchiveT& ar)
+{
+  using namespace sde::serial;
+  return true;
+}
+
+bool initialize(script_timings* self, sde::game::GameResources& resources, const sde::AppProperties& app)
+{
+  return true;
+}
+
+bool shutdown(script_timings* self, sde::game::GameResources& resources, const sde::AppProperties& app) { return true; }
+
+static float toMilliseconds(TimeOffset duration) { return toSeconds(duration) * 1e3F; }
+
+bool update(script_timings* self, sde::game::GameResources& resources, const sde::AppProperties& app)
+{
+  if (ImGui::GetCurrentContext() == nullptr)
+  {
+    return true;
+  }
+
+  ImGui::Begin("script timings");
+
+  if (ImGui::Button("reset"))
+  {
+    resources.scriptTimings().reset();
+  }
+
+  static constexpr auto kTableCols = 8;
+  static constexpr auto kTableFlags =
+    ImGuiTableFlags_Resizable | ImGuiTableFlags_NoSavedSettings | ImGuiTableFlags_Borders;
+  if (ImGui::BeginTable("script timings", kTableCols, kTableFlags))
+  {
+    ImGui::TableSetupColumn("name");
+    ImGui::TableSetupColumn("last (ms)");
+    ImGui::TableSetupColumn("mean (ms)");
+    ImGui::TableSetupColumn("p99 (ms)");
+    ImGui::TableSetupColumn("max (ms)");
+    ImGui::TableSetupColumn("budget (ms)");
+    ImGui::TableSetupColumn("overruns");
+    ImGui::TableSetupColumn("deferrals");
+    ImGui::TableHeadersRow();
+    for (const auto& [handle, timing] : resources.scriptTimings())
+    {
+      const auto stats = timing.stats();
+      const auto& budget = timing.budget();
+      const bool over_budget = (budget.limit != TimeOffset::zero()) and (stats.last > budget.limit);
+      ImGui::TableNextColumn();
+      ImGui::Text("%s", timing.name().c_str());
+      ImGui::TableNextColumn();
+      if (over_budget)
+      {
+        ImGui::TextColored(ImVec4{1.F, 0.3F, 0.3F, 1.F}, "%.3f", toMilliseconds(stats.last));
+      }
+      else
+      {
+        ImGui::Text("%.3f", toMilliseconds(stats.last));
+      }
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", toMilliseconds(stats.mean));
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", toMilliseconds(stats.p99));
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", toMilliseconds(stats.max));
+      ImGui::TableNextColumn();
+      if (budget.limit == TimeOffset::zero())
+      {
+        ImGui::TextUnformatted("-");
+      }
+      else
+      {
+        ImGui::Text("%.3f%s", toMilliseconds(budget.limit), budget.deferrable ? " (deferrable)" : "");
+      }
+      ImGui::TableNextColumn();
+      ImGui::Text("%lu", stats.overruns);
+      ImGui::TableNextColumn();
+      ImGui::Text("%lu", stats.deferrals);
+    }
+    ImGui::EndTable();
+  }
+
+  ImGui::End();
+
+  return true;
+}
+
+
+SDE_NATIVE_SCRIPT__REGISTER_AUTO(script_timings);
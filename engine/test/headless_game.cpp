@@ -0,0 +1,149 @@
+// C++ Standard Library
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// SDE
+#include "sde/app.hpp"
+#include "sde/asset.hpp"
+#include "sde/game/game.hpp"
+#include "sde/game/registry.hpp"
+
+// RED
+#include "red/components.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+/// Game directory holding engine/test/headless_game/manifest.json
+constexpr const char* kManifestDirectory = "engine/test/headless_game";
+
+/// Number of bodies moved by physics
+constexpr std::size_t kBodyCount = 16;
+
+/**
+ * @brief Copies the test manifest into a new game directory, so that data saved by one run is not loaded by the next
+ */
+asset::path makeGameDirectory()
+{
+  static std::size_t run = 0;
+  const auto directory = asset::temp_directory_path() / ("sde_headless_game_" + std::to_string(run++));
+  asset::remove_all(directory);
+  asset::create_directories(directory);
+  asset::copy_file(asset::path{kManifestDirectory} / "manifest.json", directory / "manifest.json");
+  return directory;
+}
+
+/**
+ * @brief Loads the test game, adds moving bodies, and runs it headless for \p frame_limit frames
+ *
+ * @return final position of each body
+ */
+std::vector<Vec2f> runGame(std::size_t frame_limit)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = frame_limit});
+  auto game_or_error = game::create(makeGameDirectory());
+  if (!app_or_error.has_value() or !game_or_error.has_value())
+  {
+    ADD_FAILURE() << "failed to create headless game";
+    return {};
+  }
+
+  auto& registry = game_or_error->resources().get<game::Registry>();
+  std::vector<game::EntityID> bodies;
+  for (std::size_t i = 0; i < kBodyCount; ++i)
+  {
+    const auto id = registry.create();
+    registry.emplace<Position>(id).center = {static_cast<float>(i), 0.F};
+    auto& dynamics = registry.emplace<Dynamics>(id);
+    dynamics.velocity = {0.1F * static_cast<float>(i), -2.5F};
+    dynamics.looking.setZero();
+    bodies.push_back(id);
+  }
+
+  game_or_error->spin(*app_or_error);
+
+  std::vector<Vec2f> positions;
+  for (const auto id : bodies)
+  {
+    positions.push_back(registry.get<Position>(id).center);
+  }
+  return positions;
+}
+
+/**
+ * @brief Returns simulated time after \p frame_limit frames of the test game
+ */
+TimeOffset simulatedTime(std::size_t frame_limit)
+{
+  // Manifest rates; the first frame only resets, and each following frame is one loop period long
+  const auto step = Rate::fromHertz(120.F).period();
+  const auto elapsed = static_cast<TimeOffset::rep>(frame_limit - 1) * Rate::fromHertz(60.F).period();
+  return (elapsed / step) * step;
+}
+
+}  // namespace
+
+TEST(HeadlessGame, LoadsAndRuns)
+{
+  auto app_or_error = App::createHeadless({.frame_limit = 10});
+  ASSERT_TRUE(app_or_error.has_value());
+
+  auto game_or_error = game::create(makeGameDirectory());
+  ASSERT_TRUE(game_or_error.has_value()) << game_or_error.error();
+  game_or_error->spin(*app_or_error);
+}
+
+TEST(HeadlessGame, ZeroSimulationRateRejected)
+{
+  const auto directory = makeGameDirectory();
+  const auto manifest_path = directory / "manifest.json";
+  std::string manifest;
+  {
+    std::ifstream ifs{manifest_path};
+    manifest.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+  }
+  const std::string rate_entry = "\"simulation_rate\"   : 120.0";
+  const auto pos = manifest.find(rate_entry);
+  ASSERT_NE(pos, std::string::npos);
+  manifest.replace(pos, rate_entry.size(), "\"simulation_rate\"   : 0.0");
+  std::ofstream{manifest_path} << manifest;
+
+  auto game_or_error = game::create(directory);
+  ASSERT_FALSE(game_or_error.has_value());
+  ASSERT_EQ(game_or_error.error(), game::GameError::kInvalidManifest);
+}
+
+TEST(HeadlessGame, PhysicsAdvancesBySimulatedTime)
+{
+  static constexpr std::size_t kFrameLimit = 240;
+  const auto positions = runGame(kFrameLimit);
+  ASSERT_EQ(positions.size(), kBodyCount);
+
+  const float t = toSeconds(simulatedTime(kFrameLimit));
+  for (std::size_t i = 0; i < kBodyCount; ++i)
+  {
+    EXPECT_NEAR(positions[i].x(), static_cast<float>(i) + 0.1F * static_cast<float>(i) * t, 1e-3F) << "body " << i;
+    EXPECT_NEAR(positions[i].y(), -2.5F * t, 1e-3F) << "body " << i;
+  }
+}
+
+TEST(HeadlessGame, RunsAreBitIdentical)
+{
+  static constexpr std::size_t kFrameLimit = 600;
+  const auto first = runGame(kFrameLimit);
+  const auto second = runGame(kFrameLimit);
+  ASSERT_EQ(first.size(), second.size());
+  for (std::size_t i = 0; i < first.size(); ++i)
+  {
+    ASSERT_EQ(first[i].x(), second[i].x()) << "body " << i;
+    ASSERT_EQ(first[i].y(), second[i].y()) << "body " << i;
+  }
+}
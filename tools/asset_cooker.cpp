@@ -0,0 +1,92 @@
+// C++ Standard Library
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+// SDE
+#include "sde/audio/sound_data.hpp"
+#include "sde/cooked_asset.hpp"
+#include "sde/graphics/font.hpp"
+#include "sde/graphics/image.hpp"
+#include "sde/graphics/type_set.hpp"
+#include "sde/logging.hpp"
+#include "sde/resource_dependencies.hpp"
+
+using namespace sde;
+
+namespace
+{
+
+bool hasExtension(const asset::path& path, std::initializer_list<const char*> extensions)
+{
+  const auto extension = path.extension().string();
+  for (const char* e : extensions)
+  {
+    if (extension == e)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  SDE_ASSERT_GT(argc, 2) << argv[0] << " <asset-dir> <cooked-dir> [type-set-height...]";
+
+  const asset::path asset_directory{argv[1]};
+  const CookedAssetStore cooked_assets{asset::path{argv[2]}};
+
+  std::vector<std::size_t> type_set_heights;
+  for (int i = 3; i < argc; ++i)
+  {
+    type_set_heights.push_back(std::stoul(argv[i]));
+  }
+
+  SDE_LOG_INFO() << "cooking assets from: " << asset_directory << " to: " << cooked_assets.directory();
+  asset::create_directories(cooked_assets.directory());
+
+  graphics::FontCache fonts;
+  std::size_t cooked_count = 0;
+  std::size_t failed_count = 0;
+  for (const auto& entry : asset::recursive_directory_iterator{asset_directory})
+  {
+    if (!entry.is_regular_file())
+    {
+      continue;
+    }
+
+    const auto& path = entry.path();
+    if (hasExtension(path, {".png", ".jpg", ".jpeg", ".bmp", ".tga"}))
+    {
+      const auto ok_or_error = graphics::ImageCache::cook(cooked_assets, path);
+      (ok_or_error.has_value() ? cooked_count : failed_count) += 1;
+    }
+    else if (hasExtension(path, {".wav"}))
+    {
+      const auto ok_or_error = audio::SoundDataCache::cook(cooked_assets, path);
+      (ok_or_error.has_value() ? cooked_count : failed_count) += 1;
+    }
+    else if (hasExtension(path, {".ttf", ".otf"}) and !type_set_heights.empty())
+    {
+      auto font_or_error = fonts.create(NoDependencies, path);
+      if (!font_or_error.has_value())
+      {
+        failed_count += type_set_heights.size();
+        continue;
+      }
+      for (const std::size_t height : type_set_heights)
+      {
+        const auto ok_or_error = graphics::TypeSetCache::cook(
+          cooked_assets, *font_or_error->value, graphics::TypeSetOptions{.height_px = height});
+        (ok_or_error.has_value() ? cooked_count : failed_count) += 1;
+      }
+    }
+  }
+
+  SDE_LOG_INFO() << "cooked " << cooked_count << " assets (" << failed_count << " failed)";
+  return (failed_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,28 @@
+// SDE
+#include "sde/asset_pack.hpp"
+#include "sde/logging.hpp"
+
+using namespace sde;
+
+int main(int argc, char** argv)
+{
+  SDE_ASSERT_GT(argc, 2) << argv[0] << " <asset-dir> <output-pack>";
+
+  const asset::path asset_directory{argv[1]};
+  const asset::path pack_path{argv[2]};
+
+  SDE_LOG_INFO() << "packing assets from: " << asset_directory;
+
+  auto writer_or_error = AssetPackWriter::create(pack_path);
+  SDE_ASSERT_OK(writer_or_error);
+
+  const auto count_or_error = writer_or_error->add_directory(asset_directory);
+  SDE_ASSERT_OK(count_or_error);
+
+  const auto finish_or_error = writer_or_error->finish();
+  SDE_ASSERT_OK(finish_or_error);
+
+  SDE_LOG_INFO() << "packed " << (*count_or_error) << " assets to: " << pack_path << " ("
+                 << asset::file_size(pack_path) << " bytes)";
+  return 0;
+}